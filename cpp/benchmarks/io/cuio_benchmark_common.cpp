@@ -50,11 +50,11 @@ cudf_io::source_info cuio_source_sink_pair::make_source_info()
   }
 }
 
-cudf_io::sink_info cuio_source_sink_pair::make_sink_info()
+cudf_io::sink_info cuio_source_sink_pair::make_sink_info(cudf_io::file_sink_mode file_mode)
 {
   switch (type) {
     case io_type::VOID: return cudf_io::sink_info();
-    case io_type::FILEPATH: return cudf_io::sink_info(file_name);
+    case io_type::FILEPATH: return cudf_io::sink_info(file_name, file_mode);
     case io_type::HOST_BUFFER: return cudf_io::sink_info(&buffer);
     default: CUDF_FAIL("invalid output type");
   }
@@ -60,9 +60,12 @@ class cuio_source_sink_pair {
    * The `data_sink` created using the returned `source_info` will write data to the same location
    * that the result of a @ref `make_source_info` call reads from.
    *
+   * @param file_mode How the data is written when the sink is a file
+   *
    * @return The description of the data sink
    */
-  cudf::io::sink_info make_sink_info();
+  cudf::io::sink_info make_sink_info(
+    cudf::io::file_sink_mode file_mode = cudf::io::file_sink_mode::SYNC);
 
  private:
   static temp_directory const tmpdir;
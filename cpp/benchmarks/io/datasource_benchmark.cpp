@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_benchmark_common.hpp>
+
+#include <cudf/io/datasource.hpp>
+
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <fstream>
+#include <thread>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size = 512 << 20;
+constexpr size_t read_size = 1 << 20;
+
+namespace cudf_io = cudf::io;
+
+/**
+ * @brief Kind of file `datasource` used in the benchmark.
+ */
+enum class file_source_kind : int32_t { MEMORY_MAPPED, DIRECT_READ };
+
+class DatasourceRead : public cudf::benchmark {
+};
+
+std::unique_ptr<cudf_io::datasource> make_file_source(file_source_kind kind,
+                                                      std::string const& filepath)
+{
+  switch (kind) {
+    case file_source_kind::MEMORY_MAPPED: return cudf_io::datasource::create(filepath);
+    case file_source_kind::DIRECT_READ: return cudf_io::detail::make_direct_read_source(filepath);
+    default: CUDF_FAIL("Unsupported file source kind");
+  }
+}
+
+void BM_datasource_concurrent_read(benchmark::State& state)
+{
+  auto const source_kind = static_cast<file_source_kind>(state.range(0));
+  auto const num_threads = state.range(1);
+
+  cuio_source_sink_pair source_sink(io_type::FILEPATH);
+  auto const filepath = source_sink.make_sink_info().filepath;
+  {
+    std::vector<char> const data(data_size, 'x');
+    std::ofstream file(filepath, std::ios::binary);
+    file.write(data.data(), data.size());
+  }
+  // A single source is shared by all threads
+  auto const source = make_file_source(source_kind, filepath);
+
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (int64_t t = 0; t < num_threads; ++t) {
+      threads.emplace_back([&, t]() {
+        std::vector<uint8_t> dst(read_size);
+        // Interleave the reads so that the threads cover the whole file
+        for (size_t offset = t * read_size; offset < data_size; offset += num_threads * read_size) {
+          source->host_read(offset, read_size, dst.data());
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+}
+
+BENCHMARK_DEFINE_F(DatasourceRead, concurrent_read)
+(::benchmark::State& state) { BM_datasource_concurrent_read(state); }
+BENCHMARK_REGISTER_F(DatasourceRead, concurrent_read)
+  ->ArgsProduct({{int32_t(file_source_kind::MEMORY_MAPPED), int32_t(file_source_kind::DIRECT_READ)},
+                 {1, 2, 4, 8, 16}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
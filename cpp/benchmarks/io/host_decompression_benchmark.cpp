@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <io/comp/gpuinflate.h>
+#include <io/comp/host_codec.h>
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <zlib.h>
+
+#include <random>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size = 256 << 20;
+
+namespace cudf_io = cudf::io;
+
+/**
+ * @brief Where the chunks are decompressed in the benchmark.
+ */
+enum class decompression_path : int32_t { GPU, HOST };
+
+class HostDecompression : public cudf::benchmark {
+};
+
+/**
+ * @brief Generates a compressible chunk of text and compresses it as a raw deflate stream.
+ */
+std::vector<uint8_t> make_deflate_chunk(size_t chunk_size)
+{
+  std::mt19937 engine{1};
+  std::uniform_int_distribution<int> digit{0, 9};
+  std::vector<uint8_t> data(chunk_size);
+  for (auto& c : data) {
+    c = '0' + digit(engine);
+  }
+
+  // Negative window bits produce a raw deflate stream, without a zlib header
+  z_stream strm{};
+  auto const init_res =
+    deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+  CUDF_EXPECTS(init_res == Z_OK, "Cannot initialize deflate");
+  std::vector<uint8_t> compressed(deflateBound(&strm, chunk_size));
+  strm.next_in   = data.data();
+  strm.avail_in  = data.size();
+  strm.next_out  = compressed.data();
+  strm.avail_out = compressed.size();
+  auto const res = deflate(&strm, Z_FINISH);
+  deflateEnd(&strm);
+  CUDF_EXPECTS(res == Z_STREAM_END, "Cannot compress benchmark data");
+  compressed.resize(strm.total_out);
+  return compressed;
+}
+
+void BM_inflate_chunks(benchmark::State& state)
+{
+  auto const path       = static_cast<decompression_path>(state.range(0));
+  size_t const chunk_sz = state.range(1);
+  auto const num_chunks = static_cast<int>(data_size / chunk_sz);
+  auto const stream     = rmm::cuda_stream_default;
+
+  // All chunks hold a copy of the same compressed data
+  auto const h_chunk = make_deflate_chunk(chunk_sz);
+  rmm::device_buffer d_src(h_chunk.size() * num_chunks, stream);
+  rmm::device_buffer d_dst(data_size, stream);
+  std::vector<cudf_io::gpu_inflate_input_s> h_inputs(num_chunks);
+  for (int i = 0; i < num_chunks; ++i) {
+    auto const src = static_cast<uint8_t*>(d_src.data()) + i * h_chunk.size();
+    CUDA_TRY(cudaMemcpyAsync(
+      src, h_chunk.data(), h_chunk.size(), cudaMemcpyHostToDevice, stream.value()));
+    h_inputs[i].srcDevice = src;
+    h_inputs[i].srcSize   = h_chunk.size();
+    h_inputs[i].dstDevice = static_cast<uint8_t*>(d_dst.data()) + i * chunk_sz;
+    h_inputs[i].dstSize   = chunk_sz;
+  }
+  rmm::device_uvector<cudf_io::gpu_inflate_input_s> inputs(num_chunks, stream);
+  rmm::device_uvector<cudf_io::gpu_inflate_status_s> outputs(num_chunks, stream);
+  CUDA_TRY(cudaMemcpyAsync(inputs.data(),
+                           h_inputs.data(),
+                           num_chunks * sizeof(cudf_io::gpu_inflate_input_s),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  stream.synchronize();
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (path == decompression_path::HOST) {
+      cudf_io::host_decompress(
+        cudf_io::host_codec::INFLATE, inputs.data(), outputs.data(), num_chunks, stream);
+    } else {
+      CUDA_TRY(cudf_io::gpuinflate(inputs.data(), outputs.data(), num_chunks, 0, stream));
+    }
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+}
+
+BENCHMARK_DEFINE_F(HostDecompression, inflate)
+(::benchmark::State& state) { BM_inflate_chunks(state); }
+BENCHMARK_REGISTER_F(HostDecompression, inflate)
+  ->ArgsProduct({{int32_t(decompression_path::GPU), int32_t(decompression_path::HOST)},
+                 {64 << 10, 1 << 20, 16 << 20, 64 << 20}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
@@ -145,6 +145,34 @@ void BM_orc_read_varying_options(benchmark::State& state)
   state.SetBytesProcessed(data_processed * state.iterations());
 }
 
+void BM_orc_read_compression(benchmark::State& state)
+{
+  auto const compression = static_cast<cudf_io::compression_type>(state.range(0));
+
+  auto const data_types = get_type_or_group({int32_t(type_group_id::INTEGRAL_SIGNED),
+                                             int32_t(type_group_id::FLOATING_POINT),
+                                             int32_t(type_group_id::TIMESTAMP),
+                                             int32_t(cudf::type_id::STRING)});
+  auto const tbl  = create_random_table(data_types, data_types.size(), table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  std::vector<char> orc_data;
+  cudf_io::orc_writer_options const write_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{&orc_data}, view)
+      .compression(compression);
+  cudf_io::write_orc(write_opts);
+
+  cudf_io::orc_reader_options const read_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info{orc_data.data(), orc_data.size()});
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_orc(read_opts);
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+}
+
 #define ORC_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)                               \
   BENCHMARK_DEFINE_F(OrcRead, name)                                                          \
   (::benchmark::State & state) { BM_orc_read_varying_input(state); }                         \
@@ -193,3 +221,13 @@ BENCHMARK_REGISTER_F(OrcRead, misc_options)
                  {int32_t(cudf::type_id::EMPTY), int32_t(cudf::type_id::TIMESTAMP_NANOSECONDS)}})
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+BENCHMARK_DEFINE_F(OrcRead, compression)
+(::benchmark::State& state) { BM_orc_read_compression(state); }
+BENCHMARK_REGISTER_F(OrcRead, compression)
+  ->ArgsProduct({{int32_t(cudf::io::compression_type::NONE),
+                  int32_t(cudf::io::compression_type::SNAPPY),
+                  int32_t(cudf::io::compression_type::ZSTD),
+                  int32_t(cudf::io::compression_type::LZ4)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
@@ -104,7 +104,9 @@ BENCHMARK_DEFINE_F(OrcWrite, writer_options)
 (::benchmark::State& state) { BM_orc_write_varying_options(state); }
 BENCHMARK_REGISTER_F(OrcWrite, writer_options)
   ->ArgsProduct({{int32_t(cudf::io::compression_type::NONE),
-                  int32_t(cudf::io::compression_type::SNAPPY)},
+                  int32_t(cudf::io::compression_type::SNAPPY),
+                  int32_t(cudf::io::compression_type::ZSTD),
+                  int32_t(cudf::io::compression_type::LZ4)},
                  {0, 1}})
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+
+#include <io/parquet/compact_protocol_writer.hpp>
+#include <io/parquet/parquet.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr int num_row_groups  = 10'000;
+constexpr int64_t num_rg_rows = 100'000;
+
+namespace parquet = cudf::io::parquet;
+
+/**
+ * @brief Footer decoding mode used in the benchmark.
+ */
+enum class footer_decoding : int32_t { EAGER, LAZY };
+
+class ParquetFooter : public cudf::benchmark {
+};
+
+/**
+ * @brief Encodes the footer of a synthetic file with `num_row_groups` row groups of INT64 columns.
+ */
+std::vector<uint8_t> make_synthetic_footer(int num_columns)
+{
+  parquet::FileMetaData md;
+  md.version = 1;
+  md.schema.resize(num_columns + 1);
+  md.schema[0].name         = "schema";
+  md.schema[0].num_children = num_columns;
+  for (int col = 0; col < num_columns; ++col) {
+    auto& element           = md.schema[col + 1];
+    element.type            = parquet::INT64;
+    element.repetition_type = parquet::OPTIONAL;
+    element.name            = "column_" + std::to_string(col);
+  }
+
+  int64_t offset = 4;
+  md.row_groups.resize(num_row_groups);
+  for (auto& row_group : md.row_groups) {
+    row_group.num_rows = num_rg_rows;
+    row_group.columns.resize(num_columns);
+    for (int col = 0; col < num_columns; ++col) {
+      auto& chunk                             = row_group.columns[col];
+      chunk.file_offset                       = offset;
+      chunk.meta_data.type                    = parquet::INT64;
+      chunk.meta_data.encodings               = {parquet::Encoding::PLAIN, parquet::Encoding::RLE};
+      chunk.meta_data.path_in_schema          = {md.schema[col + 1].name};
+      chunk.meta_data.codec                   = parquet::SNAPPY;
+      chunk.meta_data.num_values              = num_rg_rows;
+      chunk.meta_data.total_uncompressed_size = num_rg_rows * sizeof(int64_t);
+      chunk.meta_data.total_compressed_size   = num_rg_rows * sizeof(int64_t) / 2;
+      chunk.meta_data.data_page_offset        = offset;
+      // Encoded Statistics struct with min and max values
+      chunk.meta_data.statistics_blob.assign(20, 0);
+      chunk.meta_data.statistics_blob[0]  = 0x58;
+      chunk.meta_data.statistics_blob[1]  = 8;
+      chunk.meta_data.statistics_blob[10] = 0x18;
+      chunk.meta_data.statistics_blob[11] = 8;
+      offset += chunk.meta_data.total_compressed_size;
+      row_group.total_byte_size += chunk.meta_data.total_uncompressed_size;
+    }
+    md.num_rows += num_rg_rows;
+  }
+
+  std::vector<uint8_t> footer;
+  parquet::CompactProtocolWriter cpw(&footer);
+  cpw.write(md);
+  return footer;
+}
+
+void BM_parq_footer_decoding(benchmark::State& state)
+{
+  auto const decoding    = static_cast<footer_decoding>(state.range(0));
+  auto const num_columns = static_cast<int>(state.range(1));
+  // Typical selective read: one row group and two columns
+  auto const selected_row_group = num_row_groups / 2;
+  auto const footer             = make_synthetic_footer(num_columns);
+
+  for (auto _ : state) {
+    parquet::FileMetaData md;
+    parquet::CompactProtocolReader cp(footer.data(), footer.size());
+    if (decoding == footer_decoding::LAZY) {
+      CUDF_EXPECTS(cp.read_lazy(&md), "Cannot parse metadata");
+      CUDF_EXPECTS(cp.InitSchema(&md), "Cannot initialize schema");
+      auto const& row_group = md.row_groups[selected_row_group];
+      for (size_t col = 0; col < 2; ++col) {
+        parquet::ColumnChunk chunk;
+        CUDF_EXPECTS(parquet::CompactProtocolReader::DecodeColumnChunk(md, row_group, col, &chunk),
+                     "Cannot parse column chunk metadata");
+        benchmark::DoNotOptimize(chunk);
+      }
+    } else {
+      CUDF_EXPECTS(cp.read(&md), "Cannot parse metadata");
+      CUDF_EXPECTS(cp.InitSchema(&md), "Cannot initialize schema");
+      benchmark::DoNotOptimize(md.row_groups[selected_row_group].columns[1]);
+    }
+  }
+
+  state.SetBytesProcessed(footer.size() * state.iterations());
+  state.counters["footer_size"] = footer.size();
+}
+
+BENCHMARK_DEFINE_F(ParquetFooter, decoding)
+(::benchmark::State& state) { BM_parq_footer_decoding(state); }
+BENCHMARK_REGISTER_F(ParquetFooter, decoding)
+  ->ArgsProduct({{int32_t(footer_decoding::EAGER), int32_t(footer_decoding::LAZY)}, {4, 32}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
@@ -145,6 +145,34 @@ void BM_parq_read_varying_options(benchmark::State& state)
   state.SetBytesProcessed(data_processed * state.iterations());
 }
 
+void BM_parq_read_compression(benchmark::State& state)
+{
+  auto const compression = static_cast<cudf_io::compression_type>(state.range(0));
+
+  auto const data_types = get_type_or_group({int32_t(type_group_id::INTEGRAL),
+                                             int32_t(type_group_id::FLOATING_POINT),
+                                             int32_t(type_group_id::TIMESTAMP),
+                                             int32_t(cudf::type_id::STRING)});
+  auto const tbl  = create_random_table(data_types, data_types.size(), table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  std::vector<char> parquet_data;
+  cudf_io::parquet_writer_options const write_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&parquet_data}, view)
+      .compression(compression);
+  cudf_io::write_parquet(write_opts);
+
+  cudf_io::parquet_reader_options const read_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{parquet_data.data(), parquet_data.size()});
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet(read_opts);
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+}
+
 #define PARQ_RD_BM_INPUTS_DEFINE(name, type_or_group, src_type)                              \
   BENCHMARK_DEFINE_F(ParquetRead, name)                                                      \
   (::benchmark::State & state) { BM_parq_read_varying_input(state); }                        \
@@ -194,3 +222,13 @@ BENCHMARK_REGISTER_F(ParquetRead, misc_options)
                  {int32_t(cudf::type_id::EMPTY), int32_t(cudf::type_id::TIMESTAMP_NANOSECONDS)}})
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+BENCHMARK_DEFINE_F(ParquetRead, compression)
+(::benchmark::State& state) { BM_parq_read_compression(state); }
+BENCHMARK_REGISTER_F(ParquetRead, compression)
+  ->ArgsProduct({{int32_t(cudf::io::compression_type::NONE),
+                  int32_t(cudf::io::compression_type::SNAPPY),
+                  int32_t(cudf::io::compression_type::ZSTD),
+                  int32_t(cudf::io::compression_type::LZ4)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
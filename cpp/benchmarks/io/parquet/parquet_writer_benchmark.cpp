@@ -89,6 +89,31 @@ void BM_parq_write_varying_options(benchmark::State& state)
   state.SetBytesProcessed(data_size * state.iterations());
 }
 
+void BM_parq_write_file_sink(benchmark::State& state)
+{
+  auto const file_mode   = static_cast<cudf_io::file_sink_mode>(state.range(0));
+  auto const compression = static_cast<cudf_io::compression_type>(state.range(1));
+
+  auto const data_types = get_type_or_group({int32_t(type_group_id::INTEGRAL_SIGNED),
+                                             int32_t(type_group_id::FLOATING_POINT),
+                                             int32_t(type_group_id::TIMESTAMP),
+                                             int32_t(cudf::type_id::STRING)});
+
+  auto const tbl  = create_random_table(data_types, num_cols, table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  cuio_source_sink_pair source_sink(io_type::FILEPATH);
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::parquet_writer_options const options =
+      cudf_io::parquet_writer_options::builder(source_sink.make_sink_info(file_mode), view)
+        .compression(compression);
+    cudf_io::write_parquet(options);
+  }
+
+  state.SetBytesProcessed(data_size * state.iterations());
+}
+
 #define PARQ_WR_BM_INOUTS_DEFINE(name, type_or_group, sink_type)                              \
   BENCHMARK_DEFINE_F(ParquetWrite, name)                                                      \
   (::benchmark::State & state) { BM_parq_write_varying_inout(state); }                        \
@@ -107,10 +132,23 @@ BENCHMARK_DEFINE_F(ParquetWrite, writer_options)
 (::benchmark::State& state) { BM_parq_write_varying_options(state); }
 BENCHMARK_REGISTER_F(ParquetWrite, writer_options)
   ->ArgsProduct({{int32_t(cudf::io::compression_type::NONE),
-                  int32_t(cudf::io::compression_type::SNAPPY)},
+                  int32_t(cudf::io::compression_type::SNAPPY),
+                  int32_t(cudf::io::compression_type::ZSTD),
+                  int32_t(cudf::io::compression_type::LZ4)},
                  {int32_t(cudf::io::statistics_freq::STATISTICS_NONE),
                   int32_t(cudf::io::statistics_freq::STATISTICS_ROWGROUP),
                   int32_t(cudf::io::statistics_freq::STATISTICS_PAGE)},
                  {false, true}})
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+BENCHMARK_DEFINE_F(ParquetWrite, file_sink)
+(::benchmark::State& state) { BM_parq_write_file_sink(state); }
+BENCHMARK_REGISTER_F(ParquetWrite, file_sink)
+  ->ArgsProduct({{int32_t(cudf::io::file_sink_mode::SYNC),
+                  int32_t(cudf::io::file_sink_mode::ASYNC),
+                  int32_t(cudf::io::file_sink_mode::ASYNC_DIRECT)},
+                 {int32_t(cudf::io::compression_type::NONE),
+                  int32_t(cudf::io::compression_type::SNAPPY)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
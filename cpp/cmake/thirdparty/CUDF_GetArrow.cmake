@@ -48,6 +48,9 @@ function(find_and_configure_arrow VERSION BUILD_STATIC)
                         "ARROW_CUDA ON"
                         "ARROW_DATASET ON"
                         "ARROW_WITH_BACKTRACE ON"
+                        "ARROW_WITH_BZ2 ON"
+                        "ARROW_WITH_LZ4 ON"
+                        "ARROW_WITH_ZSTD ON"
                         "ARROW_CXXFLAGS -w"
                         "ARROW_JEMALLOC OFF"
                         # Arrow modifies CMake's GLOBAL RULE_LAUNCH_COMPILE unless this is off
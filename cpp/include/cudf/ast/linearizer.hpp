@@ -57,7 +57,8 @@ class literal : public detail::node {
    * @param value A numeric scalar value.
    */
   template <typename T>
-  literal(cudf::numeric_scalar<T>& value) : value(cudf::get_scalar_device_view(value))
+  literal(cudf::numeric_scalar<T>& value)
+    : scalar(value), value(cudf::get_scalar_device_view(value))
   {
   }
 
@@ -68,7 +69,8 @@ class literal : public detail::node {
    * @param value A timestamp scalar value.
    */
   template <typename T>
-  literal(cudf::timestamp_scalar<T>& value) : value(cudf::get_scalar_device_view(value))
+  literal(cudf::timestamp_scalar<T>& value)
+    : scalar(value), value(cudf::get_scalar_device_view(value))
   {
   }
 
@@ -79,7 +81,8 @@ class literal : public detail::node {
    * @param value A duration scalar value.
    */
   template <typename T>
-  literal(cudf::duration_scalar<T>& value) : value(cudf::get_scalar_device_view(value))
+  literal(cudf::duration_scalar<T>& value)
+    : scalar(value), value(cudf::get_scalar_device_view(value))
   {
   }
 
@@ -90,6 +93,13 @@ class literal : public detail::node {
    */
   cudf::data_type get_data_type() const { return get_value().type(); }
 
+  /**
+   * @brief Get the scalar that holds the value, e.g. to read the value on the host.
+   *
+   * @return cudf::scalar const&
+   */
+  cudf::scalar const& get_scalar() const { return scalar; }
+
  private:
   /**
    * @brief Get the value object.
@@ -106,6 +116,7 @@ class literal : public detail::node {
    */
   cudf::size_type accept(detail::linearizer& visitor) const override;
 
+  const cudf::scalar& scalar;
   const cudf::detail::fixed_width_scalar_device_view_base value;
 };
 
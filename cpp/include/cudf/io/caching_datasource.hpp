@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Counters of the process-wide byte range cache.
+ */
+struct byte_range_cache_statistics {
+  size_t hits        = 0;  ///< Reads served from the cache
+  size_t misses      = 0;  ///< Reads forwarded to the underlying source
+  size_t hit_bytes   = 0;  ///< Bytes served from the cache
+  size_t miss_bytes  = 0;  ///< Bytes read from the underlying sources
+  size_t evictions   = 0;  ///< Entries evicted to stay within the budget
+  size_t cached_size = 0;  ///< Bytes currently held by the cache
+};
+
+/**
+ * @brief Sets the memory budget of the process-wide byte range cache, in bytes.
+ *
+ * The cache is disabled when the budget is zero, which is the default unless the
+ * `LIBCUDF_BYTE_RANGE_CACHE_SIZE` environment variable is set. When enabled, the sources created
+ * from file paths are wrapped in a `caching_datasource`, so that the footers and metadata of files
+ * that are read repeatedly are only read from the file once. Reducing the budget evicts the least
+ * recently used entries.
+ *
+ * @param budget Maximum number of bytes held by the cache
+ */
+void set_byte_range_cache_budget(size_t budget);
+
+/**
+ * @brief Returns the memory budget of the process-wide byte range cache, in bytes.
+ */
+size_t get_byte_range_cache_budget();
+
+/**
+ * @brief Returns the counters of the process-wide byte range cache.
+ */
+byte_range_cache_statistics get_byte_range_cache_statistics();
+
+/**
+ * @brief Removes all entries from the process-wide byte range cache and resets its counters.
+ */
+void clear_byte_range_cache();
+
+/**
+ * @brief Datasource decorator that serves host reads from the process-wide byte range cache.
+ *
+ * Cache entries are keyed by the source key, the source version and size, and the offset and
+ * length of the read, so only reads of exactly the same range are served from the cache. A
+ * modified file gets a new version (its modification time), so stale data is never returned.
+ *
+ * Reads larger than a quarter of the cache budget bypass the cache so that bulk data reads do not
+ * evict the metadata. `host_read_ranges` and device reads are always forwarded to the wrapped
+ * source.
+ */
+class caching_datasource : public datasource {
+ public:
+  /**
+   * @brief Constructs a caching wrapper around a source that reads from a file.
+   *
+   * The file path and its modification time are used as the cache key and version.
+   *
+   * @param source The datasource to read from
+   * @param filepath Path of the file that the source reads from
+   */
+  caching_datasource(std::unique_ptr<datasource> source, std::string const& filepath);
+
+  /**
+   * @brief Constructs a caching wrapper around any source.
+   *
+   * @param source The datasource to read from
+   * @param key Name that uniquely identifies the data of the source
+   * @param version Version of the data; must change whenever the data changes
+   */
+  caching_datasource(std::unique_ptr<datasource> source, std::string key, int64_t version);
+
+  std::unique_ptr<datasource::buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  std::vector<size_t> host_read_ranges(host_span<read_range const> ranges,
+                                       size_t max_gap = default_max_coalesce_gap) override
+  {
+    return _source->host_read_ranges(ranges, max_gap);
+  }
+
+  void hint_reads(host_span<byte_range const> ranges) override { _source->hint_reads(ranges); }
+
+  bool supports_device_read() const override { return _source->supports_device_read(); }
+
+  bool is_device_read_preferred(size_t size) const override
+  {
+    return _source->is_device_read_preferred(size);
+  }
+
+  std::unique_ptr<datasource::buffer> device_read(size_t offset,
+                                                  size_t size,
+                                                  rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, stream);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, dst, stream);
+  }
+
+  size_t size() const override { return _source->size(); }
+
+ private:
+  std::unique_ptr<datasource> const _source;
+  std::string const _key;
+  int64_t const _version;
+};
+
+}  // namespace io
+}  // namespace cudf
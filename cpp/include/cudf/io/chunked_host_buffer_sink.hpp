@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Host memory sink that appends the output into a list of fixed-size chunks.
+ *
+ * Unlike writing to a `std::vector<char>`, the output is never reallocated or moved as it grows:
+ * each write is copied once into the chunks, which are allocated as needed. With pinned chunks,
+ * device writes copy the data from the GPU directly into the chunks, without an intermediate host
+ * buffer.
+ *
+ * The output is exposed as a scatter list of chunks, e.g. to send it over the network without
+ * gathering it into a contiguous buffer. Pass the sink to the writers through
+ * `sink_info{&sink}`.
+ *
+ * Example:
+ * @code
+ * chunked_host_buffer_sink sink(16 << 20, true);
+ * write_parquet(parquet_writer_options::builder(sink_info{&sink}, table));
+ * for (auto const& chunk : sink.chunks()) {
+ *   send(chunk.data(), chunk.size());
+ * }
+ * @endcode
+ */
+class chunked_host_buffer_sink : public data_sink {
+ public:
+  static constexpr size_t default_chunk_size = 16 << 20;  ///< Default size of the chunks
+
+  /**
+   * @brief Constructs an empty sink.
+   *
+   * @param chunk_size Size of each chunk, in bytes
+   * @param pinned Whether to allocate the chunks in pinned host memory
+   */
+  explicit chunked_host_buffer_sink(size_t chunk_size = default_chunk_size, bool pinned = false);
+
+  void host_write(void const* data, size_t size) override;
+
+  bool supports_device_write() const override { return true; }
+
+  /**
+   * @brief Device writes are only preferred with pinned chunks, which the GPU copies into
+   * directly.
+   */
+  bool is_device_write_preferred(size_t) const override { return _pinned; }
+
+  void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override;
+
+  void flush() override {}
+
+  size_t bytes_written() override { return _size; }
+
+  /**
+   * @brief Returns the output as a list of chunks, in order.
+   *
+   * All chunks except the last one are full. The spans remain valid until the sink is cleared or
+   * destroyed.
+   */
+  std::vector<host_span<uint8_t const>> chunks() const;
+
+  /**
+   * @brief Discards the output, keeping the allocated chunks to reuse them for the next writes.
+   */
+  void clear() { _size = 0; }
+
+ private:
+  /**
+   * @brief Calls `copy(dst, src_offset, size)` for each part of a write of `size` bytes, in order,
+   * after allocating the chunks it needs.
+   */
+  template <typename CopyFn>
+  void append(size_t size, CopyFn copy);
+
+  using chunk_ptr = std::unique_ptr<uint8_t, void (*)(uint8_t*)>;
+
+  size_t const _chunk_size;
+  bool const _pinned;
+  std::vector<chunk_ptr> _chunks;
+  size_t _size = 0;
+};
+
+}  // namespace io
+}  // namespace cudf
@@ -29,6 +29,13 @@
 namespace cudf {
 namespace io {
 
+// Forward declaration
+namespace detail {
+namespace csv {
+class chunked_reader;
+}  // namespace csv
+}  // namespace detail
+
 /**
  * @addtogroup io_readers
  * @{
@@ -55,6 +62,10 @@ class csv_reader_options {
   std::size_t _byte_range_offset = 0;
   // Bytes to read; always reads complete rows
   std::size_t _byte_range_size = 0;
+  // Size of the windows in which compressed input is decompressed and parsed; 0 is the whole input
+  std::size_t _decompression_window_size = 0;
+  // Size of the chunks in which the input is copied to the device and scanned for rows
+  std::size_t _staging_chunk_size = 64 * 1024 * 1024;
   // Names of all the columns; if empty then names are auto-generated
   std::vector<std::string> _names;
   // If there is no header or names, prepend this to the column ID as the name
@@ -111,6 +122,12 @@ class csv_reader_options {
 
   // Per-column types; disables type inference on those columns
   std::vector<std::string> _dtypes;
+  // Rows from which the types of the other columns are inferred; 0 is all rows
+  size_type _type_inference_rows = 0;
+  // Number of evenly spaced row ranges among which the inference rows are split
+  size_type _type_inference_ranges = 1;
+  // Names of the string columns to read as dictionary columns
+  std::vector<std::string> _dictionary_columns;
   // Additional values to recognize as boolean true values
   std::vector<std::string> _true_values{"True", "TRUE", "true"};
   // Additional values to recognize as boolean false values
@@ -171,6 +188,16 @@ class csv_reader_options {
    */
   std::size_t get_byte_range_size() const { return _byte_range_size; }
 
+  /**
+   * @brief Returns the size of the windows in which compressed input is decompressed and parsed.
+   */
+  std::size_t get_decompression_window_size() const { return _decompression_window_size; }
+
+  /**
+   * @brief Returns the size of the chunks in which the input is copied to the device.
+   */
+  std::size_t get_staging_chunk_size() const { return _staging_chunk_size; }
+
   /**
    * @brief Returns names of the columns.
    */
@@ -291,6 +318,21 @@ class csv_reader_options {
    */
   std::vector<std::string> const& get_dtypes() const { return _dtypes; }
 
+  /**
+   * @brief Returns the number of rows from which the column types are inferred; 0 is all rows.
+   */
+  size_type get_type_inference_rows() const { return _type_inference_rows; }
+
+  /**
+   * @brief Returns the number of row ranges among which the type inference rows are split.
+   */
+  size_type get_type_inference_ranges() const { return _type_inference_ranges; }
+
+  /**
+   * @brief Returns names of the string columns to read as dictionary columns.
+   */
+  std::vector<std::string> const& get_dictionary_columns() const { return _dictionary_columns; }
+
   /**
    * @brief Returns additional values to recognize as boolean true values.
    */
@@ -363,6 +405,34 @@ class csv_reader_options {
     _byte_range_size = size;
   }
 
+  /**
+   * @brief Sets the size of the windows in which compressed input is decompressed and parsed.
+   *
+   * With a non-zero size, gzip and bzip2 input is decompressed one window at a time and each
+   * window is parsed before the next one is decompressed, so the host memory used for the
+   * decompressed data is bounded by the window size and the longest row. Column types that are
+   * not specified are inferred from the first window. Not used with `skipfooter`.
+   *
+   * @param size Number of decompressed bytes per window; 0 decompresses the whole input at once.
+   */
+  void set_decompression_window_size(std::size_t size) { _decompression_window_size = size; }
+
+  /**
+   * @brief Sets the size of the chunks in which the input is copied to the device.
+   *
+   * The input is scanned for row boundaries one chunk at a time. Larger inputs are copied through
+   * pinned staging buffers, so that the next chunks are copied while the current one is scanned.
+   *
+   * @throw cudf::logic_error if the size is zero
+   *
+   * @param size Number of bytes per chunk; must be positive.
+   */
+  void set_staging_chunk_size(std::size_t size)
+  {
+    CUDF_EXPECTS(size > 0, "The staging chunk size must be positive");
+    _staging_chunk_size = size;
+  }
+
   /**
    * @brief Sets names of the column.
    *
@@ -565,6 +635,42 @@ class csv_reader_options {
    */
   void set_dtypes(std::vector<std::string> types) { _dtypes = std::move(types); }
 
+  /**
+   * @brief Sets the sample of rows from which the types of columns without a dtype are inferred.
+   *
+   * Instead of a separate pass over all rows, the types are inferred from `num_rows` rows split
+   * among `num_ranges` ranges spread evenly over the data, such as the first rows with a single
+   * range. The remaining rows are checked against the inferred types while they are decoded, and
+   * only the columns that have values of a wider type outside the sample are decoded again. The
+   * resulting types are the same as those inferred from all rows.
+   *
+   * @throw cudf::logic_error if `num_rows` is negative or `num_ranges` is not positive
+   *
+   * @param num_rows Number of rows in the sample; 0 infers the types from all rows
+   * @param num_ranges Number of ranges of consecutive rows in the sample
+   */
+  void set_type_inference_sample(size_type num_rows, size_type num_ranges = 1)
+  {
+    CUDF_EXPECTS(num_rows >= 0, "The number of type inference rows cannot be negative");
+    CUDF_EXPECTS(num_ranges > 0, "The number of type inference ranges must be positive");
+    _type_inference_rows   = num_rows;
+    _type_inference_ranges = num_ranges;
+  }
+
+  /**
+   * @brief Sets names of the string columns to read as dictionary columns.
+   *
+   * The listed columns whose type is `STRING` are read as `DICTIONARY32` columns with sorted keys.
+   * The keys are built from the distinct values while the column is decoded, without creating a
+   * strings column of all rows. Columns of other types are not affected.
+   *
+   * @param col_names Vector of column names.
+   */
+  void set_dictionary_columns(std::vector<std::string> col_names)
+  {
+    _dictionary_columns = std::move(col_names);
+  }
+
   /**
    * @brief Sets additional values to recognize as boolean true values.
    *
@@ -686,6 +792,30 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the size of the windows in which compressed input is decompressed and parsed.
+   *
+   * @param size Number of decompressed bytes per window; 0 decompresses the whole input at once.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& decompression_window_size(std::size_t size)
+  {
+    options.set_decompression_window_size(size);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the size of the chunks in which the input is copied to the device.
+   *
+   * @param size Number of bytes per chunk; must be positive.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& staging_chunk_size(std::size_t size)
+  {
+    options.set_staging_chunk_size(size);
+    return *this;
+  }
+
   /**
    * @brief Sets names of the column.
    *
@@ -974,6 +1104,31 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the sample of rows from which the types of columns without a dtype are inferred.
+   *
+   * @param num_rows Number of rows in the sample; 0 infers the types from all rows
+   * @param num_ranges Number of ranges of consecutive rows in the sample
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& type_inference_sample(size_type num_rows, size_type num_ranges = 1)
+  {
+    options.set_type_inference_sample(num_rows, num_ranges);
+    return *this;
+  }
+
+  /**
+   * @brief Sets names of the string columns to read as dictionary columns.
+   *
+   * @param col_names Vector of column names.
+   * @return this for chaining.
+   */
+  csv_reader_options_builder& dictionary_columns(std::vector<std::string> col_names)
+  {
+    options._dictionary_columns = std::move(col_names);
+    return *this;
+  }
+
   /**
    * @brief Sets additional values to recognize as boolean true values.
    *
@@ -1074,6 +1229,11 @@ class csv_reader_options_builder {
 /**
  * @brief Reads a CSV dataset into a set of columns.
  *
+ * Several sources are read as a single dataset, whose rows are the rows of the sources in order.
+ * The header rows are removed from every source, and the column names are taken from the header
+ * of the first source. The sources must not be read with `byte_range`, `skiprows` or
+ * `skipfooter`, and `nrows` applies to the whole dataset.
+ *
  * The following code snippet demonstrates how to read a dataset from a file:
  * @code
  *  std::string filepath = "dataset.csv";
@@ -1093,6 +1253,82 @@ table_with_metadata read_csv(
   csv_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Chunked CSV reader class to read a dataset in chunks of bounded input size.
+ *
+ * The source is opened once and read in order, so the header is parsed, the columns are selected
+ * and the column types are determined from the first chunk only; all chunks have the same columns
+ * and types. Types that are not specified are inferred from the first chunk and are not promoted
+ * for the values of the following chunks.
+ *
+ * Each chunk reads `chunk_read_limit` more bytes of the uncompressed input. The last row of a chunk
+ * may be incomplete, so it is carried over to the next chunk, and a chunk is extended until it
+ * holds a complete row; rows that span several chunks, such as quoted fields with line breaks, are
+ * therefore read whole. Concatenating the chunks gives the table returned by `read_csv()` with the
+ * same options, when the first chunk is representative of the column types. The last chunk may
+ * have no rows.
+ *
+ * Compressed input is decompressed one chunk at a time when the compression format allows it.
+ * The `byte_range` and `skipfooter` options are only supported when the data is read in one
+ * chunk.
+ *
+ * The following code snippet reads a file in chunks of about 256MB of text:
+ * @code
+ *  auto const options =
+ *    cudf::io::csv_reader_options::builder(cudf::io::source_info("dataset.csv")).build();
+ *  cudf::io::csv_chunked_reader reader(256 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class csv_chunked_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  csv_chunked_reader() = default;
+
+  /**
+   * @brief Constructor with a chunk size limit and reader options
+   *
+   * @throw cudf::logic_error if the data is compressed in a format that cannot be decompressed
+   * incrementally
+   *
+   * @param[in] chunk_read_limit Number of bytes of uncompressed input data to read for each
+   * chunk; 0 to read all the data in one chunk
+   * @param[in] options Settings for controlling reading behavior
+   * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+   */
+  csv_chunked_reader(std::size_t chunk_read_limit,
+                     csv_reader_options const& options,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~csv_chunked_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   *
+   * At least one chunk is returned, even when the input is empty.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @return The set of columns of the chunk along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
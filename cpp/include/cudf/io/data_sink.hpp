@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/io/types.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -36,9 +37,17 @@ class data_sink {
   /**
    * @brief Create a sink from a file path
    *
+   * With the asynchronous modes, host writes are copied into a ring of aligned buffers that are
+   * written to the file on the I/O thread pool, and `flush()` waits for all pending writes. Device
+   * writes through cuFile are only used with the synchronous mode. Write errors are reported by
+   * `flush()`, which the writers call when they close; errors still pending when the sink is
+   * destroyed are logged to stderr.
+   *
    * @param[in] filepath Path to the file to use
+   * @param[in] mode How data is written to the file
    */
-  static std::unique_ptr<data_sink> create(const std::string& filepath);
+  static std::unique_ptr<data_sink> create(const std::string& filepath,
+                                           file_sink_mode mode = file_sink_mode::SYNC);
 
   /**
    * @brief Create a sink from a std::vector
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_readers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief File format of the files of a dataset.
+ */
+enum class dataset_format {
+  PARQUET,  ///< Apache Parquet files
+  ORC,      ///< Apache ORC files
+};
+
+/**
+ * @brief Value of a partition key that denotes a null value.
+ */
+constexpr char const* hive_null_partition_value = "__HIVE_DEFAULT_PARTITION__";
+
+/**
+ * @brief Values of the partition keys of a partition, by key name.
+ *
+ * The values are unescaped; null values are kept as `hive_null_partition_value`.
+ */
+using partition_values = std::map<std::string, std::string>;
+
+/**
+ * @brief Predicate that selects the partitions to read from their key values.
+ *
+ * The predicate is called once per directory level, on a partial key set: the values of the keys
+ * parsed from the root down to that directory only. A key it tests may therefore be missing, and
+ * the predicate must select such values, e.g. `values.count(key) == 0 || values.at(key) == ...`.
+ */
+using partition_filter = std::function<bool(partition_values const&)>;
+
+/**
+ * @brief Directory of a hive-partitioned dataset that holds data files.
+ */
+struct hive_partition {
+  partition_values values;         ///< Values of the partition keys, parsed from the path
+  std::vector<std::string> files;  ///< Paths of the data files, in lexicographic order
+};
+
+/**
+ * @brief Layout of a hive-partitioned dataset.
+ */
+struct hive_dataset {
+  std::vector<std::string> partition_keys;  ///< Names of the partition keys, in directory order
+  std::vector<hive_partition> partitions;   ///< Partitions, in lexicographic order of their paths
+};
+
+/**
+ * @brief Lists the partitions of a hive-partitioned dataset.
+ *
+ * The dataset is a tree of `<key>=<value>` directories, whose leaf directories hold the data files,
+ * such as `root/date=2021-01-01/region=EU/part-0.parquet`. Percent-encoded characters of the keys
+ * and values are decoded. Files and directories whose name starts with `.` or `_` are ignored.
+ *
+ * The filter is evaluated as soon as the key of each directory is parsed, so the directories and
+ * files of pruned partitions are never listed nor opened. Partitions that hold data files must all
+ * have the same keys; pruned partitions are not checked.
+ *
+ * @throw cudf::logic_error if the partitions do not all have the same keys
+ *
+ * @param root Path of the root directory of the dataset
+ * @param filter Predicate that selects the partitions to list; all partitions if empty
+ *
+ * @return The partition keys and the selected partitions
+ */
+hive_dataset discover_hive_partitions(std::string const& root,
+                                      partition_filter const& filter = {});
+
+/**
+ * @brief Builds settings to use for `read_dataset()`.
+ */
+class dataset_reader_options_builder;
+
+/**
+ * @brief Settings to use for `read_dataset()`.
+ */
+class dataset_reader_options {
+  std::string _root;
+  dataset_format _format = dataset_format::PARQUET;
+
+  // Names of the file columns to read; empty is all
+  std::vector<std::string> _columns;
+
+  // Predicate that selects the partitions to read; empty is all
+  partition_filter _partition_filter;
+
+  friend dataset_reader_options_builder;
+
+  /**
+   * @brief Constructor from the root directory and file format.
+   *
+   * @param root Path of the root directory of the dataset
+   * @param format Format of the data files
+   */
+  explicit dataset_reader_options(std::string root, dataset_format format)
+    : _root(std::move(root)), _format(format)
+  {
+  }
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  dataset_reader_options() = default;
+
+  /**
+   * @brief Creates `dataset_reader_options_builder` which will build `dataset_reader_options`.
+   *
+   * @param root Path of the root directory of the dataset
+   * @param format Format of the data files
+   * @return Builder to build reader options.
+   */
+  static dataset_reader_options_builder builder(std::string root, dataset_format format);
+
+  /**
+   * @brief Returns the path of the root directory of the dataset.
+   */
+  std::string const& get_root() const { return _root; }
+
+  /**
+   * @brief Returns the format of the data files.
+   */
+  dataset_format get_format() const { return _format; }
+
+  /**
+   * @brief Returns names of the file columns to read.
+   */
+  std::vector<std::string> const& get_columns() const { return _columns; }
+
+  /**
+   * @brief Returns the predicate that selects the partitions to read.
+   */
+  partition_filter const& get_partition_filter() const { return _partition_filter; }
+
+  /**
+   * @brief Sets names of the file columns to read; the partition columns are always read.
+   *
+   * @param col_names Vector of column names.
+   */
+  void set_columns(std::vector<std::string> col_names) { _columns = std::move(col_names); }
+
+  /**
+   * @brief Sets the predicate that selects the partitions to read.
+   *
+   * The predicate is called once per directory level, on the keys parsed down to that level only.
+   *
+   * @param filter Predicate on the values of the partition keys; empty to read all partitions
+   */
+  void set_partition_filter(partition_filter filter) { _partition_filter = std::move(filter); }
+};
+
+class dataset_reader_options_builder {
+  dataset_reader_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit dataset_reader_options_builder() = default;
+
+  /**
+   * @brief Constructor from the root directory and file format.
+   *
+   * @param root Path of the root directory of the dataset
+   * @param format Format of the data files
+   */
+  explicit dataset_reader_options_builder(std::string root, dataset_format format)
+    : options{std::move(root), format}
+  {
+  }
+
+  /**
+   * @brief Sets names of the file columns to read.
+   *
+   * @param col_names Vector of column names.
+   * @return this for chaining.
+   */
+  dataset_reader_options_builder& columns(std::vector<std::string> col_names)
+  {
+    options.set_columns(std::move(col_names));
+    return *this;
+  }
+
+  /**
+   * @brief Sets the predicate that selects the partitions to read.
+   *
+   * @param filter Predicate on the values of the partition keys
+   * @return this for chaining.
+   */
+  dataset_reader_options_builder& partition_filter(cudf::io::partition_filter filter)
+  {
+    options.set_partition_filter(std::move(filter));
+    return *this;
+  }
+
+  /**
+   * @brief move dataset_reader_options member once it's built.
+   */
+  operator dataset_reader_options &&() { return std::move(options); }
+
+  /**
+   * @brief move dataset_reader_options member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   */
+  dataset_reader_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Reads a hive-partitioned Parquet or ORC dataset into a set of columns.
+ *
+ * Partitions are pruned by the filter before any file is opened. The footers of the selected files
+ * are parsed concurrently, and the Parquet files are decoded in a single batch, directly into the
+ * output columns. A `DICTIONARY32` column of strings is appended to the file columns for each
+ * partition key, in directory order, and named after the key. The dictionary keys are the distinct
+ * values of the selected partitions, and the rows of a null partition value are null.
+ *
+ * The following code snippet demonstrates how to read the European partitions of a dataset:
+ * @code
+ *  auto const options =
+ *    cudf::io::dataset_reader_options::builder("dataset", cudf::io::dataset_format::PARQUET)
+ *      .partition_filter([](auto const& values) {
+ *        return values.count("region") == 0 || values.at("region") == "EU";
+ *      })
+ *      .build();
+ *  auto result = cudf::io::read_dataset(options);
+ * @endcode
+ *
+ * @param options Settings for controlling reading behavior
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return The file columns followed by the partition columns; no columns if no file is selected
+ */
+table_with_metadata read_dataset(
+  dataset_reader_options const& options,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
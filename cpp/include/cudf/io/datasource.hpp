@@ -18,6 +18,7 @@
 
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -27,6 +28,7 @@
 #include <arrow/io/memory.h>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 //! IO interfaces
@@ -34,6 +36,12 @@ namespace io {
 
 /**
  * @brief Interface class for providing input data to the readers.
+ *
+ * All `datasource` implementations created by the `create` factory functions from file paths,
+ * host buffers and Arrow files are safe to read from multiple threads concurrently; reads never
+ * depend on, or modify, state shared between calls. Sources that wrap a user-implemented object
+ * are only as thread-safe as the wrapped object. Readers may issue concurrent reads from a single
+ * source (e.g. through `host_read_ranges`).
  */
 class datasource {
  public:
@@ -63,6 +71,29 @@ class datasource {
     static std::unique_ptr<buffer> create(Container&& data_owner);
   };
 
+  /**
+   * @brief Byte range to read from the source into existing host memory.
+   */
+  struct read_range {
+    size_t offset;  ///< Bytes from the start of the source
+    size_t size;    ///< Bytes to read
+    uint8_t* dst;   ///< Address of the existing host memory
+  };
+
+  /**
+   * @brief Byte range in the source.
+   */
+  struct byte_range {
+    size_t offset;  ///< Bytes from the start of the source
+    size_t size;    ///< Number of bytes in the range
+  };
+
+  /**
+   * @brief Default maximum number of unrequested bytes between two ranges that are merged into a
+   * single read by `host_read_ranges`.
+   */
+  static constexpr size_t default_max_coalesce_gap = 64 << 10;
+
   /**
    * @brief Creates a source from a file path.
    *
@@ -96,6 +127,16 @@ class datasource {
    */
   static std::unique_ptr<datasource> create(datasource* source);
 
+  /**
+   * @brief Creates a vector of datasources, one per file.
+   *
+   * The files are opened concurrently, which hides the per-file latency when reading datasets
+   * made of many files.
+   *
+   * @param[in] filepaths Paths to the files to use
+   */
+  static std::vector<std::unique_ptr<datasource>> create(std::vector<std::string> const& filepaths);
+
   /**
    * @brief Creates a vector of datasources, one per element in the input vector.
    *
@@ -138,6 +179,32 @@ class datasource {
    */
   virtual size_t host_read(size_t offset, size_t size, uint8_t* dst) = 0;
 
+  /**
+   * @brief Reads a set of selected ranges into preallocated buffers.
+   *
+   * Ranges that are adjacent, or separated by no more than `max_gap` bytes, are merged and read
+   * with a single call; the bytes in the gaps are read and discarded. The default implementation
+   * services the merged ranges with `host_read` calls on the calling thread. Built-in file sources
+   * override it to issue the merged reads concurrently.
+   *
+   * @param[in] ranges Ranges to read, in any order; ranges must not overlap
+   * @param[in] max_gap Maximum number of unrequested bytes between two ranges read as one
+   *
+   * @return The number of bytes read for each range (can be smaller than the range size)
+   */
+  virtual std::vector<size_t> host_read_ranges(host_span<read_range const> ranges,
+                                               size_t max_gap = default_max_coalesce_gap);
+
+  /**
+   * @brief Hints the ranges that are going to be read, in the order in which they will be read.
+   *
+   * Readers call this function with their planned host reads before issuing them. Sources can use
+   * the hint to read the data ahead of time. The default implementation ignores the hint.
+   *
+   * @param[in] ranges Planned ranges, in read order
+   */
+  virtual void hint_reads(host_span<byte_range const> ranges) {}
+
   /**
    * @brief Whether or not this source supports reading directly into device memory.
    *
@@ -70,6 +70,67 @@ class reader {
   table_with_metadata read(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read CSV dataset data in chunks of bounded input size.
+ */
+class chunked_reader {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor from an array of file paths
+   *
+   * The file is opened in the constructor and read in order, one chunk at a time.
+   *
+   * @param chunk_read_limit Number of bytes of uncompressed input data to read for each chunk;
+   * 0 to read all the data in one chunk
+   * @param filepaths Paths to the files containing the input dataset
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::string> const &filepaths,
+    csv_reader_options const &options,
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * @param chunk_read_limit Number of bytes of uncompressed input data to read for each chunk;
+   * 0 to read all the data in one chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+    csv_reader_options const &options,
+    rmm::mr::device_memory_resource *mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns of the chunk along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
 class writer {
  public:
   class impl;
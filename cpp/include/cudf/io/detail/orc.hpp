@@ -44,12 +44,17 @@ namespace orc {
 class reader {
  private:
   class impl;
-  std::unique_ptr<impl> _impl;
+  std::vector<std::unique_ptr<impl>> _impls;  // One per source
+
+  friend class chunked_reader;
 
  public:
   /**
    * @brief Constructor from an array of file paths
    *
+   * The files are opened and their footers are parsed concurrently. All files must have the same
+   * schema.
+   *
    * @param filepaths Paths to the files containing the input dataset
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
@@ -61,6 +66,8 @@ class reader {
   /**
    * @brief Constructor from an array of datasources
    *
+   * The footers of the sources are parsed concurrently. All sources must have the same schema.
+   *
    * @param sources Input `datasource` objects to read the dataset from
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
@@ -77,6 +84,8 @@ class reader {
   /**
    * @brief Reads the entire dataset.
    *
+   * The rows of multiple sources are returned in source order, as a single table.
+   *
    * @param options Settings for controlling reading behavior
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
@@ -86,6 +95,55 @@ class reader {
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
+/**
+ * @brief Class to read ORC dataset data in chunks of bounded size.
+ */
+class chunked_reader {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * The footer is parsed and the chunks are planned in the constructor; each chunk is read when
+   * it is requested.
+   *
+   * @param chunk_read_limit Limit on the estimated size of the columns of each chunk, in bytes;
+   * 0 to read all the selected rows in one chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource(),
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default);
+
+  /**
+   * @brief Destructor explicitly declared to avoid inlining in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns of the chunk along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+};
+
 /**
  * @brief Class to write ORC dataset data into columns.
  */
@@ -37,6 +37,11 @@ class parquet_reader_options;
 class parquet_writer_options;
 class chunked_parquet_writer_options;
 
+namespace parquet {
+// forward declare the parsed Parquet footers; the definition is internal to libcudf
+struct parsed_metadata;
+}  // namespace parquet
+
 namespace detail {
 namespace parquet {
 
@@ -48,6 +53,8 @@ class reader {
   class impl;
   std::unique_ptr<impl> _impl;
 
+  friend class chunked_reader;
+
  public:
   /**
    * @brief Constructor from an array of file paths
@@ -86,6 +93,65 @@ class reader {
    */
   table_with_metadata read(parquet_reader_options const& options,
                            rmm::cuda_stream_view stream = rmm::cuda_stream_default);
+
+  /**
+   * @brief Reads and parses the footers of the sources.
+   *
+   * @param sources Input `datasource` objects to read the footers from
+   *
+   * @return The parsed footers, reusable by readers of the same sources
+   */
+  static std::shared_ptr<cudf::io::parquet::parsed_metadata const> parse_metadata(
+    std::vector<std::unique_ptr<cudf::io::datasource>> const& sources);
+};
+
+/**
+ * @brief Class to read Parquet dataset data in chunks of bounded size.
+ */
+class chunked_reader {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor from an array of datasources
+   *
+   * The footers are parsed and the chunks are planned in the constructor; each chunk is read
+   * when it is requested.
+   *
+   * @param chunk_read_limit Limit on the estimated size of the columns of each chunk, in bytes;
+   * 0 to read all the selected rows in one chunk
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  explicit chunked_reader(
+    std::size_t chunk_read_limit,
+    std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource(),
+    rmm::cuda_stream_view stream        = rmm::cuda_stream_default);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns of the chunk along with table metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 };
 
 /**
@@ -81,6 +81,9 @@ class json_reader_options {
   // Whether to parse dates as DD/MM versus MM/DD
   bool _dayfirst = false;
 
+  // Names of the string columns to read as dictionary columns
+  std::vector<std::string> _dictionary_columns;
+
   /**
    * @brief Constructor from source info.
    *
@@ -141,6 +144,11 @@ class json_reader_options {
    */
   bool is_enabled_dayfirst() const { return _dayfirst; }
 
+  /**
+   * @brief Returns names of the string columns to read as dictionary columns.
+   */
+  std::vector<std::string> const& get_dictionary_columns() const { return _dictionary_columns; }
+
   /**
    * @brief Set data types for columns to be read.
    *
@@ -182,6 +190,20 @@ class json_reader_options {
    * @param val Boolean value to enable/disable day first parsing format.
    */
   void enable_dayfirst(bool val) { _dayfirst = val; }
+
+  /**
+   * @brief Set names of the string columns to read as dictionary columns.
+   *
+   * The listed columns whose type is `STRING` are read as `DICTIONARY32` columns with sorted keys.
+   * The keys are built from the distinct values while the column is decoded, without creating a
+   * strings column of all rows. Columns of other types are not affected.
+   *
+   * @param col_names Vector of column names.
+   */
+  void set_dictionary_columns(std::vector<std::string> col_names)
+  {
+    _dictionary_columns = std::move(col_names);
+  }
 };
 
 class json_reader_options_builder {
@@ -274,6 +296,18 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Set names of the string columns to read as dictionary columns.
+   *
+   * @param col_names Vector of column names.
+   * @return this for chaining.
+   */
+  json_reader_options_builder& dictionary_columns(std::vector<std::string> col_names)
+  {
+    options._dictionary_columns = std::move(col_names);
+    return *this;
+  }
+
   /**
    * @brief move json_reader_options member once it's built.
    */
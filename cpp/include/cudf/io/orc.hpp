@@ -21,12 +21,19 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <thrust/optional.h>
+
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 namespace cudf {
+namespace ast {
+class expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -34,6 +41,19 @@ namespace io {
  * @file
  */
 
+namespace orc {
+// forward declare the parsed ORC footer; its definition is internal to libcudf
+struct parsed_footer;
+}  // namespace orc
+
+/**
+ * @brief Handle to the parsed footer of an ORC source, returned by `parse_orc_metadata()`.
+ *
+ * The handle can be passed to any number of `read_orc()` calls on the same source to skip reading
+ * and parsing the footer. It is immutable and can be shared between threads.
+ */
+using orc_metadata_handle = std::shared_ptr<orc::parsed_footer const>;
+
 /**
  * @brief Builds settings to use for `read_orc()`.
  */
@@ -69,6 +89,14 @@ class orc_reader_options {
   // -1 is auto (column scale), >=0: number of fractional digits
   size_type _forced_decimals_scale = -1;
 
+  // Previously parsed footer of the source; parsed by the reader if null
+  orc_metadata_handle _metadata_handle;
+  // Previously parsed footers of each source; used instead of `_metadata_handle` if not empty
+  std::vector<orc_metadata_handle> _metadata_handles;
+
+  // Filter used to skip stripes using their statistics; null is none
+  ast::expression const* _filter = nullptr;
+
   friend orc_reader_options_builder;
 
   /**
@@ -144,6 +172,24 @@ class orc_reader_options {
    */
   size_type get_forced_decimals_scale() const { return _forced_decimals_scale; }
 
+  /**
+   * @brief Returns the previously parsed footer of the source, if any.
+   */
+  orc_metadata_handle const& get_metadata_handle() const { return _metadata_handle; }
+
+  /**
+   * @brief Returns the previously parsed footers of each source, if any.
+   */
+  std::vector<orc_metadata_handle> const& get_metadata_handles() const
+  {
+    return _metadata_handles;
+  }
+
+  /**
+   * @brief Returns the filter used to skip stripes, or null if none.
+   */
+  ast::expression const* get_filter() const { return _filter; }
+
   // Setters
 
   /**
@@ -173,6 +219,7 @@ class orc_reader_options {
   void set_skip_rows(size_type rows)
   {
     CUDF_EXPECTS(rows == 0 or _stripes.empty(), "Can't set both skip_rows along with stripes");
+    CUDF_EXPECTS(rows == 0 or _filter == nullptr, "Can't set both skip_rows along with filter");
     _skip_rows = rows;
   }
 
@@ -184,6 +231,7 @@ class orc_reader_options {
   void set_num_rows(size_type nrows)
   {
     CUDF_EXPECTS(nrows == -1 or _stripes.empty(), "Can't set both num_rows along with stripes");
+    CUDF_EXPECTS(nrows == -1 or _filter == nullptr, "Can't set both num_rows along with filter");
     _num_rows = nrows;
   }
 
@@ -221,6 +269,41 @@ class orc_reader_options {
    * @param val Length of fractional digits.
    */
   void set_forced_decimals_scale(size_type val) { _forced_decimals_scale = val; }
+
+  /**
+   * @brief Sets the previously parsed footer of the source, to avoid parsing it again.
+   *
+   * @param handle Handle returned by `parse_orc_metadata()` for the same source.
+   */
+  void set_metadata_handle(orc_metadata_handle handle) { _metadata_handle = std::move(handle); }
+
+  /**
+   * @brief Sets the previously parsed footers of multiple sources, to avoid parsing them again.
+   *
+   * @param handles Handles returned by `parse_orc_metadata()` for each source, in source order.
+   */
+  void set_metadata_handles(std::vector<orc_metadata_handle> handles)
+  {
+    _metadata_handles = std::move(handles);
+  }
+
+  /**
+   * @brief Sets the filter used to skip stripes using their column statistics.
+   *
+   * Stripes whose statistics show that none of their rows pass the filter are not read; the rows
+   * of the other stripes are returned unfiltered. The column references of the filter are indices
+   * of the top-level columns in the file. Only comparisons between a column and a literal,
+   * combined with `LOGICAL_AND`, `LOGICAL_OR` and `NOT`, are used to skip stripes. When stripes
+   * are also specified, only those are considered. The expression must outlive the reads.
+   *
+   * @param filter Boolean filter expression; null disables the filtering
+   */
+  void set_filter(ast::expression const* filter)
+  {
+    CUDF_EXPECTS(filter == nullptr or (_skip_rows == 0), "Can't set filter along with skip_rows");
+    CUDF_EXPECTS(filter == nullptr or (_num_rows == -1), "Can't set filter along with num_rows");
+    _filter = filter;
+  }
 };
 
 class orc_reader_options_builder {
@@ -349,6 +432,42 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the previously parsed footer of the source, to avoid parsing it again.
+   *
+   * @param handle Handle returned by `parse_orc_metadata()` for the same source.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& metadata_handle(orc_metadata_handle handle)
+  {
+    options._metadata_handle = std::move(handle);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the previously parsed footers of multiple sources, to avoid parsing them again.
+   *
+   * @param handles Handles returned by `parse_orc_metadata()` for each source, in source order.
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& metadata_handles(std::vector<orc_metadata_handle> handles)
+  {
+    options._metadata_handles = std::move(handles);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the filter used to skip stripes using their column statistics.
+   *
+   * @param filter Boolean filter expression; see `orc_reader_options::set_filter()`
+   * @return this for chaining.
+   */
+  orc_reader_options_builder& filter(ast::expression const* filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -385,6 +504,89 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads and parses the footer of an ORC source.
+ *
+ * The returned handle can be set in the options of subsequent `read_orc()` calls on the same
+ * source, so that only the stripe data is read in each call:
+ * @code
+ *  auto const source = cudf::io::source_info("dataset.orc");
+ *  auto const handle = cudf::io::parse_orc_metadata(source);
+ *  for (cudf::size_type stripe = 0; stripe < num_stripes; ++stripe) {
+ *    auto options = cudf::io::orc_reader_options::builder(source)
+ *                     .stripes({stripe})
+ *                     .metadata_handle(handle)
+ *                     .build();
+ *    auto result = cudf::io::read_orc(options);
+ *  }
+ * @endcode
+ *
+ * @param src_info Dataset source
+ *
+ * @return Handle to the parsed footer
+ */
+orc_metadata_handle parse_orc_metadata(source_info const& src_info);
+
+/**
+ * @brief Chunked ORC reader class to read a dataset in chunks of bounded size.
+ *
+ * Each chunk is made of consecutive stripes, which are read and decompressed together.
+ * Concatenating the chunks gives the table returned by `read_orc()` with the same options. The
+ * footer and the timezone conversion table are built once and shared by all the chunks.
+ *
+ * The size of each chunk is estimated from the column types and statistics before any stripe is
+ * read, so the actual size of a chunk may exceed the limit. Stripes are never split: a stripe
+ * larger than the limit is read as one chunk.
+ *
+ * The following code snippet reads a file in chunks of about 1GB:
+ * @code
+ *  auto const options =
+ *    cudf::io::orc_reader_options::builder(cudf::io::source_info("dataset.orc")).build();
+ *  cudf::io::orc_chunked_reader reader(1024 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class orc_chunked_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  orc_chunked_reader() = default;
+
+  /**
+   * @brief Constructor with a chunk size limit and reader options
+   *
+   * @param[in] chunk_read_limit Limit on the estimated size of the columns of each chunk, in
+   * bytes; 0 to read all the selected rows in one chunk
+   * @param[in] options Settings for controlling reading behavior
+   * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+   */
+  orc_chunked_reader(std::size_t chunk_read_limit,
+                     orc_reader_options const& options,
+                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   *
+   * At least one chunk is returned, even when no rows are selected.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @return The set of columns of the chunk along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -392,6 +594,17 @@ table_with_metadata read_orc(
  * @file
  */
 
+/**
+ * @brief Compression settings of a single column written by the ORC writers.
+ *
+ * All compressed streams of an ORC file use the codec of the file, so a column can only be written
+ * with that codec or uncompressed.
+ */
+struct orc_column_compression {
+  bool compressed             = true;  //!< Whether the data streams of the column are compressed
+  thrust::optional<int> level = {};    //!< Compression level; only valid with the ZSTD codec
+};
+
 /**
  * @brief Builds settings to use for `write_orc()`.
  */
@@ -411,6 +624,10 @@ class orc_writer_options {
   table_view _table;
   // Optional associated metadata
   const table_metadata* _metadata = nullptr;
+  // Per-column compression settings, indexed by column
+  std::map<size_type, orc_column_compression> _column_compression;
+  // Optional output for the per-column compression statistics
+  std::vector<column_compression_statistics>* _compression_stats = nullptr;
 
   friend orc_writer_options_builder;
 
@@ -468,6 +685,22 @@ class orc_writer_options {
    */
   table_metadata const* get_metadata() const { return _metadata; }
 
+  /**
+   * @brief Returns the per-column compression settings, indexed by column.
+   */
+  std::map<size_type, orc_column_compression> const& get_column_compression() const
+  {
+    return _column_compression;
+  }
+
+  /**
+   * @brief Returns the output for the per-column compression statistics.
+   */
+  std::vector<column_compression_statistics>* get_compression_statistics() const
+  {
+    return _compression_stats;
+  }
+
   // Setters
 
   /**
@@ -497,6 +730,29 @@ class orc_writer_options {
    * @param meta Associated metadata.
    */
   void set_metadata(table_metadata* meta) { _metadata = meta; }
+
+  /**
+   * @brief Sets the compression settings of a column, overriding the defaults of the file.
+   *
+   * @param column Index of the column
+   * @param settings Compression settings of the column
+   */
+  void set_column_compression(size_type column, orc_column_compression settings)
+  {
+    _column_compression[column] = settings;
+  }
+
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * When the writer closes, it replaces the contents of the vector with one entry per column.
+   *
+   * @param stats Vector that receives the statistics; must outlive the write.
+   */
+  void set_compression_statistics(std::vector<column_compression_statistics>* stats)
+  {
+    _compression_stats = stats;
+  }
 };
 
 class orc_writer_options_builder {
@@ -568,6 +824,32 @@ class orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression settings of a column, overriding the defaults of the file.
+   *
+   * @param column Index of the column
+   * @param settings Compression settings of the column
+   * @return this for chaining.
+   */
+  orc_writer_options_builder& column_compression(size_type column, orc_column_compression settings)
+  {
+    options._column_compression[column] = settings;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * @param stats Vector that receives the statistics; must outlive the write.
+   * @return this for chaining.
+   */
+  orc_writer_options_builder& compression_statistics(
+    std::vector<column_compression_statistics>* stats)
+  {
+    options._compression_stats = stats;
+    return *this;
+  }
+
   /**
    * @brief move orc_writer_options member once it's built.
    */
@@ -617,6 +899,10 @@ class chunked_orc_writer_options {
   bool _enable_statistics = true;
   // Optional associated metadata
   const table_metadata_with_nullability* _metadata = nullptr;
+  // Per-column compression settings, indexed by column
+  std::map<size_type, orc_column_compression> _column_compression;
+  // Optional output for the per-column compression statistics
+  std::vector<column_compression_statistics>* _compression_stats = nullptr;
 
   friend chunked_orc_writer_options_builder;
 
@@ -664,6 +950,22 @@ class chunked_orc_writer_options {
    */
   table_metadata_with_nullability const* get_metadata() const { return _metadata; }
 
+  /**
+   * @brief Returns the per-column compression settings, indexed by column.
+   */
+  std::map<size_type, orc_column_compression> const& get_column_compression() const
+  {
+    return _column_compression;
+  }
+
+  /**
+   * @brief Returns the output for the per-column compression statistics.
+   */
+  std::vector<column_compression_statistics>* get_compression_statistics() const
+  {
+    return _compression_stats;
+  }
+
   // Setters
 
   /**
@@ -686,6 +988,30 @@ class chunked_orc_writer_options {
    * @param meta Associated metadata.
    */
   void metadata(table_metadata_with_nullability* meta) { _metadata = meta; }
+
+  /**
+   * @brief Sets the compression settings of a column, overriding the defaults of the file.
+   *
+   * @param column Index of the column
+   * @param settings Compression settings of the column
+   */
+  void set_column_compression(size_type column, orc_column_compression settings)
+  {
+    _column_compression[column] = settings;
+  }
+
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * When the writer closes, it replaces the contents of the vector with one entry per column,
+   * accumulated over all written tables.
+   *
+   * @param stats Vector that receives the statistics; must outlive the writer.
+   */
+  void set_compression_statistics(std::vector<column_compression_statistics>* stats)
+  {
+    _compression_stats = stats;
+  }
 };
 
 class chunked_orc_writer_options_builder {
@@ -742,6 +1068,33 @@ class chunked_orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the compression settings of a column, overriding the defaults of the file.
+   *
+   * @param column Index of the column
+   * @param settings Compression settings of the column
+   * @return this for chaining.
+   */
+  chunked_orc_writer_options_builder& column_compression(size_type column,
+                                                         orc_column_compression settings)
+  {
+    options._column_compression[column] = settings;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * @param stats Vector that receives the statistics; must outlive the writer.
+   * @return this for chaining.
+   */
+  chunked_orc_writer_options_builder& compression_statistics(
+    std::vector<column_compression_statistics>* stats)
+  {
+    options._compression_stats = stats;
+    return *this;
+  }
+
   /**
    * @brief move chunked_orc_writer_options member once it's built.
    */
@@ -32,6 +32,10 @@
 #include <vector>
 
 namespace cudf {
+namespace ast {
+class expression;
+}  // namespace ast
+
 namespace io {
 /**
  * @addtogroup io_readers
@@ -39,6 +43,14 @@ namespace io {
  * @file
  */
 
+/**
+ * @brief Handle to the parsed footers of Parquet sources, returned by `parse_parquet_metadata()`.
+ *
+ * The handle can be passed to any number of `read_parquet()` calls on the same sources to skip
+ * reading and parsing the footers. It is immutable and can be shared between threads.
+ */
+using parquet_metadata_handle = std::shared_ptr<parquet::parsed_metadata const>;
+
 /**
  * @brief Builds parquet_reader_options to use for `read_parquet()`.
  */
@@ -71,6 +83,12 @@ class parquet_reader_options {
   // doubles for storage of types unsupported by cudf
   bool _strict_decimal_types = false;
 
+  // Previously parsed footers of the sources; parsed by the reader if null
+  parquet_metadata_handle _metadata_handle;
+
+  // Filter used to skip row groups using their statistics; null is none
+  ast::expression const* _filter = nullptr;
+
   /**
    * @brief Constructor from source info.
    *
@@ -143,6 +161,16 @@ class parquet_reader_options {
    */
   bool is_enabled_strict_decimal_types() const { return _strict_decimal_types; }
 
+  /**
+   * @brief Returns the previously parsed footers of the sources, if any.
+   */
+  parquet_metadata_handle const& get_metadata_handle() const { return _metadata_handle; }
+
+  /**
+   * @brief Returns the filter used to skip row groups and pages, or null if none.
+   */
+  ast::expression const* get_filter() const { return _filter; }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -188,6 +216,9 @@ class parquet_reader_options {
     if ((val != 0) and (!_row_groups.empty())) {
       CUDF_FAIL("skip_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != 0) and (_filter != nullptr)) {
+      CUDF_FAIL("skip_rows can't be set along with a filter");
+    }
 
     _skip_rows = val;
   }
@@ -202,6 +233,9 @@ class parquet_reader_options {
     if ((val != -1) and (!_row_groups.empty())) {
       CUDF_FAIL("num_rows can't be set along with a non-empty row_groups");
     }
+    if ((val != -1) and (_filter != nullptr)) {
+      CUDF_FAIL("num_rows can't be set along with a filter");
+    }
 
     _num_rows = val;
   }
@@ -220,6 +254,39 @@ class parquet_reader_options {
    * cudf will convert unsupported types to double.
    */
   void set_strict_decimal_types(bool val) { _strict_decimal_types = val; }
+
+  /**
+   * @brief Sets the previously parsed footers of the sources, to avoid parsing them again.
+   *
+   * @param handle Handle returned by `parse_parquet_metadata()` for the same sources.
+   */
+  void set_metadata_handle(parquet_metadata_handle handle) { _metadata_handle = std::move(handle); }
+
+  /**
+   * @brief Sets the filter used to skip row groups and pages using their column statistics.
+   *
+   * Rows are skipped at row group and page granularity only. Row groups whose statistics show that
+   * none of their rows pass the filter are not read. When the file has page indexes, the leading
+   * and trailing pages of the remaining rows whose column indexes show that none of their rows
+   * pass the filter are not read either. The result can therefore hold fewer rows than the
+   * remaining row groups, but it is not filtered row by row: callers must still apply the filter
+   * to the returned table.
+   *
+   * The column references of the filter are indices of the top-level columns in the file. Only
+   * comparisons between a column and a literal, combined with `LOGICAL_AND`, `LOGICAL_OR` and
+   * `NOT`, are used to skip rows. When row groups are also specified, only those are considered.
+   * The expression must outlive the reads.
+   *
+   * @param filter Boolean filter expression; null disables the filtering
+   */
+  void set_filter(ast::expression const* filter)
+  {
+    if ((filter != nullptr) and ((_skip_rows != 0) or (_num_rows != -1))) {
+      CUDF_FAIL("filter can't be set along with skip_rows and num_rows");
+    }
+
+    _filter = filter;
+  }
 };
 
 class parquet_reader_options_builder {
@@ -336,6 +403,30 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the previously parsed footers of the sources, to avoid parsing them again.
+   *
+   * @param handle Handle returned by `parse_parquet_metadata()` for the same sources.
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& metadata_handle(parquet_metadata_handle handle)
+  {
+    options._metadata_handle = std::move(handle);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the filter used to skip row groups and pages using their column statistics.
+   *
+   * @param filter Boolean filter expression; see `parquet_reader_options::set_filter()`
+   * @return this for chaining.
+   */
+  parquet_reader_options_builder& filter(ast::expression const* filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief move parquet_reader_options member once it's built.
    */
@@ -372,6 +463,94 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Reads and parses the footers of Parquet sources.
+ *
+ * The returned handle can be set in the options of subsequent `read_parquet()` calls on the same
+ * sources, so that only the column chunks are read in each call:
+ * @code
+ *  auto const source = cudf::io::source_info("dataset.parquet");
+ *  auto const handle = cudf::io::parse_parquet_metadata(source);
+ *  for (cudf::size_type row_group = 0; row_group < num_row_groups; ++row_group) {
+ *    auto options = cudf::io::parquet_reader_options::builder(source)
+ *                     .row_groups({{row_group}})
+ *                     .metadata_handle(handle)
+ *                     .build();
+ *    auto result = cudf::io::read_parquet(options);
+ *  }
+ * @endcode
+ *
+ * @param src_info Dataset sources
+ *
+ * @return Handle to the parsed footers
+ */
+parquet_metadata_handle parse_parquet_metadata(source_info const& src_info);
+
+/**
+ * @brief Chunked Parquet reader class to read a dataset in chunks of bounded size.
+ *
+ * The intent of the parquet_chunked_reader is to read datasets that do not fit in device memory,
+ * or whose output would exceed the column size limit, in several passes. Concatenating the chunks
+ * gives the table returned by `read_parquet()` with the same options. The footers are parsed once
+ * and shared by all the chunks.
+ *
+ * The size of each chunk is estimated from the metadata of its column chunks before any data is
+ * read, so the actual size of a chunk may exceed the limit. Consecutive row groups are read
+ * together while they fit in the limit, and larger row groups are split into ranges of pages.
+ * Row groups selected with `parquet_reader_options::set_row_groups()` or with a filter are never
+ * split.
+ *
+ * The following code snippet reads a file in chunks of about 1GB:
+ * @code
+ *  auto const options =
+ *    cudf::io::parquet_reader_options::builder(cudf::io::source_info("dataset.parquet")).build();
+ *  cudf::io::parquet_chunked_reader reader(1024 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    ...
+ *  }
+ * @endcode
+ */
+class parquet_chunked_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  parquet_chunked_reader() = default;
+
+  /**
+   * @brief Constructor with a chunk size limit and reader options
+   *
+   * @param[in] chunk_read_limit Limit on the estimated size of the columns of each chunk, in
+   * bytes; 0 to read all the selected rows in one chunk
+   * @param[in] options Settings for controlling reading behavior; the filter, if any, must outlive
+   * the reader
+   * @param[in] mr Device memory resource used to allocate device memory of the returned tables
+   */
+  parquet_chunked_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   *
+   * At least one chunk is returned, even when no rows are selected.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @return The set of columns of the chunk along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  // Unique pointer to impl reader class
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -389,6 +568,8 @@ class column_in_metadata {
   bool _use_int96_timestamp = false;
   // bool _output_as_binary = false;
   thrust::optional<uint8_t> _decimal_precision;
+  thrust::optional<compression_type> _compression;
+  thrust::optional<int> _compression_level;
   std::vector<column_in_metadata> children;
 
  public:
@@ -456,6 +637,35 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Set the compression codec of this column, overriding the codec of the file
+   *
+   * Applies to all the leaf columns of a nested column, unless overridden for a child. Use
+   * `compression_type::NONE` to write the column uncompressed.
+   *
+   * @param compression The compression type to use for this column
+   * @return this for chaining
+   */
+  column_in_metadata& set_compression(compression_type compression)
+  {
+    _compression = compression;
+    return *this;
+  }
+
+  /**
+   * @brief Set the compression level of this column. Only valid with the ZSTD codec
+   *
+   * Applies to all the leaf columns of a nested column, unless overridden for a child.
+   *
+   * @param level The codec-specific compression level
+   * @return this for chaining
+   */
+  column_in_metadata& set_compression_level(int level)
+  {
+    _compression_level = level;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -511,6 +721,30 @@ class column_in_metadata {
    */
   uint8_t get_decimal_precision() const { return _decimal_precision.value(); }
 
+  /**
+   * @brief Get whether the compression codec has been set for this column
+   */
+  bool is_compression_set() const { return _compression.has_value(); }
+
+  /**
+   * @brief Get the compression codec that was set for this column.
+   * @throws If the codec was not set for this column.
+   *         Check using `is_compression_set()` first.
+   */
+  compression_type get_compression() const { return _compression.value(); }
+
+  /**
+   * @brief Get whether the compression level has been set for this column
+   */
+  bool is_compression_level_set() const { return _compression_level.has_value(); }
+
+  /**
+   * @brief Get the compression level that was set for this column.
+   * @throws If the compression level was not set for this column.
+   *         Check using `is_compression_level_set()` first.
+   */
+  int get_compression_level() const { return _compression_level.value(); }
+
   /**
    * @brief Get the number of children of this column
    */
@@ -559,6 +793,8 @@ class parquet_writer_options {
   bool _write_timestamps_as_int96 = false;
   // Column chunks file path to be set in the raw output metadata
   std::string _column_chunks_file_path;
+  // Optional output for the per-column compression statistics
+  std::vector<column_compression_statistics>* _compression_stats = nullptr;
 
   /**
    * @brief Constructor from sink and table.
@@ -633,6 +869,14 @@ class parquet_writer_options {
    */
   std::string get_column_chunks_file_path() const { return _column_chunks_file_path; }
 
+  /**
+   * @brief Returns the output for the per-column compression statistics.
+   */
+  std::vector<column_compression_statistics>* get_compression_statistics() const
+  {
+    return _compression_stats;
+  }
+
   /**
    * @brief Sets metadata.
    *
@@ -671,6 +915,18 @@ class parquet_writer_options {
   {
     _column_chunks_file_path.assign(file_path);
   }
+
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * When the writer closes, it replaces the contents of the vector with one entry per leaf column.
+   *
+   * @param stats Vector that receives the statistics; must outlive the write.
+   */
+  void set_compression_statistics(std::vector<column_compression_statistics>* stats)
+  {
+    _compression_stats = stats;
+  }
 };
 
 class parquet_writer_options_builder {
@@ -755,6 +1011,19 @@ class parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * @param stats Vector that receives the statistics; must outlive the write.
+   * @return this for chaining.
+   */
+  parquet_writer_options_builder& compression_statistics(
+    std::vector<column_compression_statistics>* stats)
+  {
+    options._compression_stats = stats;
+    return *this;
+  }
+
   /**
    * @brief move parquet_writer_options member once it's built.
    */
@@ -822,6 +1091,8 @@ class chunked_parquet_writer_options {
   // Parquet writer can write INT96 or TIMESTAMP_MICROS. Defaults to TIMESTAMP_MICROS.
   // If true then overrides any per-column setting in _metadata.
   bool _write_timestamps_as_int96 = false;
+  // Optional output for the per-column compression statistics
+  std::vector<column_compression_statistics>* _compression_stats = nullptr;
 
   /**
    * @brief Constructor from sink.
@@ -865,6 +1136,14 @@ class chunked_parquet_writer_options {
    */
   bool is_enabled_int96_timestamps() const { return _write_timestamps_as_int96; }
 
+  /**
+   * @brief Returns the output for the per-column compression statistics.
+   */
+  std::vector<column_compression_statistics>* get_compression_statistics() const
+  {
+    return _compression_stats;
+  }
+
   /**
    * @brief Sets metadata.
    *
@@ -872,6 +1151,19 @@ class chunked_parquet_writer_options {
    */
   void set_metadata(table_input_metadata const* metadata) { _metadata = metadata; }
 
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * When the writer closes, it replaces the contents of the vector with one entry per leaf
+   * column, accumulated over all written tables.
+   *
+   * @param stats Vector that receives the statistics; must outlive the writer.
+   */
+  void set_compression_statistics(std::vector<column_compression_statistics>* stats)
+  {
+    _compression_stats = stats;
+  }
+
   /**
    * @brief Sets the level of statistics in parquet_writer_options.
    *
@@ -973,6 +1265,19 @@ class chunked_parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the output for the per-column compression statistics.
+   *
+   * @param stats Vector that receives the statistics; must outlive the writer.
+   * @return this for chaining.
+   */
+  chunked_parquet_writer_options_builder& compression_statistics(
+    std::vector<column_compression_statistics>* stats)
+  {
+    options._compression_stats = stats;
+    return *this;
+  }
+
   /**
    * @brief move chunked_parquet_writer_options member once it's built.
    */
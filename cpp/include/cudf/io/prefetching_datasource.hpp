@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <chrono>
+#include <memory>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Counters that describe how well a `prefetching_datasource` hides the read latency.
+ */
+struct prefetch_statistics {
+  size_t hits             = 0;  ///< Reads served from prefetched data
+  size_t misses           = 0;  ///< Reads not covered by the plan, forwarded to the source
+  size_t stalls           = 0;  ///< Hits that had to wait for the prefetch to complete
+  size_t prefetched_bytes = 0;  ///< Bytes read ahead by the background threads
+  std::chrono::nanoseconds stall_time{0};  ///< Total time spent waiting for prefetches
+};
+
+/**
+ * @brief Datasource decorator that reads planned ranges ahead of time on background threads.
+ *
+ * Wraps any `datasource` (e.g. one returned by `datasource::create`). Planned ranges, passed to
+ * `hint_reads` either by the readers or directly by the caller, are read in plan order by
+ * background threads while keeping at most `read_ahead_size` bytes prefetched and not yet
+ * consumed. Reads of planned ranges are served from the prefetched data, waiting for the
+ * prefetch to complete if it is still in flight; all other reads are forwarded to the wrapped
+ * source.
+ *
+ * This allows the host IO for the next part of the input (e.g. the next row group or stripe) to
+ * overlap with the decoding of the current part when reading a file in several calls.
+ *
+ * Example:
+ * @code
+ * auto source = prefetching_datasource(datasource::create(filepath), 256 << 20);
+ * source.hint_reads(row_group_ranges);
+ * for (auto row_group = 0; row_group < num_row_groups; ++row_group) {
+ *   auto options = parquet_reader_options::builder(source_info{&source})
+ *                    .row_groups({{row_group}}).build();
+ *   auto result = read_parquet(options);
+ *   ...
+ * }
+ * @endcode
+ */
+class prefetching_datasource : public datasource {
+ public:
+  /**
+   * @brief Constructs a prefetching wrapper around a datasource.
+   *
+   * @param source The datasource to read from; must be safe to read from multiple threads
+   * @param read_ahead_size Maximum number of prefetched bytes that have not been read yet
+   * @param num_threads Number of background threads used to prefetch
+   */
+  prefetching_datasource(std::unique_ptr<datasource> source,
+                         size_t read_ahead_size,
+                         size_t num_threads = 2);
+
+  /**
+   * @brief Cancels the pending prefetches and waits for the in-flight ones to complete.
+   */
+  ~prefetching_datasource() override;
+
+  /**
+   * @brief Appends the ranges to the prefetch plan.
+   *
+   * Ranges that are already planned and not yet read are not added again.
+   */
+  void hint_reads(host_span<byte_range const> ranges) override;
+
+  std::unique_ptr<datasource::buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  std::vector<size_t> host_read_ranges(host_span<read_range const> ranges,
+                                       size_t max_gap = default_max_coalesce_gap) override;
+
+  bool supports_device_read() const override;
+
+  bool is_device_read_preferred(size_t size) const override;
+
+  std::unique_ptr<datasource::buffer> device_read(size_t offset,
+                                                  size_t size,
+                                                  rmm::cuda_stream_view stream) override;
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  size_t size() const override;
+
+  /**
+   * @brief Returns the prefetch counters collected since the construction of the source.
+   */
+  prefetch_statistics statistics() const;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+}  // namespace io
+}  // namespace cudf
@@ -58,7 +58,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< ZSTD format, using LZ77 + finite state entropy coding
+  LZ4      ///< LZ4 format, using LZ77
 };
 
 /**
@@ -71,6 +73,15 @@ enum class io_type {
   USER_IMPLEMENTED,  ///< Input/output is handled by a custom user class
 };
 
+/**
+ * @brief How data is written to an output file
+ */
+enum class file_sink_mode {
+  SYNC,          ///< Each write is completed before it returns
+  ASYNC,         ///< Writes are staged in a ring of buffers and written in the background
+  ASYNC_DIRECT,  ///< Like ASYNC, bypassing the page cache with O_DIRECT when supported
+};
+
 /**
  * @brief Behavior when handling quotations in field data
  */
@@ -90,6 +101,28 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
 };
 
+/**
+ * @brief Compression statistics of a column written by the Parquet or ORC writer
+ *
+ * The data that the writer stores uncompressed, because compression failed or did not reduce its
+ * size, is counted with the same size on both sides of the ratio. The codec is `NONE` if no data
+ * of the column was compressed.
+ */
+struct column_compression_statistics {
+  std::string name;  //!< Column name; nested Parquet columns use their dotted path
+  compression_type compression = compression_type::NONE;  //!< Codec of the compressed data
+  size_t uncompressed_size     = 0;  //!< Size of the encoded column data before compression
+  size_t compressed_size       = 0;  //!< Size of the column data in the file
+
+  /**
+   * @brief Returns the ratio of the uncompressed size to the compressed size.
+   */
+  double compression_ratio() const
+  {
+    return compressed_size == 0 ? 1.0 : static_cast<double>(uncompressed_size) / compressed_size;
+  }
+};
+
 /**
  * @brief Detailed name information for output columns.
  *
@@ -123,6 +156,7 @@ struct table_metadata {
   std::vector<column_name_info>
     schema_info;  //!< Detailed name information for the entire output hierarchy
   std::map<std::string, std::string> user_data;  //!< Format-dependent metadata as key-values pairs
+  size_type num_pruned_row_groups = 0;  //!< Row groups or stripes skipped using their statistics
 };
 
 /**
@@ -219,6 +253,7 @@ struct source_info {
 struct sink_info {
   io_type type = io_type::VOID;
   std::string filepath;
+  file_sink_mode file_mode       = file_sink_mode::SYNC;
   std::vector<char>* buffer      = nullptr;
   cudf::io::data_sink* user_sink = nullptr;
 
@@ -226,6 +261,11 @@ struct sink_info {
 
   explicit sink_info(const std::string& file_path) : type(io_type::FILEPATH), filepath(file_path) {}
 
+  explicit sink_info(const std::string& file_path, file_sink_mode mode)
+    : type(io_type::FILEPATH), filepath(file_path), file_mode(mode)
+  {
+  }
+
   explicit sink_info(std::vector<char>* buffer) : type(io_type::HOST_BUFFER), buffer(buffer) {}
 
   explicit sink_info(class cudf::io::data_sink* user_sink_)
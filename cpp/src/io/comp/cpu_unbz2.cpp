@@ -592,5 +592,47 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+int32_t cpu_bz2_uncompress_block(const uint8_t *source,
+                                 size_t sourceLen,
+                                 uint64_t block_start,
+                                 uint8_t *dest,
+                                 size_t *destLen,
+                                 uint64_t *block_end)
+{
+  unbz_state_s s{};
+  int ret;
+
+  if (dest == NULL || destLen == NULL || block_end == NULL || source == NULL || sourceLen < 12)
+    return BZ_PARAM_ERROR;
+
+  s.base   = source;
+  s.end    = source + sourceLen - 4;
+  s.cur    = source + (size_t)(block_start >> 3);
+  s.bitpos = (uint32_t)(block_start & 7);
+  if (s.cur + 8 > s.end) return BZ_PARAM_ERROR;
+  s.bitbuf = __builtin_bswap64(*reinterpret_cast<const uint64_t *>(s.cur));
+
+  s.out     = dest;
+  s.outend  = dest + *destLen;
+  s.outbase = dest;
+
+  // The block size of the stream is not known; use the largest one
+  s.blockSize100k = 9;
+  s.tt.resize(s.blockSize100k * 100000);
+
+  ret = bz2_decompress_block(&s);
+  if (ret == BZ_OK || ret == BZ_STREAM_END) {
+    bzUnRLE(&s);
+    if (s.nblock_used != s.save_nblock + 1 || s.out > s.outend) {
+      ret = (s.out < s.outend) ? BZ_UNEXPECTED_EOF : BZ_OUTBUFF_FULL;
+    }
+  }
+
+  *destLen   = s.out - s.outbase;
+  *block_end = ((s.cur - s.base) << 3) + s.bitpos;
+
+  return ret;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_codec.h"
+#include "io_uncomp.h"
+
+#include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <arrow/util/compression.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace {
+
+// Batches with fewer chunks per thread of the I/O thread pool are decompressed on the host
+constexpr size_t host_max_chunks_per_thread = 4;
+// Minimum average uncompressed chunk size for decompressing a batch on the host
+constexpr size_t host_min_avg_chunk_size = 1 << 20;
+
+int to_stream_type(host_codec codec)
+{
+  switch (codec) {
+    case host_codec::GZIP: return IO_UNCOMP_STREAM_TYPE_GZIP;
+    case host_codec::INFLATE: return IO_UNCOMP_STREAM_TYPE_INFLATE;
+    case host_codec::SNAPPY: return IO_UNCOMP_STREAM_TYPE_SNAPPY;
+    case host_codec::ZSTD: return IO_UNCOMP_STREAM_TYPE_ZSTD;
+    case host_codec::LZ4: return IO_UNCOMP_STREAM_TYPE_LZ4;
+  }
+  CUDF_FAIL("Unsupported host codec");
+}
+
+std::unique_ptr<arrow::util::Codec> make_arrow_codec(host_codec codec, int level)
+{
+  auto const type = [codec]() {
+    switch (codec) {
+      case host_codec::ZSTD: return arrow::Compression::ZSTD;
+      case host_codec::LZ4: return arrow::Compression::LZ4;
+      default: CUDF_FAIL("Unsupported host compression codec");
+    }
+  }();
+  auto result = (level == default_compression_level) ? arrow::util::Codec::Create(type)
+                                                     : arrow::util::Codec::Create(type, level);
+  CUDF_EXPECTS(result.ok(), "Cannot create host codec: " + result.status().ToString());
+  return std::move(result).ValueOrDie();
+}
+
+/**
+ * @brief Helper for pinned host memory
+ */
+template <typename T>
+using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
+
+/**
+ * @brief Idle pinned buffers for staging the chunks of host transforms, shared by the process.
+ *
+ * Pinning host memory costs about as much as copying it through the pageable path, so the buffers
+ * are kept for the following batches rather than freed. At most `max_idle_buffers` buffers are
+ * kept, the largest ones. The pool is never destroyed, so that no CUDA call is made after the
+ * runtime has been unloaded.
+ */
+class staging_buffer_pool {
+ public:
+  static constexpr size_t max_idle_buffers = 2;
+
+  struct buffer {
+    pinned_buffer<uint8_t> data{nullptr, cudaFreeHost};
+    size_t size = 0;
+  };
+
+  /**
+   * @brief Returns an idle buffer of at least `size` bytes, or a new one if there is none.
+   */
+  buffer acquire(size_t size)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto const it = std::find_if(
+        idle_.begin(), idle_.end(), [size](auto const &idle) { return idle.size >= size; });
+      if (it != idle_.end()) {
+        auto result = std::move(*it);
+        idle_.erase(it);
+        return result;
+      }
+    }
+    uint8_t *ptr = nullptr;
+    CUDA_TRY(cudaMallocHost(&ptr, size));
+    buffer result;
+    result.data.reset(ptr);
+    result.size = size;
+    return result;
+  }
+
+  /**
+   * @brief Returns a buffer to the pool; the smallest buffer is freed if the pool is full.
+   */
+  void release(buffer &&released)
+  {
+    buffer evicted;  // Freed once the lock is released
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_.push_back(std::move(released));
+    if (idle_.size() > max_idle_buffers) {
+      auto const smallest = std::min_element(
+        idle_.begin(), idle_.end(), [](auto const &a, auto const &b) { return a.size < b.size; });
+      evicted = std::move(*smallest);
+      idle_.erase(smallest);
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<buffer> idle_;
+};
+
+staging_buffer_pool &staging_pool()
+{
+  static auto *pool = new staging_buffer_pool;
+  return *pool;
+}
+
+/**
+ * @brief Copies the input chunks to the host, transforms them on the I/O thread pool and copies
+ * the output chunks back to the device.
+ *
+ * The chunks are staged in one pooled pinned buffer, so the copies are asynchronous and do not go
+ * through the driver's pageable staging buffers. Consecutive chunks that are also contiguous in
+ * device memory are copied together.
+ *
+ * @param make_worker Function called once per task that returns the function transforming one
+ * chunk; the returned function returns the output size, or a negative value on error
+ */
+template <typename MakeWorker>
+void host_transform(gpu_inflate_input_s *inputs,
+                    gpu_inflate_status_s *outputs,
+                    int count,
+                    rmm::cuda_stream_view stream,
+                    MakeWorker make_worker)
+{
+  if (count <= 0) { return; }
+
+  std::vector<gpu_inflate_input_s> h_inputs(count);
+  CUDA_TRY(cudaMemcpyAsync(h_inputs.data(),
+                           inputs,
+                           count * sizeof(gpu_inflate_input_s),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  // Stage all chunks in one pinned buffer, the inputs followed by the outputs
+  std::vector<size_t> src_offsets(count + 1, 0);
+  std::vector<size_t> dst_offsets(count + 1, 0);
+  for (int i = 0; i < count; ++i) {
+    src_offsets[i + 1] = src_offsets[i] + h_inputs[i].srcSize;
+    dst_offsets[i + 1] = dst_offsets[i] + h_inputs[i].dstSize;
+  }
+  auto staging =
+    staging_pool().acquire(std::max<size_t>(src_offsets.back() + dst_offsets.back(), 1));
+  auto const h_src = staging.data.get();
+  auto const h_dst = h_src + src_offsets.back();
+  for (int begin = 0, end = 0; begin < count; begin = end) {
+    auto const src = static_cast<uint8_t const *>(h_inputs[begin].srcDevice);
+    end            = begin + 1;
+    while (end < count &&
+           h_inputs[end].srcDevice == src + (src_offsets[end] - src_offsets[begin])) {
+      ++end;
+    }
+    auto const size = src_offsets[end] - src_offsets[begin];
+    if (size == 0) { continue; }
+    CUDA_TRY(cudaMemcpyAsync(
+      h_src + src_offsets[begin], src, size, cudaMemcpyDeviceToHost, stream.value()));
+  }
+  stream.synchronize();
+
+  // Split the chunks into tasks of similar input size
+  std::vector<gpu_inflate_status_s> h_outputs(count);
+  auto const target_size =
+    std::max<size_t>(src_offsets.back() / (detail::io_thread_pool().size() * 4), 1);
+  std::vector<int> group_offsets{0};
+  while (group_offsets.back() < count) {
+    auto const begin = group_offsets.back();
+    auto end         = begin + 1;
+    while (end < count && src_offsets[end] - src_offsets[begin] < target_size) {
+      ++end;
+    }
+    group_offsets.push_back(end);
+  }
+  detail::parallel_for(group_offsets.size() - 1, [&](size_t g) {
+    auto const worker = make_worker();
+    for (auto i = group_offsets[g]; i < group_offsets[g + 1]; ++i) {
+      int64_t const size = worker(
+        h_src + src_offsets[i], h_inputs[i].srcSize, h_dst + dst_offsets[i], h_inputs[i].dstSize);
+      h_outputs[i].bytes_written = std::max<int64_t>(size, 0);
+      h_outputs[i].status        = size >= 0 ? 0 : 1;
+      h_outputs[i].reserved      = 0;
+    }
+  });
+
+  // Runs of outputs are copied together while each output fills its contiguous device buffer, so
+  // that no byte past the output of a chunk is written
+  auto const is_written = [&](int i) {
+    return h_outputs[i].status == 0 && h_outputs[i].bytes_written != 0;
+  };
+  for (int begin = 0, end = 0; begin < count; begin = end) {
+    end = begin + 1;
+    if (!is_written(begin)) { continue; }
+    auto const dst = static_cast<uint8_t *>(h_inputs[begin].dstDevice);
+    while (end < count && h_outputs[end - 1].bytes_written == h_inputs[end - 1].dstSize &&
+           is_written(end) &&
+           h_inputs[end].dstDevice == dst + (dst_offsets[end] - dst_offsets[begin])) {
+      ++end;
+    }
+    auto const size = dst_offsets[end - 1] - dst_offsets[begin] + h_outputs[end - 1].bytes_written;
+    CUDA_TRY(cudaMemcpyAsync(
+      dst, h_dst + dst_offsets[begin], size, cudaMemcpyHostToDevice, stream.value()));
+  }
+  CUDA_TRY(cudaMemcpyAsync(outputs,
+                           h_outputs.data(),
+                           count * sizeof(gpu_inflate_status_s),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  // The staging buffers must outlive the copies
+  stream.synchronize();
+  staging_pool().release(std::move(staging));
+}
+
+}  // namespace
+
+bool use_host_decompression(host_codec codec, size_t num_chunks, size_t total_uncompressed_size)
+{
+  // No GPU decompressor for these codecs
+  if (codec == host_codec::ZSTD || codec == host_codec::LZ4) { return true; }
+
+  // Read on every call so that the policy can be changed between reads
+  auto const policy = detail::getenv_or("LIBCUDF_HOST_DECOMPRESSION", "AUTO");
+  if (policy == "ALWAYS") { return true; }
+  if (policy == "OFF" || num_chunks == 0) { return false; }
+
+  auto const num_threads = detail::io_thread_pool().size();
+  return num_chunks < num_threads * host_max_chunks_per_thread &&
+         total_uncompressed_size / num_chunks >= host_min_avg_chunk_size;
+}
+
+void host_decompress(host_codec codec,
+                     gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     int count,
+                     rmm::cuda_stream_view stream)
+{
+  auto const stream_type = to_stream_type(codec);
+  host_transform(inputs, outputs, count, stream, [stream_type]() {
+    return [decompressor = HostDecompressor::Create(stream_type)](
+             uint8_t const *src, size_t src_size, uint8_t *dst, size_t dst_size) -> int64_t {
+      auto const size = decompressor->Decompress(dst, dst_size, src, src_size);
+      // Zero is also returned on error
+      return (size == 0 && dst_size != 0) ? -1 : static_cast<int64_t>(size);
+    };
+  });
+}
+
+void host_compress(host_codec codec,
+                   gpu_inflate_input_s *inputs,
+                   gpu_inflate_status_s *outputs,
+                   int count,
+                   rmm::cuda_stream_view stream,
+                   int level)
+{
+  host_transform(inputs, outputs, count, stream, [codec, level]() {
+    return [arrow_codec = make_arrow_codec(codec, level)](
+             uint8_t const *src, size_t src_size, uint8_t *dst, size_t dst_size) -> int64_t {
+      auto const result = arrow_codec->Compress(src_size, src, dst_size, dst);
+      return result.ok() ? *result : -1;
+    };
+  });
+}
+
+void compress_groups(host_span<int const> chunk_groups,
+                     gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     rmm::cuda_stream_view stream,
+                     group_compressor const &compress)
+{
+  auto const count = static_cast<int>(chunk_groups.size());
+  if (std::all_of(chunk_groups.begin(), chunk_groups.end(), [](int g) { return g == 0; })) {
+    if (count > 0) { compress(0, inputs, outputs, count); }
+    return;
+  }
+
+  std::vector<gpu_inflate_input_s> h_inputs(count);
+  std::vector<gpu_inflate_status_s> h_outputs(count);
+  CUDA_TRY(cudaMemcpyAsync(h_inputs.data(),
+                           inputs,
+                           count * sizeof(gpu_inflate_input_s),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  CUDA_TRY(cudaMemcpyAsync(h_outputs.data(),
+                           outputs,
+                           count * sizeof(gpu_inflate_status_s),
+                           cudaMemcpyDeviceToHost,
+                           stream.value()));
+  stream.synchronize();
+
+  auto const num_groups = *std::max_element(chunk_groups.begin(), chunk_groups.end()) + 1;
+  for (int group = 0; group < num_groups; ++group) {
+    std::vector<int> chunks;
+    for (int i = 0; i < count; ++i) {
+      if (chunk_groups[i] == group) { chunks.push_back(i); }
+    }
+    if (chunks.empty()) { continue; }
+
+    hostdevice_vector<gpu_inflate_input_s> group_in(chunks.size(), stream);
+    hostdevice_vector<gpu_inflate_status_s> group_out(chunks.size(), stream);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      group_in[i]  = h_inputs[chunks[i]];
+      group_out[i] = h_outputs[chunks[i]];
+    }
+    group_in.host_to_device(stream);
+    group_out.host_to_device(stream);
+    compress(group, group_in.device_ptr(), group_out.device_ptr(), chunks.size());
+    group_out.device_to_host(stream, true);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      h_outputs[chunks[i]] = group_out[i];
+    }
+  }
+
+  CUDA_TRY(cudaMemcpyAsync(outputs,
+                           h_outputs.data(),
+                           count * sizeof(gpu_inflate_status_s),
+                           cudaMemcpyHostToDevice,
+                           stream.value()));
+  stream.synchronize();
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "gpuinflate.h"
+
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <limits>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Codecs that are compressed and decompressed on the host
+ */
+enum class host_codec {
+  GZIP,     ///< Deflate streams with a gzip header
+  INFLATE,  ///< Raw deflate streams
+  SNAPPY,   ///< Raw snappy blocks
+  ZSTD,     ///< ZSTD frames
+  LZ4,      ///< Raw LZ4 blocks
+};
+
+/**
+ * @brief Compression level that selects the default level of the codec
+ */
+constexpr int default_compression_level = std::numeric_limits<int>::min();
+
+/**
+ * @brief Returns whether a batch of chunks should be decompressed on the host instead of the GPU
+ *
+ * The GPU decompressors process each chunk with a single warp or block, so batches of few large
+ * chunks leave most of the GPU idle and decompress faster on the I/O thread pool. Codecs without a
+ * GPU decompressor always use the host.
+ *
+ * The choice can be overridden with the `LIBCUDF_HOST_DECOMPRESSION` environment variable:
+ * `ALWAYS` decompresses all supported codecs on the host, `OFF` only the codecs without a GPU
+ * decompressor, and `AUTO` (default) uses the batch size heuristic. The variable is read on every
+ * call.
+ *
+ * @param[in] codec Codec of the compressed data
+ * @param[in] num_chunks Number of chunks in the batch
+ * @param[in] total_uncompressed_size Total uncompressed size of the chunks in the batch
+ */
+bool use_host_decompression(host_codec codec, size_t num_chunks, size_t total_uncompressed_size);
+
+/**
+ * @brief Interface for decompressing data on the host
+ *
+ * Takes the same batches of gpu_inflate_input_s/gpu_inflate_status_s pairs as the GPU
+ * decompressors. The compressed data is copied to host memory and the chunks are decompressed on
+ * the I/O thread pool, then the output is copied back to device memory. Returns once the output
+ * and the status structures have been written.
+ *
+ * @param[in] codec Codec of the compressed data
+ * @param[in] inputs List of input argument structures, in device memory
+ * @param[out] outputs List of output status structures, in device memory
+ * @param[in] count Number of input/output structures
+ * @param[in] stream CUDA stream to use
+ */
+void host_decompress(host_codec codec,
+                     gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     int count,
+                     rmm::cuda_stream_view stream);
+
+/**
+ * @brief Interface for compressing data on the host
+ *
+ * Chunks whose compressed size exceeds the size of their output buffer are reported with a
+ * non-zero status, like with the GPU compressors.
+ *
+ * @param[in] codec Codec to compress the data with
+ * @param[in] inputs List of input argument structures, in device memory
+ * @param[out] outputs List of output status structures, in device memory
+ * @param[in] count Number of input/output structures
+ * @param[in] stream CUDA stream to use
+ * @param[in] level Codec-specific compression level; only ZSTD supports levels
+ */
+void host_compress(host_codec codec,
+                   gpu_inflate_input_s *inputs,
+                   gpu_inflate_status_s *outputs,
+                   int count,
+                   rmm::cuda_stream_view stream,
+                   int level = default_compression_level);
+
+/**
+ * @brief Compressor of a contiguous batch of chunks that belong to the same group
+ */
+using group_compressor =
+  std::function<void(int group, gpu_inflate_input_s *, gpu_inflate_status_s *, int count)>;
+
+/**
+ * @brief Compresses the chunks of a batch in groups that use different compression settings
+ *
+ * The chunks of each group are gathered into contiguous arrays and compressed separately, then
+ * their status is scattered back to `outputs`. Chunks with a negative group are not compressed and
+ * keep their initial status. A batch whose chunks are all in group 0 is compressed in place.
+ *
+ * @param[in] chunk_groups Group of each chunk, in host memory
+ * @param[in] inputs List of input argument structures, in device memory
+ * @param[in,out] outputs List of output status structures, in device memory
+ * @param[in] stream CUDA stream to use
+ * @param[in] compress Function that compresses the chunks of a group
+ */
+void compress_groups(host_span<int const> chunk_groups,
+                     gpu_inflate_input_s *inputs,
+                     gpu_inflate_status_s *outputs,
+                     rmm::cuda_stream_view stream,
+                     group_compressor const &compress);
+
+}  // namespace io
+}  // namespace cudf
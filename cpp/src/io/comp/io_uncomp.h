@@ -56,6 +56,35 @@ class HostDecompressor {
   static std::unique_ptr<HostDecompressor> Create(int stream_type);
 };
 
+/**
+ * @brief Decompresses a compressed input in host memory incrementally, into consecutive parts of
+ * the output
+ */
+class host_stream_decompressor {
+ public:
+  virtual ~host_stream_decompressor() {}
+
+  /**
+   * @brief Decompresses the next part of the output
+   *
+   * @param dst Buffer to fill with the next part of the output
+   *
+   * @return Number of bytes written; less than the size of `dst` only at the end of the output
+   */
+  virtual size_t read(host_span<char> dst) = 0;
+
+  /**
+   * @brief Creates a decompressor for the input
+   *
+   * @param src Compressed input; must outlive the decompressor
+   * @param compression Compression format, as passed to `get_uncompressed_data`
+   *
+   * @return Decompressor, or null if the format cannot be decompressed incrementally
+   */
+  static std::unique_ptr<host_stream_decompressor> create(host_span<char const> src,
+                                                          std::string const& compression);
+};
+
 /**
  * @brief GZIP header flags
  * See https://tools.ietf.org/html/rfc1952
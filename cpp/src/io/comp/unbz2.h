@@ -102,5 +102,17 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t *dstlen,
                            uint64_t *block_start = nullptr);
 
+// Decompresses the single block that starts at bit offset block_start of the input, which may be
+// followed by other blocks or streams. Returns BZ_OK if another block follows, BZ_STREAM_END if the
+// end-of-stream signature follows, or an error. dstlen is updated to the size of the block output,
+// also when BZ_OUTBUFF_FULL is returned, and block_end to the offset in bits after the block and
+// after the end-of-stream signature if any.
+int32_t cpu_bz2_uncompress_block(const uint8_t *input,
+                                 size_t inlen,
+                                 uint64_t block_start,
+                                 uint8_t *dst,
+                                 size_t *dstlen,
+                                 uint64_t *block_end);
+
 }  // namespace io
 }  // namespace cudf
@@ -17,6 +17,8 @@
 #include "io_uncomp.h"
 #include "unbz2.h"  // bz2 uncompress
 
+#include <io/utilities/thread_pool.hpp>
+
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -26,6 +28,12 @@
 
 #include <zlib.h>  // uncompress
 
+#include <arrow/util/compression.h>
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
 using cudf::host_span;
 
 namespace cudf {
@@ -279,6 +287,436 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+namespace {
+
+/**
+ * @brief Minimum size of the compressed input for its members or blocks to be decompressed in
+ * parallel; smaller inputs are decompressed on the calling thread
+ */
+constexpr size_t parallel_decompression_min_size = 4 << 20;
+
+/**
+ * @brief Maximum ratio of the uncompressed size to the compressed size of a deflate stream
+ */
+constexpr size_t max_deflate_ratio = 1032;
+
+/**
+ * @brief Initial ratio of the output buffer size to the compressed size of a gzip member, when
+ * the members are decompressed in parallel
+ */
+constexpr size_t initial_inflate_ratio = 4;
+
+uint32_t read_le32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+/**
+ * @brief Parses the header of a gzip member
+ *
+ * @param raw Start of the member
+ * @param len Size of the input from the start of the member
+ * @param[out] header_len Size of the header
+ * @param[out] bgzf_size Size of the member from the BGZF extra field, or 0 if there is none
+ *
+ * @return Whether the header is valid
+ */
+bool parse_gz_member_header(const uint8_t *raw, size_t len, size_t &header_len, size_t &bgzf_size)
+{
+  bgzf_size = 0;
+  if (len < sizeof(gz_file_header_s) + 8) return false;
+  auto const fhdr = reinterpret_cast<gz_file_header_s const *>(raw);
+  if (fhdr->id1 != 0x1f || fhdr->id2 != 0x8b || fhdr->comp_mthd != 8 || (fhdr->flags & 0xe0)) {
+    return false;
+  }
+  size_t pos = sizeof(gz_file_header_s);
+  if (fhdr->flags & GZIPHeaderFlag::fextra) {
+    if (pos + 2 > len) return false;
+    size_t const xlen = raw[pos] | (raw[pos + 1] << 8);
+    pos += 2;
+    if (pos + xlen > len) return false;
+    // BGZF blocks store their size minus one in the "BC" subfield
+    for (size_t sub = pos; sub + 4 <= pos + xlen;) {
+      size_t const slen = raw[sub + 2] | (raw[sub + 3] << 8);
+      if (raw[sub] == 'B' && raw[sub + 1] == 'C' && slen == 2 && sub + 6 <= pos + xlen) {
+        bgzf_size = (raw[sub + 4] | (raw[sub + 5] << 8)) + 1;
+      }
+      sub += 4 + slen;
+    }
+    pos += xlen;
+  }
+  for (auto const flag : {GZIPHeaderFlag::fname, GZIPHeaderFlag::fcomment}) {
+    if (fhdr->flags & flag) {
+      auto const end = static_cast<const uint8_t *>(memchr(raw + pos, 0, len - pos));
+      if (end == nullptr) return false;
+      pos = end - raw + 1;
+    }
+  }
+  if (fhdr->flags & GZIPHeaderFlag::fhcrc) { pos += 2; }
+  if (pos + 8 > len) return false;
+  header_len = pos;
+  return true;
+}
+
+/**
+ * @brief Location of a gzip member within the input
+ */
+struct gz_member {
+  size_t offset;      // Offset of the member header
+  size_t header_len;  // Size of the member header
+  size_t size;        // Size of the member, including the header and the trailer
+};
+
+/**
+ * @brief Locates the members of a gzip input
+ *
+ * BGZF blocks store their size in their header, so they are located exactly. Members of other
+ * inputs are located by searching for headers that match the header of the first member; a false
+ * match is detected when the members are decompressed.
+ *
+ * @return Members of the input, or a single member if the input cannot be split
+ */
+std::vector<gz_member> find_gz_members(const uint8_t *raw, size_t len)
+{
+  size_t header_len = 0;
+  size_t bgzf_size  = 0;
+  if (!parse_gz_member_header(raw, len, header_len, bgzf_size)) return {};
+
+  std::vector<gz_member> members;
+  if (bgzf_size != 0) {
+    for (size_t offset = 0; offset < len; offset += members.back().size) {
+      if (!parse_gz_member_header(raw + offset, len - offset, header_len, bgzf_size) ||
+          bgzf_size < header_len + 8 || offset + bgzf_size > len) {
+        return {{0, 0, len}};
+      }
+      members.push_back({offset, header_len, bgzf_size});
+    }
+    return members;
+  }
+
+  members.push_back({0, header_len, len});
+  auto const first_hdr = reinterpret_cast<gz_file_header_s const *>(raw);
+  for (size_t offset = header_len + 10; offset + sizeof(gz_file_header_s) + 8 <= len;) {
+    auto const next = static_cast<const uint8_t *>(memchr(raw + offset, 0x1f, len - offset));
+    if (next == nullptr) break;
+    offset         = next - raw;
+    auto const hdr = reinterpret_cast<gz_file_header_s const *>(next);
+    if (hdr->id2 == 0x8b && hdr->comp_mthd == 8 && hdr->flags == first_hdr->flags &&
+        hdr->xflags == first_hdr->xflags && hdr->os == first_hdr->os &&
+        parse_gz_member_header(next, len - offset, header_len, bgzf_size)) {
+      members.back().size = offset - members.back().offset;
+      members.push_back({offset, header_len, len - offset});
+      offset += header_len + 10;
+    } else {
+      ++offset;
+    }
+  }
+  return members;
+}
+
+/**
+ * @brief Decompresses the members of a gzip input in parallel
+ *
+ * Each member is decompressed into its own buffer, grown as its output is produced, and the
+ * buffers are then concatenated. The uncompressed size in the trailer of a member only bounds the
+ * growth, so a member located by a false header match fails before a large buffer is allocated.
+ *
+ * @param raw Compressed input
+ * @param members Members of the input
+ * @param[out] dst Decompressed output
+ *
+ * @return Whether all members were decompressed to their expected size; false if the members were
+ * not located correctly, in which case the input should be decompressed sequentially
+ */
+bool inflate_gz_members(const uint8_t *raw,
+                        std::vector<gz_member> const &members,
+                        std::vector<char> &dst)
+{
+  // Sizes that deflate cannot produce from the member data are rejected before inflating
+  for (auto const &member : members) {
+    if (member.size < member.header_len + 8) return false;
+    size_t const comp_len   = member.size - member.header_len - 8;
+    size_t const uncomp_len = read_le32(raw + member.offset + member.size - 4);
+    if (uncomp_len > comp_len * max_deflate_ratio) return false;
+  }
+
+  std::vector<std::vector<char>> outputs(members.size());
+  auto const inflate_member = [&](size_t i) {
+    auto const &member    = members[i];
+    auto const comp_data  = raw + member.offset + member.header_len;
+    auto const comp_len   = member.size - member.header_len - 8;
+    auto const uncomp_len = static_cast<size_t>(read_le32(comp_data + comp_len + 4));
+    // One byte more than the trailer states detects members that are longer
+    auto const max_len = uncomp_len + 1;
+    auto &out          = outputs[i];
+    out.resize(std::min(max_len, comp_len * initial_inflate_ratio + 1));
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    strm.next_in  = const_cast<Bytef *>(comp_data);
+    strm.avail_in = comp_len;
+    if (inflateInit2(&strm, -15) != Z_OK) return false;
+    int zerr = Z_OK;
+    while (true) {
+      if (strm.total_out == out.size()) {
+        if (out.size() == max_len) break;
+        out.resize(std::min(max_len, out.size() * 2));
+      }
+      strm.next_out  = reinterpret_cast<uint8_t *>(out.data()) + strm.total_out;
+      strm.avail_out = out.size() - strm.total_out;
+      zerr           = inflate(&strm, Z_NO_FLUSH);
+      if (zerr != Z_OK && !(zerr == Z_BUF_ERROR && strm.avail_out == 0)) break;
+    }
+    out.resize(strm.total_out);
+    auto const done =
+      zerr == Z_STREAM_END && strm.total_in == comp_len && strm.total_out == uncomp_len &&
+      crc32(0, reinterpret_cast<uint8_t const *>(out.data()), uncomp_len) ==
+        read_le32(comp_data + comp_len);
+    inflateEnd(&strm);
+    return done;
+  };
+
+  // Group the members into tasks of similar compressed size; BGZF blocks are small
+  auto const total_size  = members.back().offset + members.back().size;
+  auto const target_size = std::max<size_t>(total_size / (detail::io_thread_pool().size() * 4), 1);
+  std::vector<size_t> group_offsets{0};
+  while (group_offsets.back() < members.size()) {
+    auto end = group_offsets.back() + 1;
+    for (size_t size = members[end - 1].size; end < members.size() && size < target_size; ++end) {
+      size += members[end].size;
+    }
+    group_offsets.push_back(end);
+  }
+  auto const group_results = detail::parallel_transform(group_offsets.size() - 1, [&](size_t g) {
+    for (auto i = group_offsets[g]; i < group_offsets[g + 1]; ++i) {
+      if (!inflate_member(i)) return false;
+    }
+    return true;
+  });
+  if (!std::all_of(group_results.begin(), group_results.end(), [](bool ok) { return ok; })) {
+    return false;
+  }
+
+  std::vector<size_t> out_offsets(members.size() + 1, 0);
+  for (size_t i = 0; i < members.size(); ++i) {
+    out_offsets[i + 1] = out_offsets[i] + outputs[i].size();
+  }
+  dst.resize(out_offsets.back());
+  detail::parallel_for(group_offsets.size() - 1, [&](size_t g) {
+    for (auto i = group_offsets[g]; i < group_offsets[g + 1]; ++i) {
+      memcpy(dst.data() + out_offsets[i], outputs[i].data(), outputs[i].size());
+      outputs[i] = std::vector<char>{};
+    }
+  });
+  return true;
+}
+
+/**
+ * @brief Decompresses the gzip members of the input one after the other
+ *
+ * @param raw Compressed input
+ * @param len Size of the compressed input
+ * @param size_hint Initial size of the output
+ *
+ * @return Decompressed output
+ */
+std::vector<char> inflate_gz_sequential(const uint8_t *raw, size_t len, size_t size_hint)
+{
+  std::vector<char> dst(std::max<size_t>(size_hint, 1));
+  z_stream strm;
+  memset(&strm, 0, sizeof(strm));
+  strm.next_in  = const_cast<Bytef *>(raw);
+  strm.avail_in = len;
+  CUDF_EXPECTS(inflateInit2(&strm, 16 + MAX_WBITS) == Z_OK, "Decompression: error in stream");
+  int zerr = Z_OK;
+  while (true) {
+    if (strm.total_out == dst.size()) {
+      dst.resize(dst.size() + std::min<size_t>(dst.size(), 1 << 30));
+    }
+    strm.next_out  = reinterpret_cast<uint8_t *>(dst.data()) + strm.total_out;
+    strm.avail_out = dst.size() - strm.total_out;
+    zerr           = inflate(&strm, Z_NO_FLUSH);
+    if (zerr == Z_STREAM_END) {
+      // Concatenated members are decompressed into the same output; other trailing data is ignored
+      if (strm.avail_in < 2 || strm.next_in[0] != 0x1f || strm.next_in[1] != 0x8b) break;
+      auto const total_in  = strm.total_in;
+      auto const total_out = strm.total_out;
+      CUDF_EXPECTS(inflateReset(&strm) == Z_OK, "Decompression: error in stream");
+      strm.total_in  = total_in;
+      strm.total_out = total_out;
+    } else if (zerr != Z_OK && !(zerr == Z_BUF_ERROR && strm.avail_out == 0)) {
+      break;
+    }
+  }
+  dst.resize(strm.total_out);
+  inflateEnd(&strm);
+  CUDF_EXPECTS(zerr == Z_STREAM_END, "Decompression: error in stream");
+  return dst;
+}
+
+bool is_bz2_stream_header(const uint8_t *raw, size_t len)
+{
+  return len >= 12 && raw[0] == 'B' && raw[1] == 'Z' && raw[2] == 'h' && raw[3] >= '1' &&
+         raw[3] <= '9';
+}
+
+/**
+ * @brief Decompresses the bzip2 streams of the input one after the other
+ *
+ * @param comp_data Compressed input
+ * @param comp_len Size of the compressed input
+ * @param size_hint Initial size of the output
+ *
+ * @return Decompressed output
+ */
+std::vector<char> bz2_uncompress_sequential(const uint8_t *comp_data,
+                                            size_t comp_len,
+                                            size_t size_hint)
+{
+  std::vector<char> dst(size_hint);
+  size_t dst_ofs    = 0;
+  size_t stream_ofs = 0;
+  do {
+    // Offset in bits of the block to resume from when the output is full
+    uint64_t block_start = 0;
+    int bz_err           = 0;
+    do {
+      size_t dst_len = dst.size() - dst_ofs;
+      bz_err         = cpu_bz2_uncompress(comp_data + stream_ofs,
+                                  comp_len - stream_ofs,
+                                  reinterpret_cast<uint8_t *>(dst.data()) + dst_ofs,
+                                  &dst_len,
+                                  &block_start);
+      dst_ofs += dst_len;
+      if (bz_err == BZ_OUTBUFF_FULL) {
+        // TBD: We could infer the compression ratio based on produced/consumed byte counts
+        // in order to minimize realloc events and over-allocation
+        dst.resize(dst.size() + (dst.size() / 2));
+      }
+    } while (bz_err == BZ_OUTBUFF_FULL);
+    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
+    // Concatenated streams start at the byte following the combined CRC of the previous stream
+    stream_ofs += (block_start + 32 + 7) / 8;
+  } while (stream_ofs < comp_len &&
+           is_bz2_stream_header(comp_data + stream_ofs, comp_len - stream_ofs));
+  dst.resize(dst_ofs);
+  return dst;
+}
+
+/**
+ * @brief Finds the bit offsets of the bzip2 block signatures in the input
+ *
+ * Blocks are not byte-aligned, so every bit offset is checked. Signatures can also appear within
+ * the compressed data; such false matches fail to decompress.
+ */
+std::vector<uint64_t> find_bz2_block_signatures(const uint8_t *raw, size_t len)
+{
+  constexpr uint64_t block_signature = 0x314159265359ull;
+  constexpr uint64_t signature_mask  = (1ull << 48) - 1;
+
+  auto const find_in_range = [raw, len](size_t begin, size_t end) {
+    std::vector<uint64_t> offsets;
+    uint64_t window = 0;
+    for (size_t i = begin; i < std::min(end + 7, len); ++i) {
+      window = (window << 8) | raw[i];
+      if (i < begin + 7) continue;
+      // The window holds the bytes from i - 7 to i; check the signatures starting in byte i - 7
+      for (int bit = 0; bit < 8; ++bit) {
+        if (((window >> (16 - bit)) & signature_mask) == block_signature) {
+          offsets.push_back((i - 7) * 8 + bit);
+        }
+      }
+    }
+    return offsets;
+  };
+
+  auto const num_threads = detail::io_thread_pool().size();
+  auto const range_size  = std::max<size_t>((len + num_threads - 1) / num_threads, 1 << 20);
+  auto const num_ranges  = (len + range_size - 1) / range_size;
+  auto const range_offsets =
+    detail::parallel_transform(num_ranges, [&find_in_range, range_size, len](size_t r) {
+      return find_in_range(r * range_size, std::min((r + 1) * range_size, len));
+    });
+  std::vector<uint64_t> offsets;
+  for (auto const &range : range_offsets) {
+    offsets.insert(offsets.end(), range.begin(), range.end());
+  }
+  return offsets;
+}
+
+/**
+ * @brief Decompresses the blocks of the bzip2 streams of the input in parallel
+ *
+ * Each candidate block is decompressed independently. The blocks of the streams are then followed
+ * from the first stream header, using the end offset of each block; candidates that are not on
+ * this chain are discarded.
+ *
+ * @param comp_data Compressed input
+ * @param comp_len Size of the compressed input
+ * @param[out] dst Decompressed output
+ *
+ * @return Whether all blocks of the streams were found and decompressed
+ */
+bool bz2_uncompress_blocks(const uint8_t *comp_data, size_t comp_len, std::vector<char> &dst)
+{
+  auto const block_offsets = find_bz2_block_signatures(comp_data, comp_len);
+  if (block_offsets.size() < 2) return false;
+
+  struct block_output {
+    int32_t status = BZ_DATA_ERROR;
+    uint64_t end   = 0;
+    std::vector<uint8_t> data;
+  };
+  std::vector<block_output> blocks(block_offsets.size());
+  auto const uncompress_block = [&](size_t i) {
+    auto &block = blocks[i];
+    block.data.resize(9 * 100000);
+    do {
+      size_t dst_len = block.data.size();
+      block.status   = cpu_bz2_uncompress_block(
+        comp_data, comp_len, block_offsets[i], block.data.data(), &dst_len, &block.end);
+      block.data.resize(dst_len);
+    } while (block.status == BZ_OUTBUFF_FULL);
+  };
+  detail::parallel_for(blocks.size(), uncompress_block);
+
+  // Follow the blocks of each stream, from the block that follows the 4-byte stream header
+  std::vector<size_t> chain;
+  uint64_t block_start = 32;
+  while (true) {
+    auto const it = std::lower_bound(block_offsets.begin(), block_offsets.end(), block_start);
+    if (it == block_offsets.end() || *it != block_start) return false;
+    auto const &block = blocks[it - block_offsets.begin()];
+    if (block.status != BZ_OK && block.status != BZ_STREAM_END) return false;
+    chain.push_back(it - block_offsets.begin());
+    if (block.status == BZ_OK) {
+      block_start = block.end;
+      continue;
+    }
+    // Concatenated streams start at the byte following the combined CRC of the previous stream
+    auto const stream_ofs = (block.end + 32 + 7) / 8;
+    if (stream_ofs >= comp_len ||
+        !is_bz2_stream_header(comp_data + stream_ofs, comp_len - stream_ofs)) {
+      break;
+    }
+    block_start = stream_ofs * 8 + 32;
+  }
+
+  size_t total_size = 0;
+  for (auto const i : chain) {
+    total_size += blocks[i].data.size();
+  }
+  dst.resize(total_size);
+  size_t dst_ofs = 0;
+  for (auto const i : chain) {
+    memcpy(dst.data() + dst_ofs, blocks[i].data.data(), blocks[i].data.size());
+    dst_ofs += blocks[i].data.size();
+  }
+  return true;
+}
+
+}  // namespace
+
 /**
  * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
  *
@@ -375,7 +813,16 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
                                        // ~4:1 compression for initial size
   }
 
-  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP || stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_GZIP) {
+    // Multi-member inputs, such as BGZF files, are decompressed one member per task
+    if (src_size >= parallel_decompression_min_size) {
+      auto const members = find_gz_members(raw, src_size);
+      std::vector<char> dst;
+      if (members.size() > 1 && inflate_gz_members(raw, members, dst)) { return dst; }
+    }
+    return inflate_gz_sequential(raw, src_size, uncomp_len);
+  }
+  if (stream_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
     // INFLATE
     std::vector<char> dst(uncomp_len);
     CUDF_EXPECTS(cpu_inflate_vector(dst, comp_data, comp_len) == 0,
@@ -383,28 +830,12 @@ std::vector<char> io_uncompress_single_h2d(const void *src, size_t src_size, int
     return dst;
   }
   if (stream_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    std::vector<char> dst(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, reinterpret_cast<uint8_t *>(dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
-    return dst;
+    // Blocks are decompressed one per task
+    if (comp_len >= parallel_decompression_min_size) {
+      std::vector<char> dst;
+      if (bz2_uncompress_blocks(comp_data, comp_len, dst)) { return dst; }
+    }
+    return bz2_uncompress_sequential(comp_data, comp_len, uncomp_len);
   }
 
   CUDF_FAIL("Unsupported compressed stream type");
@@ -435,6 +866,118 @@ std::vector<char> get_uncompressed_data(host_span<char const> const data,
   return io_uncompress_single_h2d(data.data(), data.size(), comp_type);
 }
 
+/**
+ * @brief Incremental decompressor for gzip inputs, including concatenated members
+ */
+class host_stream_decompressor_gzip : public host_stream_decompressor {
+ public:
+  explicit host_stream_decompressor_gzip(host_span<char const> src)
+  {
+    memset(&strm, 0, sizeof(strm));
+    strm.next_in  = reinterpret_cast<Bytef *>(const_cast<char *>(src.data()));
+    strm.avail_in = src.size();
+    CUDF_EXPECTS(inflateInit2(&strm, 16 + MAX_WBITS) == Z_OK, "Decompression: error in stream");
+  }
+
+  ~host_stream_decompressor_gzip() override { inflateEnd(&strm); }
+
+  size_t read(host_span<char> dst) override
+  {
+    size_t dst_ofs = 0;
+    while (!done && dst_ofs < dst.size()) {
+      strm.next_out  = reinterpret_cast<Bytef *>(dst.data()) + dst_ofs;
+      strm.avail_out = dst.size() - dst_ofs;
+      auto const zerr = inflate(&strm, Z_NO_FLUSH);
+      dst_ofs         = dst.size() - strm.avail_out;
+      if (zerr == Z_STREAM_END) {
+        // Concatenated members are part of the output; other trailing data is ignored
+        done = strm.avail_in < 2 || strm.next_in[0] != 0x1f || strm.next_in[1] != 0x8b;
+        if (!done) {
+          CUDF_EXPECTS(inflateReset(&strm) == Z_OK, "Decompression: error in stream");
+        }
+      } else {
+        CUDF_EXPECTS(zerr == Z_OK || (zerr == Z_BUF_ERROR && strm.avail_out == 0),
+                     "Decompression: error in stream");
+      }
+    }
+    return dst_ofs;
+  }
+
+ private:
+  z_stream strm;
+  bool done = false;
+};
+
+/**
+ * @brief Incremental decompressor for bzip2 inputs, including concatenated streams
+ *
+ * Decompresses one block at a time; blocks have at most 900KB of compressed data.
+ */
+class host_stream_decompressor_bz2 : public host_stream_decompressor {
+ public:
+  explicit host_stream_decompressor_bz2(host_span<char const> src)
+    : comp_data(reinterpret_cast<const uint8_t *>(src.data())), comp_len(src.size())
+  {
+    CUDF_EXPECTS(is_bz2_stream_header(comp_data, comp_len), "Decompression: error in stream");
+  }
+
+  size_t read(host_span<char> dst) override
+  {
+    size_t dst_ofs = 0;
+    while (dst_ofs < dst.size()) {
+      if (block_pos == block.size()) {
+        if (done) break;
+        decompress_next_block();
+        continue;
+      }
+      auto const len = std::min(block.size() - block_pos, dst.size() - dst_ofs);
+      memcpy(dst.data() + dst_ofs, block.data() + block_pos, len);
+      block_pos += len;
+      dst_ofs += len;
+    }
+    return dst_ofs;
+  }
+
+ private:
+  void decompress_next_block()
+  {
+    int32_t bz_err     = BZ_OK;
+    uint64_t block_end = 0;
+    block.resize(9 * 100000);
+    do {
+      size_t dst_len = block.size();
+      bz_err         = cpu_bz2_uncompress_block(
+        comp_data, comp_len, block_start, block.data(), &dst_len, &block_end);
+      block.resize(dst_len);
+    } while (bz_err == BZ_OUTBUFF_FULL);
+    CUDF_EXPECTS(bz_err == BZ_OK || bz_err == BZ_STREAM_END, "Decompression: error in stream");
+    block_pos   = 0;
+    block_start = block_end;
+    if (bz_err == BZ_STREAM_END) {
+      // Concatenated streams start at the byte following the combined CRC of the previous stream
+      auto const stream_ofs = (block_end + 32 + 7) / 8;
+      block_start           = stream_ofs * 8 + 32;
+      done                  = stream_ofs >= comp_len ||
+             !is_bz2_stream_header(comp_data + stream_ofs, comp_len - stream_ofs);
+    }
+  }
+
+  const uint8_t *comp_data;
+  size_t comp_len;
+  uint64_t block_start = 32;  // Offset in bits of the next block, after the stream header
+  std::vector<uint8_t> block;
+  size_t block_pos = 0;
+  bool done        = false;
+};
+
+std::unique_ptr<host_stream_decompressor> host_stream_decompressor::create(
+  host_span<char const> src, std::string const &compression)
+{
+  if (compression == "gzip") { return std::make_unique<host_stream_decompressor_gzip>(src); }
+  if (compression == "bz2") { return std::make_unique<host_stream_decompressor_bz2>(src); }
+  return nullptr;
+}
+
 /**
  * @Brief ZLIB host decompressor class
  */
@@ -557,6 +1100,30 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/**
+ * @Brief Host decompressor class for the codecs decoded with Arrow (ZSTD, raw LZ4 blocks)
+ */
+class HostDecompressor_ARROW : public HostDecompressor {
+ public:
+  HostDecompressor_ARROW(arrow::Compression::type type)
+  {
+    auto result = arrow::util::Codec::Create(type);
+    CUDF_EXPECTS(result.ok(), "Cannot create host codec: " + result.status().ToString());
+    codec = std::move(result).ValueOrDie();
+  }
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    auto const result = codec->Decompress(srcLen, srcBytes, dstLen, dstBytes);
+    return result.ok() ? *result : 0;
+  }
+
+ private:
+  std::unique_ptr<arrow::util::Codec> codec;
+};
+
 /**
  * @Brief CPU decompression class
  *
@@ -570,6 +1137,10 @@ std::unique_ptr<HostDecompressor> HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: return std::make_unique<HostDecompressor_ZLIB>(true);
     case IO_UNCOMP_STREAM_TYPE_INFLATE: return std::make_unique<HostDecompressor_ZLIB>(false);
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: return std::make_unique<HostDecompressor_SNAPPY>();
+    case IO_UNCOMP_STREAM_TYPE_LZ4:
+      return std::make_unique<HostDecompressor_ARROW>(arrow::Compression::LZ4);
+    case IO_UNCOMP_STREAM_TYPE_ZSTD:
+      return std::make_unique<HostDecompressor_ARROW>(arrow::Compression::ZSTD);
   }
   CUDF_FAIL("Unsupported compression type");
 }
@@ -146,6 +146,99 @@ __device__ __inline__ bool is_floatingpoint(
   return true;
 }
 
+/*
+ * @brief Counts a field in the type histogram of its column.
+ *
+ * @param opts A set of parsing options
+ * @param field_begin Pointer to the first character of the field
+ * @param field_end Pointer to the character past the end of the field
+ * @param flags Parsing behavior flags of the column
+ * @param stats The count for each column data type
+ */
+__device__ __inline__ void count_field_type(parse_options_view const &opts,
+                                            char const *field_begin,
+                                            char const *field_end,
+                                            column_parse::flags flags,
+                                            column_type_histogram &stats)
+{
+  // points to last character in the field
+  auto const field_len = static_cast<size_t>(field_end - field_begin);
+  if (serialized_trie_contains(opts.trie_na, {field_begin, field_len})) {
+    atomicAdd(&stats.null_count, 1);
+  } else if (serialized_trie_contains(opts.trie_true, {field_begin, field_len}) ||
+             serialized_trie_contains(opts.trie_false, {field_begin, field_len})) {
+    atomicAdd(&stats.bool_count, 1);
+  } else if (cudf::io::is_infinity(field_begin, field_end)) {
+    atomicAdd(&stats.float_count, 1);
+  } else {
+    long countNumber   = 0;
+    long countDecimal  = 0;
+    long countSlash    = 0;
+    long countDash     = 0;
+    long countPlus     = 0;
+    long countColon    = 0;
+    long countString   = 0;
+    long countExponent = 0;
+
+    // Modify the field range to ignore whitespace and quotechars
+    // This could possibly result in additional empty fields
+    auto const trimmed_field_range = trim_whitespaces_quotes(field_begin, field_end);
+    auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
+
+    for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
+      if (is_digit(*cur)) {
+        countNumber++;
+        continue;
+      }
+      // Looking for unique characters that will help identify column types.
+      switch (*cur) {
+        case '.': countDecimal++; break;
+        case '-': countDash++; break;
+        case '+': countPlus++; break;
+        case '/': countSlash++; break;
+        case ':': countColon++; break;
+        case 'e':
+        case 'E':
+          if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
+            countExponent++;
+          break;
+        default: countString++; break;
+      }
+    }
+
+    // Integers have to have the length of the string
+    // Off by one if they start with a minus sign
+    auto const int_req_number_cnt =
+      trimmed_field_len -
+      ((*trimmed_field_range.first == '-' || *trimmed_field_range.first == '+') &&
+       trimmed_field_len > 1);
+
+    if (flags & column_parse::as_datetime) {
+      // PANDAS uses `object` dtype if the date is unparseable
+      if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
+        atomicAdd(&stats.datetime_count, 1);
+      } else {
+        atomicAdd(&stats.string_count, 1);
+      }
+    } else if (countNumber == int_req_number_cnt) {
+      auto const is_negative = (*trimmed_field_range.first == '-');
+      auto const data_begin =
+        trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
+      cudf::size_type *ptr = cudf::io::gpu::infer_integral_field_counter(
+        data_begin, data_begin + countNumber, is_negative, stats);
+      atomicAdd(ptr, 1);
+    } else if (is_floatingpoint(trimmed_field_len,
+                                countNumber,
+                                countDecimal,
+                                countDash + countPlus,
+                                countExponent)) {
+      atomicAdd(&stats.float_count, 1);
+    } else {
+      atomicAdd(&stats.string_count, 1);
+    }
+  }
+}
+
 /*
  * @brief CUDA kernel that parses and converts CSV data into cuDF column data.
  *
@@ -189,81 +282,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
 
     // Checking if this is a column that the user wants --- user can filter columns
     if (column_flags[col] & column_parse::enabled) {
-      // points to last character in the field
-      auto const field_len = static_cast<size_t>(next_delimiter - field_start);
-      if (serialized_trie_contains(opts.trie_na, {field_start, field_len})) {
-        atomicAdd(&d_columnData[actual_col].null_count, 1);
-      } else if (serialized_trie_contains(opts.trie_true, {field_start, field_len}) ||
-                 serialized_trie_contains(opts.trie_false, {field_start, field_len})) {
-        atomicAdd(&d_columnData[actual_col].bool_count, 1);
-      } else if (cudf::io::is_infinity(field_start, next_delimiter)) {
-        atomicAdd(&d_columnData[actual_col].float_count, 1);
-      } else {
-        long countNumber   = 0;
-        long countDecimal  = 0;
-        long countSlash    = 0;
-        long countDash     = 0;
-        long countPlus     = 0;
-        long countColon    = 0;
-        long countString   = 0;
-        long countExponent = 0;
-
-        // Modify field_start & end to ignore whitespace and quotechars
-        // This could possibly result in additional empty fields
-        auto const trimmed_field_range = trim_whitespaces_quotes(field_start, next_delimiter);
-        auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
-
-        for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
-          if (is_digit(*cur)) {
-            countNumber++;
-            continue;
-          }
-          // Looking for unique characters that will help identify column types.
-          switch (*cur) {
-            case '.': countDecimal++; break;
-            case '-': countDash++; break;
-            case '+': countPlus++; break;
-            case '/': countSlash++; break;
-            case ':': countColon++; break;
-            case 'e':
-            case 'E':
-              if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
-                countExponent++;
-              break;
-            default: countString++; break;
-          }
-        }
-
-        // Integers have to have the length of the string
-        // Off by one if they start with a minus sign
-        auto const int_req_number_cnt = trimmed_field_len - ((*trimmed_field_range.first == '-' ||
-                                                              *trimmed_field_range.first == '+') &&
-                                                             trimmed_field_len > 1);
-
-        if (column_flags[col] & column_parse::as_datetime) {
-          // PANDAS uses `object` dtype if the date is unparseable
-          if (is_datetime(countString, countDecimal, countColon, countDash, countSlash)) {
-            atomicAdd(&d_columnData[actual_col].datetime_count, 1);
-          } else {
-            atomicAdd(&d_columnData[actual_col].string_count, 1);
-          }
-        } else if (countNumber == int_req_number_cnt) {
-          auto const is_negative = (*trimmed_field_range.first == '-');
-          auto const data_begin =
-            trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
-          cudf::size_type *ptr = cudf::io::gpu::infer_integral_field_counter(
-            data_begin, data_begin + countNumber, is_negative, d_columnData[actual_col]);
-          atomicAdd(ptr, 1);
-        } else if (is_floatingpoint(trimmed_field_len,
-                                    countNumber,
-                                    countDecimal,
-                                    countDash + countPlus,
-                                    countExponent)) {
-          atomicAdd(&d_columnData[actual_col].float_count, 1);
-        } else {
-          atomicAdd(&d_columnData[actual_col].string_count, 1);
-        }
-      }
+      count_field_type(
+        opts, field_start, next_delimiter, column_flags[col], d_columnData[actual_col]);
       actual_col++;
     }
     next_field  = next_delimiter + 1;
@@ -529,6 +549,7 @@ struct decode_op {
  * @param[out] data The output column data
  * @param[out] valid The bitmaps indicating whether column fields are valid
  * @param[out] num_valid The numbers of valid fields in columns
+ * @param[out] column_stats The count for each data type of the non-string columns, if not empty
  */
 __global__ void __launch_bounds__(csvparse_block_dim)
   convert_csv_to_cudf(cudf::io::parse_options_view options,
@@ -537,7 +558,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
                       device_span<uint64_t const> row_offsets,
                       device_span<cudf::data_type const> dtypes,
                       device_span<void *> columns,
-                      device_span<cudf::bitmask_type *> valids)
+                      device_span<cudf::bitmask_type *> valids,
+                      device_span<column_type_histogram> column_stats)
 {
   auto const raw_csv = data.data();
   // thread IDs range per block, so also need the block id.
@@ -560,6 +582,11 @@ __global__ void __launch_bounds__(csvparse_block_dim)
     auto next_delimiter = cudf::io::gpu::seek_field_end(next_field, row_end, options);
 
     if (column_flags[col] & column_parse::enabled) {
+      // Verify the types inferred from a sample while the data is decoded
+      if (!column_stats.empty() && dtypes[actual_col].id() != cudf::type_id::STRING) {
+        count_field_type(
+          options, field_start, next_delimiter, column_flags[col], column_stats[actual_col]);
+      }
       // check if the entire field is a NaN string - consistent with pandas
       auto const is_valid = !serialized_trie_contains(
         options.trie_na, {field_start, static_cast<size_t>(next_delimiter - field_start)});
@@ -1034,6 +1061,7 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const &options
                                      device_span<cudf::data_type const> const dtypes,
                                      device_span<void *> const columns,
                                      device_span<cudf::bitmask_type *> const valids,
+                                     device_span<column_type_histogram> const column_stats,
                                      rmm::cuda_stream_view stream)
 {
   // Calculate actual block count to use based on records count
@@ -1042,7 +1070,7 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const &options
   auto const grid_size  = (num_rows + block_size - 1) / block_size;
 
   convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_offsets, dtypes, columns, valids);
+    options, data, column_flags, row_offsets, dtypes, columns, valids, column_stats);
 }
 
 uint32_t __host__ gather_row_offsets(const parse_options_view &options,
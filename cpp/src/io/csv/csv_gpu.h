@@ -217,6 +217,8 @@ thrust::host_vector<column_type_histogram> detect_column_types(
  * @param[in] dtypes List of dtype corresponding to each column
  * @param[out] columns Device memory output of column data
  * @param[out] valids Device memory output of column valids bitmap data
+ * @param[out] column_stats Histogram of each dtypes' occurrence for each non-string column;
+ * not computed if empty
  * @param[in] stream CUDA stream to use, default 0
  */
 void decode_row_column_data(cudf::io::parse_options_view const &options,
@@ -226,6 +228,7 @@ void decode_row_column_data(cudf::io::parse_options_view const &options,
                             device_span<cudf::data_type const> dtypes,
                             device_span<void *> columns,
                             device_span<cudf::bitmask_type *> valids,
+                            device_span<column_type_histogram> column_stats,
                             rmm::cuda_stream_view stream);
 
 }  // namespace gpu
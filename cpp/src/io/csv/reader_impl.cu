@@ -23,8 +23,13 @@
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/string_dictionary.hpp>
+#include <io/utilities/thread_pool.hpp>
 #include <io/utilities/type_conversion.cuh>
 
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/strings/replace.hpp>
 #include <cudf/table/table.hpp>
@@ -32,9 +37,22 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/device_ptr.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/remove.h>
 
 #include <algorithm>
+#include <cstring>
+#include <deque>
 #include <iostream>
+#include <mutex>
 #include <numeric>
 #include <tuple>
 #include <unordered_map>
@@ -182,6 +200,8 @@ std::vector<std::string> setColumnNames(std::vector<char> const &header,
 
 table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
 {
+  if (sources_.size() > 1) { return read_sources(stream); }
+
   auto range_offset  = opts_.get_byte_range_offset();
   auto range_size    = opts_.get_byte_range_size();
   auto skip_rows     = opts_.get_skiprows();
@@ -200,20 +220,21 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
 
   // Support delayed opening of the file if using memory mapping datasource
   // This allows only mapping of a subset of the file if using byte range
-  if (source_ == nullptr) {
-    assert(!filepath_.empty());
-    source_ = datasource::create(filepath_, range_offset, map_range_size);
+  auto &source = sources_[0];
+  if (source == nullptr) {
+    assert(!filepaths_.empty());
+    source = datasource::create(filepaths_[0], range_offset, map_range_size);
   }
 
   // Return an empty dataframe if no data and no column metadata to process
-  if (source_->is_empty() && (opts_.get_names().empty() || opts_.get_dtypes().empty())) {
+  if (source->is_empty() && (opts_.get_names().empty() || opts_.get_dtypes().empty())) {
     return {std::make_unique<table>(), {}};
   }
 
   // Transfer source data to GPU
-  if (!source_->is_empty()) {
-    auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
-    auto buffer    = source_->host_read(range_offset, data_size);
+  if (!source->is_empty()) {
+    auto data_size = (map_range_size != 0) ? map_range_size : source->size();
+    auto buffer    = source->host_read(range_offset, data_size);
 
     auto h_data = host_span<char const>(  //
       reinterpret_cast<const char *>(buffer->data()),
@@ -222,6 +243,10 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
     std::vector<char> h_uncomp_data_owner;
 
     if (compression_type_ != "none") {
+      if (opts_.get_decompression_window_size() != 0 && skip_end_rows <= 0) {
+        auto decompressor = host_stream_decompressor::create(h_data, compression_type_);
+        if (decompressor != nullptr) { return read_windows(*decompressor, stream); }
+      }
       h_uncomp_data_owner = get_uncompressed_data(h_data, compression_type_);
       h_data              = h_uncomp_data_owner;
     }
@@ -243,6 +268,7 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
                        (skip_rows > 0) ? skip_rows : 0,
                        num_rows,
                        load_whole_file,
+                       (opts_.get_header() >= 0) ? opts_.get_header() + 1 : 0,
                        stream);
 
     // Exclude the rows that are to be skipped from the end
@@ -257,6 +283,334 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
     num_records_ = 0;
   }
 
+  select_columns();
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
+
+  auto column_types = gather_column_types(stream);
+  return make_table(column_types, stream);
+}
+
+namespace {
+template <typename T>
+using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
+
+/**
+ * @brief Uncompressed size of a source, and its data if it was decompressed.
+ */
+struct loaded_source {
+  std::vector<char> uncompressed;  // Empty if the source is read directly
+  size_t size           = 0;       // Size of the uncompressed data
+  bool needs_terminator = false;   // Whether the data does not end with a row terminator
+};
+}  // namespace
+
+table_with_metadata reader::impl::read_sources(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(opts_.get_byte_range_offset() == 0 && opts_.get_byte_range_size() == 0,
+               "Reading multiple sources using `byte range` is unsupported");
+  CUDF_EXPECTS(opts_.get_skiprows() <= 0 && opts_.get_skipfooter() <= 0,
+               "Reading multiple sources using `skiprows` or `skipfooter` is unsupported");
+  auto const num_rows = opts_.get_nrows();
+
+  // Open the sources concurrently; only the last character of the uncompressed sources is read at
+  // this point
+  std::vector<std::string> compression(sources_.size());
+  auto loaded = parallel_transform(sources_.size(), [this, &compression](size_t i) {
+    auto &source = sources_[i];
+    if (source == nullptr) { source = datasource::create(filepaths_[i]); }
+    loaded_source result;
+    if (source->is_empty()) { return result; }
+
+    compression[i] = source_compression_type(i);
+    if (compression[i] == "none") {
+      char last_char = 0;
+      result.size    = source->size();
+      source->host_read(result.size - 1, 1, reinterpret_cast<uint8_t *>(&last_char));
+      result.needs_terminator = last_char != opts.terminator;
+    }
+    return result;
+  });
+
+  // Compressed sources are decompressed one at a time on this thread rather than in the tasks
+  // above, so that the members or blocks of each large source are decompressed on the whole pool
+  for (size_t i = 0; i < sources_.size(); ++i) {
+    if (compression[i].empty() || compression[i] == "none") { continue; }
+    auto &result        = loaded[i];
+    auto const buffer   = sources_[i]->host_read(0, sources_[i]->size());
+    result.uncompressed = get_uncompressed_data(
+      {reinterpret_cast<char const *>(buffer->data()), buffer->size()}, compression[i]);
+    result.size             = result.uncompressed.size();
+    result.needs_terminator = result.size != 0 && result.uncompressed.back() != opts.terminator;
+  }
+
+  // The sources are laid out back to back in a pinned arena, each ending with a row terminator so
+  // that no row spans two sources
+  std::vector<size_t> arena_offsets;
+  std::vector<uint64_t> source_starts;  // Start of each non-empty source but the first
+  size_t arena_size = 0;
+  for (auto const &source : loaded) {
+    arena_offsets.push_back(arena_size);
+    if (source.size != 0 && arena_size != 0) { source_starts.push_back(arena_size); }
+    arena_size += source.size + source.needs_terminator;
+  }
+  if (arena_size == 0 && (opts_.get_names().empty() || opts_.get_dtypes().empty())) {
+    return {std::make_unique<table>(), {}};
+  }
+
+  if (arena_size != 0) {
+    pinned_buffer<char> arena{[](size_t size) {
+                                char *ptr = nullptr;
+                                CUDA_TRY(cudaMallocHost(&ptr, size));
+                                return ptr;
+                              }(arena_size),
+                              cudaFreeHost};
+    // Uncompressed sources are read directly into the arena
+    parallel_transform(sources_.size(), [&](size_t i) {
+      auto const dst = arena.get() + arena_offsets[i];
+      auto const len = loaded[i].size;
+      if (!loaded[i].uncompressed.empty()) {
+        std::memcpy(dst, loaded[i].uncompressed.data(), len);
+      } else if (len != 0) {
+        sources_[i]->host_read(0, len, reinterpret_cast<uint8_t *>(dst));
+      }
+      if (loaded[i].needs_terminator) { dst[len] = opts.terminator; }
+      return len;
+    });
+
+    // The rows of all sources are found in one pass over the arena; the header rows of the first
+    // source are removed there, and those of the other sources are found from their start
+    size_t const header_rows = (opts_.get_header() >= 0) ? opts_.get_header() + 1 : 0;
+    gather_row_offsets({arena.get(), arena_size}, 0, arena_size, 0, -1, true, header_rows, stream);
+    if (header_rows > 0 && !source_starts.empty()) {
+      remove_source_headers(source_starts, header_rows, stream);
+    }
+    if (num_rows >= 0) {
+      row_offsets_.resize(std::min<size_t>(row_offsets_.size(), num_rows + 1));
+    }
+    num_records_ = row_offsets_.size();
+    num_records_ -= (num_records_ > 0);
+  } else {
+    num_records_ = 0;
+  }
+
+  select_columns();
+
+  // Return empty table rather than exception if nothing to load
+  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
+
+  auto column_types = gather_column_types(stream);
+  return make_table(column_types, stream);
+}
+
+void reader::impl::remove_source_headers(host_span<uint64_t const> source_starts,
+                                         size_t header_rows,
+                                         rmm::cuda_stream_view stream)
+{
+  if (row_offsets_.size() < 2) { return; }
+  // The last offset is the end of the data rather than the start of a row
+  auto const num_rows    = row_offsets_.size() - 1;
+  auto const num_sources = source_starts.size();
+
+  // Every source starts a new row, so its first row is the first one at or after its start
+  auto const d_source_starts = cudf::detail::make_device_uvector_async(source_starts, stream);
+  rmm::device_uvector<size_t> first_rows(num_sources, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      row_offsets_.begin(),
+                      row_offsets_.begin() + num_rows,
+                      d_source_starts.begin(),
+                      d_source_starts.end(),
+                      first_rows.begin());
+
+  rmm::device_uvector<bool> is_header(row_offsets_.size(), stream);
+  thrust::fill(rmm::exec_policy(stream), is_header.begin(), is_header.end(), false);
+  thrust::for_each(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_t>(0),
+    thrust::make_counting_iterator<size_t>(num_sources),
+    [first_rows  = first_rows.data(),
+     is_header   = is_header.data(),
+     row_offsets = row_offsets_.data().get(),
+     data        = data_.data().get(),
+     terminator  = opts.terminator,
+     num_sources,
+     num_rows,
+     header_rows] __device__(size_t idx) {
+      auto const end_row    = (idx + 1 < num_sources) ? first_rows[idx + 1] : num_rows;
+      auto const header_end = thrust::min(first_rows[idx] + header_rows, end_row);
+      for (auto row = first_rows[idx]; row < header_end; ++row) {
+        is_header[row] = true;
+      }
+      // Blank out the header, so that the last row of the previous source does not extend into it
+      for (auto pos = row_offsets[first_rows[idx]]; pos < row_offsets[header_end]; ++pos) {
+        data[pos] = terminator;
+      }
+    });
+
+  auto const offsets_end = thrust::remove_if(rmm::exec_policy(stream),
+                                             row_offsets_.begin(),
+                                             row_offsets_.end(),
+                                             is_header.begin(),
+                                             thrust::identity<bool>());
+  row_offsets_.resize(offsets_end - row_offsets_.begin());
+}
+
+std::string reader::impl::source_compression_type(size_t source_idx) const
+{
+  return infer_compression_type(opts_.get_compression(),
+                                (source_idx < filepaths_.size()) ? filepaths_[source_idx] : "",
+                                {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
+}
+
+table_with_metadata reader::impl::read_windows(host_stream_decompressor &decompressor,
+                                               rmm::cuda_stream_view stream)
+{
+  auto const window_size = opts_.get_decompression_window_size();
+  window_state state(opts_);
+
+  auto result = read_window(decompressor, window_size, state, stream);
+  std::vector<std::vector<std::unique_ptr<column>>> window_columns;
+  while (!state.is_last_window) {
+    auto window_table = read_window(decompressor, window_size, state, stream).tbl;
+    if (window_table->num_rows() != 0) { window_columns.push_back(window_table->release()); }
+  }
+  if (window_columns.empty()) { return result; }
+
+  // The parts of each column are freed as soon as they are concatenated, so that the peak memory
+  // use is the output plus one column instead of twice the output
+  auto columns = result.tbl->release();
+  for (size_t col = 0; col < columns.size(); ++col) {
+    std::vector<column_view> parts{columns[col]->view()};
+    for (auto const &window : window_columns) {
+      parts.push_back(window[col]->view());
+    }
+    columns[col] = cudf::detail::concatenate(parts, stream, mr_);
+    for (auto &window : window_columns) {
+      window[col].reset();
+    }
+  }
+  result.tbl = std::make_unique<table>(std::move(columns));
+  return result;
+}
+
+table_with_metadata reader::impl::read_window(host_stream_decompressor &input,
+                                              size_t window_size,
+                                              window_state &state,
+                                              rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(!state.is_last_window, "No data left to read");
+  auto &window = state.window;
+  while (true) {
+    // Append the next part of the decompressed data to the rows carried over from the last window
+    auto const carry_size = window.size();
+    window.resize(carry_size + window_size);
+    auto const len = input.read({window.data() + carry_size, window_size});
+    window.resize(carry_size + len);
+    state.is_last_window = len < window_size;
+
+    // Unless this is the last window, the last row may be incomplete; it is carried over to the
+    // next window, so look for one more row than needed
+    auto const num_rows   = state.num_rows;
+    auto const buffer_pos = gather_row_offsets(window,
+                                               0,
+                                               window.size(),
+                                               state.skip_rows,
+                                               (num_rows >= 0 && !state.is_last_window)
+                                                 ? num_rows + 1
+                                                 : num_rows,
+                                               true,
+                                               state.header_rows,
+                                               stream);
+    if (!state.is_last_window) {
+      if (num_rows >= 0 && row_offsets_.size() == static_cast<size_t>(num_rows) + 2) {
+        // All requested rows are complete
+        row_offsets_.resize(num_rows + 1);
+        state.is_last_window = true;
+      } else if (row_offsets_.size() < 3) {
+        // No complete row yet; parse the window again once more data is appended
+        continue;
+      } else {
+        uint64_t carry_start = 0;
+        CUDA_TRY(cudaMemcpyAsync(&carry_start,
+                                 row_offsets_.data().get() + row_offsets_.size() - 2,
+                                 sizeof(uint64_t),
+                                 cudaMemcpyDeviceToHost,
+                                 stream.value()));
+        stream.synchronize();
+        row_offsets_.resize(row_offsets_.size() - 1);
+        window.erase(window.begin(), window.begin() + buffer_pos + carry_start);
+      }
+    }
+    break;
+  }
+  num_records_ = row_offsets_.size();
+  num_records_ -= (num_records_ > 0);
+  if (state.num_rows >= 0) { state.num_rows -= num_records_; }
+
+  if (state.is_first_window) {
+    // The header and skipped rows are in the first window
+    state.skip_rows       = 0;
+    state.header_rows     = 0;
+    state.is_first_window = false;
+    select_columns();
+    if (num_active_cols_ == 0) {
+      state.is_last_window = true;
+      return {std::make_unique<table>(), {}};
+    }
+    // Types that are not specified are inferred from the first window only
+    state.column_types = gather_column_types(stream);
+  }
+  return make_table(state.column_types, stream);
+}
+
+namespace {
+/**
+ * @brief Reads the data of an uncompressed datasource in order.
+ */
+class source_stream : public host_stream_decompressor {
+ public:
+  explicit source_stream(datasource &source) : source_(source) {}
+
+  size_t read(host_span<char> dst) override
+  {
+    auto const len = std::min(dst.size(), source_.size() - offset_);
+    if (len != 0) {
+      source_.host_read(offset_, len, reinterpret_cast<uint8_t *>(dst.data()));
+      offset_ += len;
+    }
+    return len;
+  }
+
+ private:
+  datasource &source_;
+  size_t offset_ = 0;
+};
+}  // namespace
+
+std::unique_ptr<host_stream_decompressor> reader::impl::open_window_stream(
+  std::unique_ptr<datasource::buffer> &compressed_data)
+{
+  auto &source = sources_[0];
+  if (source == nullptr) {
+    assert(!filepaths_.empty());
+    source = datasource::create(filepaths_[0]);
+  }
+  if (source->is_empty()) { return nullptr; }
+
+  // Uncompressed data is read from the source one window at a time
+  if (compression_type_ == "none") { return std::make_unique<source_stream>(*source); }
+
+  compressed_data   = source->host_read(0, source->size());
+  auto decompressor = host_stream_decompressor::create(
+    {reinterpret_cast<char const *>(compressed_data->data()), compressed_data->size()},
+    compression_type_);
+  CUDF_EXPECTS(decompressor != nullptr, "Compression format cannot be read in chunks");
+  return decompressor;
+}
+
+void reader::impl::select_columns()
+{
   // Check if the user gave us a list of column names
   if (not opts_.get_names().empty()) {
     h_column_flags_.resize(opts_.get_names().size(), column_parse::enabled);
@@ -329,22 +683,42 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
       }
     }
   }
+}
 
-  // Return empty table rather than exception if nothing to load
-  if (num_active_cols_ == 0) { return {std::make_unique<table>(), {}}; }
-
-  auto metadata     = table_metadata{};
-  auto out_columns  = std::vector<std::unique_ptr<cudf::column>>();
-  auto column_types = gather_column_types(stream);
+table_with_metadata reader::impl::make_table(std::vector<data_type> &column_types,
+                                             rmm::cuda_stream_view stream)
+{
+  auto metadata    = table_metadata{};
+  auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
 
   out_columns.reserve(column_types.size());
 
   if (num_records_ != 0) {
-    auto out_buffers = decode_data(column_types, stream);
+    rmm::device_vector<column_type_histogram> d_column_stats(
+      verify_column_types_ ? column_types.size() : 0, column_type_histogram{});
+    auto out_buffers = decode_data(column_types, d_column_stats, stream);
+    if (verify_column_types_) {
+      verify_column_types_ = false;
+      promote_column_types(column_types,
+                           thrust::host_vector<column_type_histogram>(d_column_stats),
+                           out_buffers,
+                           stream);
+    }
     for (size_t i = 0; i < column_types.size(); ++i) {
       metadata.column_names.emplace_back(out_buffers[i].name);
-      if (column_types[i].id() == type_id::STRING && opts.quotechar != '\0' &&
-          opts.doublequote == true) {
+      if (column_types[i].id() == type_id::STRING && is_dictionary_column(out_buffers[i].name)) {
+        auto col = encode_strings(*out_buffers[i]._strings, stream, mr_);
+        if (opts.quotechar != '\0' && opts.doublequote == true) {
+          // Only the distinct values need to have their doubled quotechars reduced
+          const std::string quotechar(1, opts.quotechar);
+          const std::string dblquotechar(2, opts.quotechar);
+          auto const keys = cudf::strings::replace(
+            dictionary_column_view(col->view()).keys(), dblquotechar, quotechar, -1);
+          col = replace_dictionary_keys(col->view(), keys->view(), stream, mr_);
+        }
+        out_columns.emplace_back(std::move(col));
+      } else if (column_types[i].id() == type_id::STRING && opts.quotechar != '\0' &&
+                 opts.doublequote == true) {
         // PANDAS' default behavior of enabling doublequote for two consecutive
         // quotechars in quoted fields results in reduction to a single quotechar
         // TODO: Would be much more efficient to perform this operation in-place
@@ -359,20 +733,32 @@ table_with_metadata reader::impl::read(rmm::cuda_stream_view stream)
       }
     }
   } else {
-    // Create empty columns
-    for (size_t i = 0; i < column_types.size(); ++i) {
-      out_columns.emplace_back(make_empty_column(column_types[i]));
-    }
     // Handle empty metadata
     for (int col = 0; col < num_actual_cols_; ++col) {
       if (h_column_flags_[col] & column_parse::enabled) {
         metadata.column_names.emplace_back(col_names_[col]);
       }
     }
+    // Create empty columns
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      if (column_types[i].id() == type_id::STRING &&
+          is_dictionary_column(metadata.column_names[i])) {
+        out_columns.emplace_back(encode_strings({}, stream, mr_));
+      } else {
+        out_columns.emplace_back(make_empty_column(column_types[i]));
+      }
+    }
   }
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
 }
 
+bool reader::impl::is_dictionary_column(std::string const &name) const
+{
+  auto const &dictionary_columns = opts_.get_dictionary_columns();
+  return std::find(dictionary_columns.cbegin(), dictionary_columns.cend(), name) !=
+         dictionary_columns.cend();
+}
+
 size_t reader::impl::find_first_row_start(host_span<char const> const data)
 {
   // For now, look for the first terminator (assume the first terminator isn't within a quote)
@@ -382,22 +768,220 @@ size_t reader::impl::find_first_row_start(host_span<char const> const data)
   return std::min(pos + 1, data.size());
 }
 
-void reader::impl::gather_row_offsets(host_span<char const> const data,
-                                      size_t range_begin,
-                                      size_t range_end,
-                                      size_t skip_rows,
-                                      int64_t num_rows,
-                                      bool load_whole_file,
-                                      rmm::cuda_stream_view stream)
+/**
+ * @brief Copies consecutive chunks of host data to the device ahead of their use.
+ *
+ * The chunks are copied through a ring of pinned staging buffers on a separate stream. Appending
+ * a staged chunk to the device data is then a device-to-device copy on the caller's stream, so the
+ * following chunks are transferred while the current one is being processed.
+ *
+ * A stager pins `num_buffers` chunks of host memory, allocates as much device memory and creates a
+ * stream and events. This costs more than staging an input of a few chunks, so the stagers are
+ * kept in a process-wide pool and reused by the following readers; see `acquire_chunk_stager`.
+ */
+class chunk_stager {
+ public:
+  // One chunk being appended while the next two are transferred
+  static constexpr size_t num_buffers = 3;
+
+  /**
+   * @brief Allocates the staging buffers.
+   *
+   * @param chunk_size Size of the chunks; the first chunk of an input can be one byte longer
+   */
+  explicit chunk_stager(size_t chunk_size) : chunk_size_(chunk_size)
+  {
+    // Must not synchronize with the default stream
+    CUDA_TRY(cudaStreamCreateWithFlags(&copy_stream_, cudaStreamNonBlocking));
+    buffers_.reserve(num_buffers);
+    for (size_t i = 0; i < num_buffers; ++i) {
+      buffers_.emplace_back(chunk_size + sizeof(char), copy_stream_);
+      CUDA_TRY(cudaEventCreateWithFlags(&copied_[i], cudaEventDisableTiming));
+      CUDA_TRY(cudaEventCreateWithFlags(&appended_[i], cudaEventDisableTiming));
+    }
+  }
+
+  ~chunk_stager()
+  {
+    // The staging buffers must outlive the copies in flight, to and from them
+    cudaStreamSynchronize(copy_stream_);
+    for (size_t i = 0; i < num_buffers; ++i) {
+      cudaEventSynchronize(appended_[i]);
+      cudaEventDestroy(copied_[i]);
+      cudaEventDestroy(appended_[i]);
+    }
+    // The device buffers are freed on the copy stream
+    buffers_.clear();
+    cudaStreamDestroy(copy_stream_);
+  }
+
+  size_t chunk_size() const { return chunk_size_; }
+
+  /**
+   * @brief Starts copying the first chunks of a new input.
+   *
+   * Chunks of the previous input that were not appended are discarded.
+   *
+   * @param data Input data in host memory
+   * @param begin Position of the first chunk
+   * @param first_end End of the first chunk; the following chunks are `chunk_size` bytes long
+   */
+  void start(host_span<char const> data, size_t begin, size_t first_end)
+  {
+    CUDF_EXPECTS(first_end - begin <= chunk_size_ + sizeof(char), "First chunk is too large");
+    input_      = data;
+    next_begin_ = begin;
+    next_end_   = first_end;
+    staged_.clear();
+    prefetch();
+  }
+
+  /**
+   * @brief Starts copying the next chunks into the staging buffers that are free.
+   */
+  void prefetch()
+  {
+    while (staged_.size() < num_buffers && next_begin_ < next_end_) {
+      auto const idx  = next_buffer_;
+      auto const size = next_end_ - next_begin_;
+      next_buffer_    = (next_buffer_ + 1) % num_buffers;
+
+      // The previous transfer from the pinned buffer must be complete before it is overwritten
+      CUDA_TRY(cudaEventSynchronize(copied_[idx]));
+      std::memcpy(buffers_[idx].host_ptr(), input_.data() + next_begin_, size);
+      // The previous chunk in the device buffer must have been appended before it is overwritten
+      CUDA_TRY(cudaStreamWaitEvent(copy_stream_, appended_[idx], 0));
+      CUDA_TRY(cudaMemcpyAsync(buffers_[idx].device_ptr(),
+                               buffers_[idx].host_ptr(),
+                               size,
+                               cudaMemcpyHostToDevice,
+                               copy_stream_));
+      CUDA_TRY(cudaEventRecord(copied_[idx], copy_stream_));
+
+      staged_.push_back({idx, next_begin_, next_end_});
+      next_begin_ = next_end_;
+      next_end_   = std::min(next_end_ + chunk_size_, input_.size());
+    }
+  }
+
+  /**
+   * @brief Appends the next staged chunk, which must be the given range of the host data, to a
+   * device vector.
+   *
+   * @param out Device vector to append the chunk to
+   * @param begin Position of the chunk in the host data
+   * @param end End of the chunk in the host data
+   * @param stream CUDA stream on which the chunk is appended
+   */
+  void append(rmm::device_vector<char> &out, size_t begin, size_t end, rmm::cuda_stream_view stream)
+  {
+    CUDF_EXPECTS(!staged_.empty() && staged_.front().begin == begin && staged_.front().end == end,
+                 "Appended range does not match the next staged chunk");
+    auto const idx  = staged_.front().buffer;
+    auto const size = end - begin;
+    staged_.pop_front();
+
+    auto const offset = out.size();
+    // Growing the vector reallocates it outside of `stream`, after the work pending on its data
+    if (out.capacity() < offset + size) { stream.synchronize(); }
+    out.resize(offset + size);
+    CUDA_TRY(cudaStreamWaitEvent(stream.value(), copied_[idx], 0));
+    CUDA_TRY(cudaMemcpyAsync(out.data().get() + offset,
+                             buffers_[idx].device_ptr(),
+                             size,
+                             cudaMemcpyDeviceToDevice,
+                             stream.value()));
+    CUDA_TRY(cudaEventRecord(appended_[idx], stream.value()));
+  }
+
+ private:
+  struct staged_chunk {
+    size_t buffer;
+    size_t begin;
+    size_t end;
+  };
+
+  size_t const chunk_size_;
+  host_span<char const> input_;
+  size_t next_begin_  = 0;
+  size_t next_end_    = 0;
+  size_t next_buffer_ = 0;
+  cudaStream_t copy_stream_;
+  std::vector<hostdevice_vector<char>> buffers_;
+  cudaEvent_t copied_[num_buffers];
+  cudaEvent_t appended_[num_buffers];
+  std::deque<staged_chunk> staged_;
+};
+
+namespace {
+/**
+ * @brief Idle chunk stagers, shared by the CSV readers of the process.
+ *
+ * Readers are usually created for a single `read_csv` call, so a stager is returned to the pool
+ * when its reader is destroyed, instead of being freed. The pool is never destroyed, so that the
+ * stagers it holds make no CUDA calls after the runtime has been unloaded.
+ */
+struct chunk_stager_pool {
+  // Bounds the pinned memory kept by idle stagers to one set of staging buffers
+  static constexpr size_t max_idle_stagers = 1;
+
+  std::mutex mutex;
+  std::vector<std::unique_ptr<chunk_stager>> idle;
+};
+
+chunk_stager_pool &stager_pool()
+{
+  static auto *pool = new chunk_stager_pool;
+  return *pool;
+}
+
+/**
+ * @brief Returns an idle stager of the given chunk size, or a new one if there is none.
+ */
+chunk_stager_ptr acquire_chunk_stager(size_t chunk_size)
+{
+  auto &pool = stager_pool();
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    auto const it = std::find_if(pool.idle.begin(), pool.idle.end(), [&](auto const &stager) {
+      return stager->chunk_size() == chunk_size;
+    });
+    if (it != pool.idle.end()) {
+      auto stager = std::move(*it);
+      pool.idle.erase(it);
+      return chunk_stager_ptr(stager.release());
+    }
+  }
+  return chunk_stager_ptr(new chunk_stager(chunk_size));
+}
+}  // namespace
+
+void chunk_stager_deleter::operator()(chunk_stager *stager) const
 {
-  constexpr size_t max_chunk_bytes = 64 * 1024 * 1024;  // 64MB
-  size_t buffer_size               = std::min(max_chunk_bytes, data.size());
+  std::unique_ptr<chunk_stager> owned(stager);
+  auto &pool = stager_pool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  if (pool.idle.size() < chunk_stager_pool::max_idle_stagers) {
+    pool.idle.push_back(std::move(owned));
+  }
+}
+
+size_t reader::impl::gather_row_offsets(host_span<char const> const data,
+                                        size_t range_begin,
+                                        size_t range_end,
+                                        size_t skip_rows,
+                                        int64_t num_rows,
+                                        bool load_whole_file,
+                                        size_t header_rows,
+                                        rmm::cuda_stream_view stream)
+{
+  size_t const max_chunk_bytes = opts_.get_staging_chunk_size();
+  size_t buffer_size = std::min(max_chunk_bytes, data.size());
   size_t max_blocks =
     std::max<size_t>((buffer_size / cudf::io::csv::gpu::rowofs_block_bytes) + 1, 2);
   hostdevice_vector<uint64_t> row_ctx(max_blocks);
   size_t buffer_pos  = std::min(range_begin - std::min(range_begin, sizeof(char)), data.size());
   size_t pos         = std::min(range_begin, data.size());
-  size_t header_rows = (opts_.get_header() >= 0) ? opts_.get_header() + 1 : 0;
   uint64_t ctx       = 0;
 
   // For compatibility with the previous parser, a row is considered in-range if the
@@ -406,11 +990,26 @@ void reader::impl::gather_row_offsets(host_span<char const> const data,
   data_.resize(0);
   row_offsets_.resize(0);
   data_.reserve((load_whole_file) ? data.size() : std::min(buffer_size * 2, data.size()));
+
+  // Input that spans several chunks is staged ahead, so that the copy of the next chunks to the
+  // device overlaps with the scan of the current chunk
+  bool const use_stager = data.size() - pos > max_chunk_bytes;
+  if (use_stager) {
+    if (stager_ == nullptr || stager_->chunk_size() != max_chunk_bytes) {
+      stager_ = acquire_chunk_stager(max_chunk_bytes);
+    }
+    stager_->start(data, buffer_pos, std::min(pos + max_chunk_bytes, data.size()));
+  }
   do {
     size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
     size_t chunk_size = target_pos - pos;
 
-    data_.insert(data_.end(), data.begin() + buffer_pos + data_.size(), data.begin() + target_pos);
+    if (use_stager) {
+      stager_->append(data_, buffer_pos + data_.size(), target_pos, stream);
+    } else {
+      data_.insert(
+        data_.end(), data.begin() + buffer_pos + data_.size(), data.begin() + target_pos);
+    }
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
@@ -426,6 +1025,8 @@ void reader::impl::gather_row_offsets(host_span<char const> const data,
                                                                  range_end,
                                                                  skip_rows,
                                                                  stream);
+    // Stage the next chunks while the current one is scanned
+    if (use_stager) { stager_->prefetch(); }
     CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
                              row_ctx.device_ptr(),
                              num_blocks * sizeof(uint64_t),
@@ -532,11 +1133,68 @@ void reader::impl::gather_row_offsets(host_span<char const> const data,
   }
   // Apply num_rows limit
   if (num_rows >= 0) { row_offsets_.resize(std::min<size_t>(row_offsets_.size(), num_rows + 1)); }
+  return buffer_pos;
+}
+
+namespace {
+
+/**
+ * @brief Adds the type counts of a range of rows to the type counts of a column.
+ */
+void accumulate_histogram(column_type_histogram &total, column_type_histogram const &stats)
+{
+  total.float_count += stats.float_count;
+  total.datetime_count += stats.datetime_count;
+  total.string_count += stats.string_count;
+  total.negative_small_int_count += stats.negative_small_int_count;
+  total.positive_small_int_count += stats.positive_small_int_count;
+  total.big_int_count += stats.big_int_count;
+  total.bool_count += stats.bool_count;
+  total.null_count += stats.null_count;
 }
 
+/**
+ * @brief Returns the type of a column from the types of its values.
+ *
+ * @param stats Number of values of each type in the column
+ * @param num_rows Number of rows from which the values were counted
+ */
+data_type infer_column_type(column_type_histogram const &stats, size_type num_rows)
+{
+  auto const int_count_total =
+    stats.big_int_count + stats.negative_small_int_count + stats.positive_small_int_count;
+
+  if (stats.null_count == num_rows) {
+    // Entire column is NULL; allocate the smallest amount of memory
+    return data_type{type_id::INT8};
+  } else if (stats.string_count > 0L) {
+    return data_type{type_id::STRING};
+  } else if (stats.datetime_count > 0L) {
+    return data_type{type_id::TIMESTAMP_NANOSECONDS};
+  } else if (stats.bool_count > 0L) {
+    return data_type{type_id::BOOL8};
+  } else if (stats.float_count > 0L ||
+             (stats.float_count == 0L && int_count_total > 0L && stats.null_count > 0L)) {
+    // The second condition has been added to conform to
+    // PANDAS which states that a column of integers with
+    // a single NULL record need to be treated as floats.
+    return data_type{type_id::FLOAT64};
+  } else if (stats.big_int_count == 0) {
+    return data_type{type_id::INT64};
+  } else if (stats.big_int_count != 0 && stats.negative_small_int_count != 0) {
+    return data_type{type_id::STRING};
+  } else {
+    // Integers are stored as 64-bit to conform to PANDAS
+    return data_type{type_id::UINT64};
+  }
+}
+
+}  // namespace
+
 std::vector<data_type> reader::impl::gather_column_types(rmm::cuda_stream_view stream)
 {
   std::vector<data_type> dtypes;
+  verify_column_types_ = false;
 
   if (opts_.get_dtypes().empty()) {
     if (num_records_ == 0) {
@@ -544,41 +1202,43 @@ std::vector<data_type> reader::impl::gather_column_types(rmm::cuda_stream_view s
     } else {
       d_column_flags_ = h_column_flags_;
 
-      auto column_stats = cudf::io::csv::gpu::detect_column_types(
-        opts.view(), data_, d_column_flags_, row_offsets_, num_active_cols_, stream);
+      // Without a sample, or with one that covers all rows, the types are inferred from all rows
+      auto const sample_rows = opts_.get_type_inference_rows();
+      auto const num_ranges  = std::min(opts_.get_type_inference_ranges(), sample_rows);
+      verify_column_types_   = sample_rows > 0 && sample_rows < num_records_;
+      std::vector<std::pair<size_type, size_type>> ranges;
+      if (verify_column_types_) {
+        // Split the sample among ranges that start at evenly spaced rows
+        for (size_type range = 0; range < num_ranges; ++range) {
+          auto const begin = static_cast<size_type>(int64_t{range} * num_records_ / num_ranges);
+          auto const size  = sample_rows / num_ranges + (range < sample_rows % num_ranges);
+          ranges.emplace_back(begin, std::min(begin + size, num_records_));
+        }
+      } else {
+        ranges.emplace_back(0, num_records_);
+      }
+
+      std::vector<column_type_histogram> column_stats(num_active_cols_, column_type_histogram{});
+      size_type num_sampled_rows = 0;
+      for (auto const &range : ranges) {
+        auto const range_stats = cudf::io::csv::gpu::detect_column_types(
+          opts.view(),
+          data_,
+          d_column_flags_,
+          device_span<uint64_t const>(row_offsets_.data().get() + range.first,
+                                      range.second - range.first + 1),
+          num_active_cols_,
+          stream);
+        for (int col = 0; col < num_active_cols_; col++) {
+          accumulate_histogram(column_stats[col], range_stats[col]);
+        }
+        num_sampled_rows += range.second - range.first;
+      }
 
       stream.synchronize();
 
       for (int col = 0; col < num_active_cols_; col++) {
-        unsigned long long int_count_total = column_stats[col].big_int_count +
-                                             column_stats[col].negative_small_int_count +
-                                             column_stats[col].positive_small_int_count;
-
-        if (column_stats[col].null_count == num_records_) {
-          // Entire column is NULL; allocate the smallest amount of memory
-          dtypes.emplace_back(cudf::type_id::INT8);
-        } else if (column_stats[col].string_count > 0L) {
-          dtypes.emplace_back(cudf::type_id::STRING);
-        } else if (column_stats[col].datetime_count > 0L) {
-          dtypes.emplace_back(cudf::type_id::TIMESTAMP_NANOSECONDS);
-        } else if (column_stats[col].bool_count > 0L) {
-          dtypes.emplace_back(cudf::type_id::BOOL8);
-        } else if (column_stats[col].float_count > 0L ||
-                   (column_stats[col].float_count == 0L && int_count_total > 0L &&
-                    column_stats[col].null_count > 0L)) {
-          // The second condition has been added to conform to
-          // PANDAS which states that a column of integers with
-          // a single NULL record need to be treated as floats.
-          dtypes.emplace_back(cudf::type_id::FLOAT64);
-        } else if (column_stats[col].big_int_count == 0) {
-          dtypes.emplace_back(cudf::type_id::INT64);
-        } else if (column_stats[col].big_int_count != 0 &&
-                   column_stats[col].negative_small_int_count != 0) {
-          dtypes.emplace_back(cudf::type_id::STRING);
-        } else {
-          // Integers are stored as 64-bit to conform to PANDAS
-          dtypes.emplace_back(cudf::type_id::UINT64);
-        }
+        dtypes.emplace_back(infer_column_type(column_stats[col], num_sampled_rows));
       }
     }
   } else {
@@ -652,8 +1312,10 @@ std::vector<data_type> reader::impl::gather_column_types(rmm::cuda_stream_view s
   return dtypes;
 }
 
-std::vector<column_buffer> reader::impl::decode_data(std::vector<data_type> const &column_types,
-                                                     rmm::cuda_stream_view stream)
+std::vector<column_buffer> reader::impl::decode_data(
+  std::vector<data_type> const &column_types,
+  device_span<column_type_histogram> column_stats,
+  rmm::cuda_stream_view stream)
 {
   // Alloc output; columns' data memory is still expected for empty dataframe
   std::vector<column_buffer> out_buffers;
@@ -689,8 +1351,15 @@ std::vector<column_buffer> reader::impl::decode_data(std::vector<data_type> cons
   rmm::device_vector<bitmask_type *> d_valid = h_valid;
   d_column_flags_                            = h_column_flags_;
 
-  cudf::io::csv::gpu::decode_row_column_data(
-    opts.view(), data_, d_column_flags_, row_offsets_, d_dtypes, d_data, d_valid, stream);
+  cudf::io::csv::gpu::decode_row_column_data(opts.view(),
+                                             data_,
+                                             d_column_flags_,
+                                             row_offsets_,
+                                             d_dtypes,
+                                             d_data,
+                                             d_valid,
+                                             column_stats,
+                                             stream);
 
   stream.synchronize();
 
@@ -699,6 +1368,53 @@ std::vector<column_buffer> reader::impl::decode_data(std::vector<data_type> cons
   return out_buffers;
 }
 
+void reader::impl::promote_column_types(std::vector<data_type> &column_types,
+                                        host_span<column_type_histogram const> column_stats,
+                                        std::vector<column_buffer> &out_buffers,
+                                        rmm::cuda_stream_view stream)
+{
+  // Types of the columns that have values of a wider type outside the sample
+  std::vector<int> promoted_cols;
+  std::vector<data_type> promoted_types;
+  for (int col = 0; col < num_active_cols_; ++col) {
+    if (column_types[col].id() == type_id::STRING) { continue; }
+    auto type = infer_column_type(column_stats[col], num_records_);
+    if (cudf::is_timestamp(type) && opts_.get_timestamp_type().id() != cudf::type_id::EMPTY) {
+      type = opts_.get_timestamp_type();
+    }
+    if (type != column_types[col]) {
+      promoted_cols.push_back(col);
+      promoted_types.push_back(type);
+      column_types[col] = type;
+    }
+  }
+  if (promoted_cols.empty()) { return; }
+
+  // Decode the promoted columns again, with the other columns disabled
+  auto const column_flags    = h_column_flags_;
+  auto const num_active_cols = num_active_cols_;
+  auto promoted              = promoted_cols.cbegin();
+  for (int col = 0, active_col = 0; col < num_actual_cols_; ++col) {
+    if (h_column_flags_[col] & column_parse::enabled) {
+      if (promoted != promoted_cols.cend() && *promoted == active_col) {
+        ++promoted;
+      } else {
+        h_column_flags_[col] &= ~column_parse::enabled;
+      }
+      active_col++;
+    }
+  }
+  num_active_cols_ = promoted_cols.size();
+  auto promoted_buffers =
+    decode_data(promoted_types, device_span<column_type_histogram>{}, stream);
+  h_column_flags_  = column_flags;
+  num_active_cols_ = num_active_cols;
+
+  for (size_t i = 0; i < promoted_cols.size(); ++i) {
+    out_buffers[promoted_cols[i]] = std::move(promoted_buffers[i]);
+  }
+}
+
 /**
  * @brief Create a serialized trie for N/A value matching, based on the options.
  */
@@ -793,19 +1509,20 @@ parse_options make_parse_options(csv_reader_options const &reader_opts)
   return parse_opts;
 }
 
-reader::impl::impl(std::unique_ptr<datasource> source,
-                   std::string filepath,
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   std::vector<std::string> filepaths,
                    csv_reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : mr_(mr), source_(std::move(source)), filepath_(filepath), opts_(options)
+  : mr_(mr), sources_(std::move(sources)), filepaths_(std::move(filepaths)), opts_(options)
 {
+  CUDF_EXPECTS(!sources_.empty() || !filepaths_.empty(), "No source to read from");
+  // Files are opened when they are read
+  if (sources_.empty()) { sources_.resize(filepaths_.size()); }
+
   num_actual_cols_ = opts_.get_names().size();
   num_active_cols_ = num_actual_cols_;
 
-  compression_type_ =
-    infer_compression_type(opts_.get_compression(),
-                           filepath,
-                           {{"gz", "gzip"}, {"zip", "zip"}, {"bz2", "bz2"}, {"xz", "xz"}});
+  compression_type_ = source_compression_type(0);
 
   opts = make_parse_options(options);
 }
@@ -815,10 +1532,10 @@ reader::reader(std::vector<std::string> const &filepaths,
                csv_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
   // Delay actual instantiation of data source until read to allow for
   // partial memory mapping of file using byte ranges
-  _impl = std::make_unique<impl>(nullptr, filepaths[0], options, mr);
+  _impl = std::make_unique<impl>(
+    std::vector<std::unique_ptr<datasource>>{}, filepaths, options, mr);
 }
 
 // Forward to implementation
@@ -826,8 +1543,7 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                csv_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), "", options, mr);
+  _impl = std::make_unique<impl>(std::move(sources), std::vector<std::string>{}, options, mr);
 }
 
 // Destructor within this translation unit
@@ -836,6 +1552,67 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(rmm::cuda_stream_view stream) { return _impl->read(stream); }
 
+chunked_reader::impl::impl(std::size_t chunk_read_limit,
+                           std::vector<std::unique_ptr<datasource>> &&sources,
+                           std::vector<std::string> filepaths,
+                           csv_reader_options const &options,
+                           rmm::mr::device_memory_resource *mr)
+  : reader_(std::move(sources), std::move(filepaths), options, mr),
+    chunk_read_limit_(chunk_read_limit),
+    state_(options)
+{
+  if (chunk_read_limit_ == 0) { return; }
+  CUDF_EXPECTS(options.get_byte_range_offset() == 0 && options.get_byte_range_size() == 0,
+               "Reading in chunks using `byte range` is unsupported");
+  CUDF_EXPECTS(options.get_skipfooter() <= 0,
+               "Reading in chunks using `skipfooter` is unsupported");
+  input_ = reader_.open_window_stream(compressed_data_);
+}
+
+table_with_metadata chunked_reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No chunk left to read");
+  if (input_ == nullptr) {
+    state_.is_last_window = true;
+    return reader_.read(stream);
+  }
+  return reader_.read_window(*input_, chunk_read_limit_, state_, stream);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::string> const &filepaths,
+                               csv_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
+  _impl = std::make_unique<impl>(
+    chunk_read_limit, std::vector<std::unique_ptr<datasource>>{}, filepaths, options, mr);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                               csv_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+{
+  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
+  _impl = std::make_unique<impl>(
+    chunk_read_limit, std::move(sources), std::vector<std::string>{}, options, mr);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
+}
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -20,6 +20,7 @@
 #include "csv_gpu.h"
 
 #include <cudf/detail/utilities/trie.cuh>
+#include <io/comp/io_uncomp.h>
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
 
@@ -30,6 +31,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -44,12 +46,51 @@ namespace csv {
 using namespace cudf::io::csv;
 using namespace cudf::io;
 
+class chunk_stager;
+
+/**
+ * @brief Returns a chunk stager to the pool of idle stagers, or frees it if the pool is full.
+ */
+struct chunk_stager_deleter {
+  void operator()(chunk_stager *stager) const;
+};
+
+using chunk_stager_ptr = std::unique_ptr<chunk_stager, chunk_stager_deleter>;
+
+/**
+ * @brief Parsing state carried from one window of the input to the next.
+ */
+struct window_state {
+  std::vector<char> window;             // Rows carried over from the last window
+  std::vector<data_type> column_types;  // Column types, determined from the first window
+  size_t skip_rows     = 0;             // Rows left to skip from the start
+  size_t header_rows   = 0;             // Header rows left to remove, after the skipped rows
+  int64_t num_rows     = -1;            // Rows left to read; -1: all remaining data
+  bool is_first_window = true;
+  bool is_last_window  = false;
+
+  window_state() = default;
+
+  /**
+   * @brief Constructor with the row selection of the reader options.
+   */
+  explicit window_state(csv_reader_options const &options)
+    : skip_rows(std::max<size_type>(options.get_skiprows(), 0)),
+      header_rows((options.get_header() >= 0) ? options.get_header() + 1 : 0),
+      num_rows(options.get_nrows())
+  {
+  }
+};
+
 /**
  * @brief Implementation for CSV reader
  *
  * The CSV reader is implemented in 4 stages:
  * Stage 1: read and optionally decompress the input data in host memory
- * (may be a memory-mapped view of the data on disk)
+ * (may be a memory-mapped view of the data on disk). Compressed data can also
+ * be decompressed in windows of bounded size, each window going through the
+ * following stages before the next one is decompressed. Several sources are
+ * loaded concurrently into a single pinned buffer and parsed together.
  *
  * Stage 2: gather the offset of each data row within the csv data.
  * Since the number of rows in a given character block may depend on the
@@ -69,15 +110,15 @@ using namespace cudf::io;
 class reader::impl {
  public:
   /**
-   * @brief Constructor from a dataset source with reader options.
+   * @brief Constructor from dataset sources with reader options.
    *
-   * @param source Dataset source
-   * @param filepath Filepath if reading dataset from a file
+   * @param sources Dataset sources; opened from `filepaths` when reading if empty
+   * @param filepaths Filepaths if reading dataset from files
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
-  explicit impl(std::unique_ptr<datasource> source,
-                std::string filepath,
+  explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> filepaths,
                 csv_reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
@@ -90,6 +131,35 @@ class reader::impl {
    */
   table_with_metadata read(rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Opens the input as a stream of uncompressed data, to be read one window at a time.
+   *
+   * @param[out] compressed_data Compressed input, which must outlive the returned stream
+   *
+   * @return Stream of the uncompressed data, or null if the input is empty
+   */
+  std::unique_ptr<host_stream_decompressor> open_window_stream(
+    std::unique_ptr<datasource::buffer> &compressed_data);
+
+  /**
+   * @brief Reads and parses the next window of the input.
+   *
+   * The last row of the window is carried over to the next window, as it may be incomplete; the
+   * window is extended until it holds a complete row. The columns are selected and their types
+   * are determined from the first window, and then kept for all the following windows.
+   *
+   * @param input Stream of the uncompressed input data
+   * @param window_size Number of bytes to read from the input
+   * @param[in,out] state Parsing state, updated for the next window
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The rows of the window; no columns if no column is read
+   */
+  table_with_metadata read_window(host_stream_decompressor &input,
+                                  size_t window_size,
+                                  window_state &state,
+                                  rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Finds row positions within the specified input data.
@@ -104,15 +174,93 @@ class reader::impl {
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read; -1: all remaining data
    * @param load_whole_file Hint that the entire data will be needed on gpu
+   * @param header_rows Number of header rows to remove from the start, after the skipped rows
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Position of the device data within the input data, to which the row offsets are
+   * relative
    */
-  void gather_row_offsets(host_span<char const> data,
-                          size_t range_begin,
-                          size_t range_end,
-                          size_t skip_rows,
-                          int64_t num_rows,
-                          bool load_whole_file,
-                          rmm::cuda_stream_view stream);
+  size_t gather_row_offsets(host_span<char const> data,
+                            size_t range_begin,
+                            size_t range_end,
+                            size_t skip_rows,
+                            int64_t num_rows,
+                            bool load_whole_file,
+                            size_t header_rows,
+                            rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Reads several sources as a single dataset.
+   *
+   * The sources are loaded concurrently into a single pinned host buffer, and their rows are found
+   * in a single pass over the buffer. The header rows are removed from every source, and the
+   * column names are taken from the header of the first source.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_sources(rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Removes the header rows of the sources after the first one from the row offsets.
+   *
+   * @param source_starts Position of each source after the first one within the input data
+   * @param header_rows Number of header rows at the start of each source
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void remove_source_headers(host_span<uint64_t const> source_starts,
+                             size_t header_rows,
+                             rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the compression format of a source, from the options or the file extension.
+   *
+   * @param source_idx Index of the source
+   */
+  std::string source_compression_type(size_t source_idx) const;
+
+  /**
+   * @brief Reads compressed data by decompressing and parsing one window of data at a time.
+   *
+   * The columns are selected and their types are determined from the first window. The rows of
+   * the windows are concatenated one column at a time; `csv_chunked_reader` returns them in
+   * bounded chunks instead.
+   *
+   * @param decompressor Decompressor of the input data
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_windows(host_stream_decompressor &decompressor,
+                                   rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Sets the names of the columns and which columns to read, from the options and the
+   * header.
+   */
+  void select_columns();
+
+  /**
+   * @brief Decodes the rows found by `gather_row_offsets` into a table.
+   *
+   * Types inferred from a sample of the rows are checked while the rows are decoded, and promoted
+   * if needed.
+   *
+   * @param[in,out] column_types Column types
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata make_table(std::vector<data_type> &column_types,
+                                 rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns whether a string column is read as a dictionary column.
+   *
+   * @param name Name of the column
+   */
+  bool is_dictionary_column(std::string const &name) const;
 
   /**
    * @brief Find the start position of the first data row
@@ -126,6 +274,8 @@ class reader::impl {
   /**
    * @brief Returns a detected or parsed list of column dtypes.
    *
+   * Types that are not specified are inferred from the type inference sample, if any.
+   *
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return `std::vector<data_type>` List of column types
@@ -136,25 +286,44 @@ class reader::impl {
    * @brief Converts the row-column data and outputs to column bufferrs.
    *
    * @param column_types Column types
+   * @param column_stats Output counts of the types of the values of the non-string columns; not
+   * computed if empty
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return list of column buffers of decoded data, or ptr/size in the case of strings.
    */
   std::vector<column_buffer> decode_data(std::vector<data_type> const &column_types,
+                                         device_span<column_type_histogram> column_stats,
                                          rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Promotes the types inferred from a sample that do not fit all rows, and decodes the
+   * promoted columns again.
+   *
+   * @param[in,out] column_types Column types
+   * @param column_stats Counts of the types of the values of each column, from all rows
+   * @param[in,out] out_buffers Decoded columns
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  void promote_column_types(std::vector<data_type> &column_types,
+                            host_span<column_type_histogram const> column_stats,
+                            std::vector<column_buffer> &out_buffers,
+                            rmm::cuda_stream_view stream);
+
  private:
   rmm::mr::device_memory_resource *mr_ = nullptr;
-  std::unique_ptr<datasource> source_;
-  std::string filepath_;
-  std::string compression_type_;
+  std::vector<std::unique_ptr<datasource>> sources_;
+  std::vector<std::string> filepaths_;
+  std::string compression_type_;  // Compression of the first source
   const csv_reader_options opts_;
 
   rmm::device_vector<char> data_;
   rmm::device_vector<uint64_t> row_offsets_;
-  cudf::size_type num_records_ = 0;  // Number of rows with actual data
-  int num_active_cols_         = 0;  // Number of columns to read
-  int num_actual_cols_         = 0;  // Number of columns in the dataset
+  chunk_stager_ptr stager_;              // Pooled; taken when the input spans several chunks
+  cudf::size_type num_records_ = 0;      // Number of rows with actual data
+  int num_active_cols_         = 0;      // Number of columns to read
+  int num_actual_cols_         = 0;      // Number of columns in the dataset
+  bool verify_column_types_    = false;  // Whether the types were inferred from a sample
 
   // Parsing options
   parse_options opts{};
@@ -166,6 +335,52 @@ class reader::impl {
   std::vector<char> header_;
 };
 
+/**
+ * @brief Implementation for the chunked CSV reader
+ *
+ * Each chunk is a window of the input data, parsed with the state carried over from the previous
+ * chunk.
+ */
+class chunked_reader::impl {
+ public:
+  /**
+   * @brief Constructor from a dataset source with reader options.
+   *
+   * @param chunk_read_limit Number of bytes of uncompressed input data to read for each chunk;
+   * 0 to read all the data in one chunk
+   * @param sources Dataset source; opened from `filepaths` when reading if empty
+   * @param filepaths Filepath if reading dataset from a file
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::vector<std::unique_ptr<datasource>> &&sources,
+                std::vector<std::string> filepaths,
+                csv_reader_options const &options,
+                rmm::mr::device_memory_resource *mr);
+
+  /**
+   * @brief Returns whether there are chunks left to read.
+   */
+  bool has_next() const { return !state_.is_last_window; }
+
+  /**
+   * @brief Reads the next chunk of the dataset.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns of the chunk along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
+ private:
+  reader::impl reader_;
+  std::size_t chunk_read_limit_ = 0;
+  std::unique_ptr<datasource::buffer> compressed_data_;
+  std::unique_ptr<host_stream_decompressor> input_;  // Null if read in one chunk
+  window_state state_;
+};
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
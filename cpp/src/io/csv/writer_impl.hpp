@@ -102,7 +102,8 @@ class writer::impl {
                          const table_metadata* metadata = nullptr,
                          rmm::cuda_stream_view stream   = rmm::cuda_stream_default)
   {
-    // purposely no-op (for now);
+    // Report the errors of asynchronous sinks while they can still be thrown
+    out_sink_->flush();
   }
 
  private:
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/orc/orc.h>
+#include <io/parquet/parquet.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/io/dataset.hpp>
+#include <cudf/io/orc.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace cudf {
+namespace io {
+namespace {
+
+/**
+ * @brief Maps each row to the partition it was read from.
+ */
+struct row_partition_fn {
+  size_type const* partition_offsets;  // First row of each partition, and the number of rows
+  size_type num_partitions;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    auto const end = partition_offsets + num_partitions + 1;
+    return thrust::upper_bound(thrust::seq, partition_offsets, end, row) - partition_offsets - 1;
+  }
+};
+
+/**
+ * @brief Creates the dictionary column of a partition key.
+ *
+ * @param values Value of the key in each partition
+ * @param d_partition_offsets First row of each partition, and the number of rows, in device memory
+ * @param num_rows Number of rows read from the partitions
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column
+ */
+std::unique_ptr<column> make_partition_column(std::vector<std::string> const& values,
+                                              device_span<size_type const> d_partition_offsets,
+                                              size_type num_rows,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  // The dictionary keys are the sorted distinct non-null values
+  std::vector<std::string> keys;
+  std::copy_if(values.cbegin(), values.cend(), std::back_inserter(keys), [](auto const& value) {
+    return value != hive_null_partition_value;
+  });
+  std::sort(keys.begin(), keys.end());
+  keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+  std::vector<char> chars;
+  std::vector<size_type> offsets{0};
+  for (auto const& key : keys) {
+    chars.insert(chars.end(), key.cbegin(), key.cend());
+    offsets.push_back(chars.size());
+  }
+  auto const d_chars   = cudf::detail::make_device_uvector_async(chars, stream);
+  auto const d_offsets = cudf::detail::make_device_uvector_async(offsets, stream);
+  auto keys_column     = make_strings_column(d_chars, d_offsets, {}, 0, stream, mr);
+
+  // Index of the value of each partition in the keys; -1 for null values
+  std::vector<int32_t> codes(values.size());
+  std::transform(values.cbegin(), values.cend(), codes.begin(), [&keys](auto const& value) {
+    if (value == hive_null_partition_value) { return -1; }
+    auto const key = std::lower_bound(keys.cbegin(), keys.cend(), value);
+    return static_cast<int32_t>(std::distance(keys.cbegin(), key));
+  });
+  auto const d_codes = cudf::detail::make_device_uvector_async(codes, stream);
+
+  auto const partition_of =
+    row_partition_fn{d_partition_offsets.data(), static_cast<size_type>(values.size())};
+  auto indices_column = make_numeric_column(
+    data_type{type_id::UINT32}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    indices_column->mutable_view().begin<uint32_t>(),
+                    [partition_of, codes = d_codes.data()] __device__(size_type row) {
+                      auto const code = codes[partition_of(row)];
+                      return static_cast<uint32_t>(code < 0 ? 0 : code);
+                    });
+
+  auto null_mask = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [partition_of, codes = d_codes.data()] __device__(size_type row) {
+      return codes[partition_of(row)] >= 0;
+    },
+    stream,
+    mr);
+  if (null_mask.second == 0) { null_mask.first = rmm::device_buffer{0, stream, mr}; }
+
+  return make_dictionary_column(std::move(keys_column),
+                                std::move(indices_column),
+                                std::move(null_mask.first),
+                                null_mask.second);
+}
+
+/**
+ * @brief Reads Parquet files with a single decode, using the number of rows in their footers.
+ */
+table_with_metadata read_parquet_files(std::vector<std::string> const& files,
+                                       std::vector<std::string> const& columns,
+                                       std::vector<size_t>& file_rows,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto const source = source_info{files};
+  auto const handle = parse_parquet_metadata(source);
+  for (auto const& file_metadata : handle->per_file_metadata) {
+    file_rows.push_back(file_metadata.num_rows);
+  }
+  auto options = parquet_reader_options::builder(source).metadata_handle(handle).build();
+  if (not columns.empty()) { options.set_columns(columns); }
+  return read_parquet(options, mr);
+}
+
+/**
+ * @brief Reads ORC files with a single decode, using the number of rows in their footers.
+ *
+ * The footers are parsed concurrently, and passed to the reader so that they are parsed once.
+ */
+table_with_metadata read_orc_files(std::vector<std::string> const& files,
+                                   std::vector<std::string> const& columns,
+                                   std::vector<size_t>& file_rows,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  auto handles = detail::parallel_transform(
+    files.size(), [&files](size_t i) { return parse_orc_metadata(source_info{files[i]}); });
+  for (auto const& handle : handles) {
+    file_rows.push_back(handle->ff.numberOfRows);
+  }
+  auto options =
+    orc_reader_options::builder(source_info{files}).metadata_handles(std::move(handles)).build();
+  if (not columns.empty()) { options.set_columns(columns); }
+  return read_orc(options, mr);
+}
+
+}  // namespace
+
+dataset_reader_options_builder dataset_reader_options::builder(std::string root,
+                                                               dataset_format format)
+{
+  return dataset_reader_options_builder{std::move(root), format};
+}
+
+table_with_metadata read_dataset(dataset_reader_options const& options,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const stream = rmm::cuda_stream_default;
+
+  // Prune the partitions before opening any file
+  auto const dataset = discover_hive_partitions(options.get_root(), options.get_partition_filter());
+  std::vector<std::string> files;
+  for (auto const& partition : dataset.partitions) {
+    files.insert(files.end(), partition.files.cbegin(), partition.files.cend());
+  }
+  if (files.empty()) { return {std::make_unique<table>(), table_metadata{}}; }
+
+  std::vector<size_t> file_rows;
+  auto result = options.get_format() == dataset_format::PARQUET
+                  ? read_parquet_files(files, options.get_columns(), file_rows, mr)
+                  : read_orc_files(files, options.get_columns(), file_rows, mr);
+
+  // The files of each partition are contiguous in the output
+  std::vector<size_type> partition_offsets{0};
+  size_t file_idx = 0;
+  for (auto const& partition : dataset.partitions) {
+    size_t end_row = partition_offsets.back();
+    for (size_t i = 0; i < partition.files.size(); ++i) {
+      end_row += file_rows[file_idx++];
+    }
+    CUDF_EXPECTS(end_row <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
+                 "The dataset has too many rows");
+    partition_offsets.push_back(static_cast<size_type>(end_row));
+  }
+  auto const d_partition_offsets =
+    cudf::detail::make_device_uvector_async(partition_offsets, stream);
+
+  auto columns = result.tbl->release();
+  for (auto const& key : dataset.partition_keys) {
+    std::vector<std::string> values;
+    for (auto const& partition : dataset.partitions) {
+      values.push_back(partition.values.at(key));
+    }
+    columns.push_back(make_partition_column(
+      values, d_partition_offsets, partition_offsets.back(), stream, mr));
+    result.metadata.column_names.push_back(key);
+  }
+  return {std::make_unique<table>(std::move(columns)), std::move(result.metadata)};
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/dataset.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <utility>
+
+namespace cudf {
+namespace io {
+namespace {
+
+namespace fs = boost::filesystem;
+
+// Hidden entries, such as `_SUCCESS` markers and `.crc` files, are not part of the dataset
+bool is_hidden(std::string const& name) { return name.empty() || name[0] == '.' || name[0] == '_'; }
+
+/**
+ * @brief Decodes the percent-encoded characters of a partition key or value.
+ */
+std::string unescape_path_name(std::string const& name)
+{
+  std::string result;
+  for (size_t i = 0; i < name.size(); ++i) {
+    if (name[i] == '%' && i + 2 < name.size() &&
+        std::isxdigit(static_cast<unsigned char>(name[i + 1])) &&
+        std::isxdigit(static_cast<unsigned char>(name[i + 2]))) {
+      result.push_back(static_cast<char>(std::stoi(name.substr(i + 1, 2), nullptr, 16)));
+      i += 2;
+    } else {
+      result.push_back(name[i]);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the values of the keys of a directory, by key name.
+ */
+partition_values to_partition_values(std::vector<std::pair<std::string, std::string>> const& keys)
+{
+  return partition_values(keys.cbegin(), keys.cend());
+}
+
+/**
+ * @brief Lists the directory tree of a dataset, accumulating the keys of the parent directories.
+ *
+ * The filter has already selected the keys of `dir`; subdirectories whose keys it rejects are
+ * not listed.
+ *
+ * @param dir Directory to list
+ * @param keys Keys and values of the directories from the root to `dir`
+ * @param filter Predicate that selects the partitions to list; all partitions if empty
+ * @param[in,out] dataset Dataset the partitions are added to
+ * @param[in,out] has_keys Whether the partition keys of the dataset are known
+ */
+void list_partitions(fs::path const& dir,
+                     std::vector<std::pair<std::string, std::string>>& keys,
+                     partition_filter const& filter,
+                     hive_dataset& dataset,
+                     bool& has_keys)
+{
+  std::vector<fs::path> subdirs;
+  std::vector<std::string> files;
+  for (auto const& entry : fs::directory_iterator(dir)) {
+    if (is_hidden(entry.path().filename().string())) { continue; }
+    if (fs::is_directory(entry.status())) {
+      subdirs.push_back(entry.path());
+    } else {
+      files.push_back(entry.path().string());
+    }
+  }
+
+  // The root directory has no keys, so the filter has not been evaluated for it yet
+  if (not files.empty() && (not keys.empty() || !filter || filter(partition_values{}))) {
+    std::vector<std::string> key_names;
+    for (auto const& key : keys) {
+      key_names.push_back(key.first);
+    }
+    if (not has_keys) {
+      dataset.partition_keys = std::move(key_names);
+      has_keys               = true;
+    } else {
+      CUDF_EXPECTS(key_names == dataset.partition_keys,
+                   "All partitions must have the same keys: " + dir.string());
+    }
+    std::sort(files.begin(), files.end());
+    dataset.partitions.push_back({to_partition_values(keys), std::move(files)});
+  }
+
+  std::sort(subdirs.begin(), subdirs.end());
+  for (auto const& subdir : subdirs) {
+    auto const name = subdir.filename().string();
+    auto const sep  = name.find('=');
+    CUDF_EXPECTS(sep != std::string::npos && sep != 0,
+                 "Partition directories must be named <key>=<value>: " + subdir.string());
+    auto key                = unescape_path_name(name.substr(0, sep));
+    auto const is_duplicate = std::any_of(
+      keys.cbegin(), keys.cend(), [&key](auto const& parent) { return parent.first == key; });
+    CUDF_EXPECTS(not is_duplicate, "Duplicate partition key: " + subdir.string());
+    keys.emplace_back(std::move(key), unescape_path_name(name.substr(sep + 1)));
+    // Prune the subtree as soon as the value of its key is rejected
+    if (!filter || filter(to_partition_values(keys))) {
+      list_partitions(subdir, keys, filter, dataset, has_keys);
+    }
+    keys.pop_back();
+  }
+}
+
+}  // namespace
+
+hive_dataset discover_hive_partitions(std::string const& root, partition_filter const& filter)
+{
+  CUDF_EXPECTS(fs::is_directory(root), "Cannot open dataset directory: " + root);
+
+  hive_dataset dataset;
+  std::vector<std::pair<std::string, std::string>> keys;
+  bool has_keys = false;
+  list_partitions(root, keys, filter, dataset, has_keys);
+  return dataset;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -131,7 +131,7 @@ template <typename writer, typename... Ts>
 std::unique_ptr<writer> make_writer(sink_info const& sink, Ts&&... args)
 {
   if (sink.type == io_type::FILEPATH) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.filepath),
+    return std::make_unique<writer>(cudf::io::data_sink::create(sink.filepath, sink.file_mode),
                                     std::forward<Ts>(args)...);
   }
   if (sink.type == io_type::HOST_BUFFER) {
@@ -190,22 +190,87 @@ void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resourc
 
 namespace detail_orc = cudf::io::detail::orc;
 
-raw_orc_statistics read_raw_orc_statistics(source_info const& src_info)
+namespace {
+
+/**
+ * @brief Creates the datasource for a `source_info` that holds a single source.
+ */
+std::unique_ptr<datasource> make_single_datasource(source_info const& src_info)
 {
-  // Get source to read statistics from
-  std::unique_ptr<datasource> source;
   if (src_info.type == io_type::FILEPATH) {
     CUDF_EXPECTS(src_info.filepaths.size() == 1, "Only a single source is currently supported.");
-    source = cudf::io::datasource::create(src_info.filepaths[0]);
+    return cudf::io::datasource::create(src_info.filepaths[0]);
   } else if (src_info.type == io_type::HOST_BUFFER) {
     CUDF_EXPECTS(src_info.buffers.size() == 1, "Only a single source is currently supported.");
-    source = cudf::io::datasource::create(src_info.buffers[0]);
+    return cudf::io::datasource::create(src_info.buffers[0]);
   } else if (src_info.type == io_type::USER_IMPLEMENTED) {
     CUDF_EXPECTS(src_info.user_sources.size() == 1, "Only a single source is currently supported.");
-    source = cudf::io::datasource::create(src_info.user_sources[0]);
+    return cudf::io::datasource::create(src_info.user_sources[0]);
   } else {
     CUDF_FAIL("Unsupported source type");
   }
+}
+
+/**
+ * @brief Creates the datasources for all sources in a `source_info`.
+ */
+std::vector<std::unique_ptr<datasource>> make_datasources(source_info const& src_info)
+{
+  if (src_info.type == io_type::FILEPATH) {
+    return cudf::io::datasource::create(src_info.filepaths);
+  } else if (src_info.type == io_type::HOST_BUFFER) {
+    return cudf::io::datasource::create(src_info.buffers);
+  } else if (src_info.type == io_type::USER_IMPLEMENTED) {
+    return cudf::io::datasource::create(src_info.user_sources);
+  } else {
+    CUDF_FAIL("Unsupported source type");
+  }
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::io::csv_chunked_reader::csv_chunked_reader
+ */
+csv_chunked_reader::csv_chunked_reader(std::size_t chunk_read_limit,
+                                       csv_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  namespace csv = cudf::io::detail::csv;
+
+  CUDF_FUNC_RANGE();
+  // File paths are kept to infer the compression from the file extension
+  auto const& source = options.get_source();
+  if (source.type == io_type::FILEPATH) {
+    reader =
+      std::make_unique<csv::chunked_reader>(chunk_read_limit, source.filepaths, options, mr);
+  } else {
+    reader = std::make_unique<csv::chunked_reader>(
+      chunk_read_limit, make_datasources(source), options, mr);
+  }
+}
+
+// Destructor within this translation unit
+csv_chunked_reader::~csv_chunked_reader() = default;
+
+/**
+ * @copydoc cudf::io::csv_chunked_reader::has_next
+ */
+bool csv_chunked_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::csv_chunked_reader::read_chunk
+ */
+table_with_metadata csv_chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return reader->read_chunk();
+}
+
+raw_orc_statistics read_raw_orc_statistics(source_info const& src_info)
+{
+  // Get source to read statistics from
+  auto const source = make_single_datasource(src_info);
 
   orc::metadata metadata(source.get());
 
@@ -350,6 +415,42 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::parse_orc_metadata
+ */
+orc_metadata_handle parse_orc_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+  auto const source = make_single_datasource(src_info);
+  return orc::metadata::parse_footer(source.get());
+}
+
+/**
+ * @copydoc cudf::io::orc_chunked_reader::orc_chunked_reader
+ */
+orc_chunked_reader::orc_chunked_reader(std::size_t chunk_read_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  reader = std::make_unique<detail_orc::chunked_reader>(
+    chunk_read_limit, make_datasources(options.get_source()), options, mr);
+}
+
+/**
+ * @copydoc cudf::io::orc_chunked_reader::has_next
+ */
+bool orc_chunked_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::orc_chunked_reader::read_chunk
+ */
+table_with_metadata orc_chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -409,6 +510,41 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::parse_parquet_metadata
+ */
+parquet_metadata_handle parse_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+  return detail_parquet::reader::parse_metadata(make_datasources(src_info));
+}
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::parquet_chunked_reader
+ */
+parquet_chunked_reader::parquet_chunked_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  reader = std::make_unique<detail_parquet::chunked_reader>(
+    chunk_read_limit, make_datasources(options.get_source()), options, mr);
+}
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::has_next
+ */
+bool parquet_chunked_reader::has_next() const { return reader->has_next(); }
+
+/**
+ * @copydoc cudf::io::parquet_chunked_reader::read_chunk
+ */
+table_with_metadata parquet_chunked_reader::read_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  */
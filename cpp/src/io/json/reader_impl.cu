@@ -23,11 +23,13 @@
 
 #include <io/comp/io_uncomp.h>
 #include <io/utilities/parsing_utils.cuh>
+#include <io/utilities/string_dictionary.hpp>
 #include <io/utilities/type_conversion.cuh>
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/utilities/trie.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/strings/detail/replace.hpp>
@@ -42,6 +44,8 @@
 
 #include <thrust/optional.h>
 
+#include <algorithm>
+
 using cudf::host_span;
 
 namespace cudf {
@@ -623,6 +627,20 @@ table_with_metadata reader::impl::convert_data_to_table(rmm::cuda_stream_view st
   for (size_t i = 0; i < num_columns; ++i) {
     out_buffers[i].null_count() = num_records - h_valid_counts[i];
 
+    auto const &dictionary_columns = options_.get_dictionary_columns();
+    if (dtypes_[i].id() == type_id::STRING &&
+        std::find(dictionary_columns.cbegin(),
+                  dictionary_columns.cend(),
+                  metadata_.column_names[i]) != dictionary_columns.cend()) {
+      // Only the distinct values need to have their escape characters removed
+      auto const out_column = encode_strings(*out_buffers[i]._strings, stream, mr_);
+      auto const keys       = cudf::strings::detail::replace(
+        dictionary_column_view(out_column->view()).keys(), target->view(), repl->view(), stream);
+      out_columns.emplace_back(
+        replace_dictionary_keys(out_column->view(), keys->view(), stream, mr_));
+      continue;
+    }
+
     auto out_column = make_column(out_buffers[i], nullptr, stream, mr_);
     if (out_column->type().id() == type_id::STRING) {
       // Need to remove escape character in case of '\"' and '\\'
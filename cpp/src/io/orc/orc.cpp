@@ -17,6 +17,8 @@
 #include <io/orc/orc.h>
 #include <io/orc/orc_field_reader.hpp>
 #include <io/orc/orc_field_writer.hpp>
+#include <cmath>
+#include <numeric>
 #include <string>
 
 namespace cudf {
@@ -434,8 +436,20 @@ const uint8_t *OrcDecompressor::Decompress(const uint8_t *srcBytes, size_t srcLe
   return m_buf.data();
 }
 
-metadata::metadata(datasource *const src) : source(src)
+metadata::metadata(datasource *const src) : metadata(src, parse_footer(src)) {}
+
+metadata::metadata(datasource *const src, std::shared_ptr<parsed_footer const> footer)
+  : _footer(std::move(footer)), ps(_footer->ps), ff(_footer->ff), md(_footer->md), source(src)
+{
+  CUDF_EXPECTS(_footer->source_size == source->size(), "Footer was parsed from another source");
+  decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
+}
+
+std::shared_ptr<parsed_footer const> metadata::parse_footer(datasource *const source)
 {
+  auto footer = std::make_shared<parsed_footer>();
+  auto &ps    = footer->ps;
+
   const auto len         = source->size();
   const auto max_ps_size = std::min(len, static_cast<size_t>(256));
 
@@ -448,21 +462,25 @@ metadata::metadata(datasource *const src) : source(src)
 
   // If compression is used, the rest of the metadata is compressed
   // If no compressed is used, the decompressor is simply a pass-through
-  decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
+  OrcDecompressor decompressor(ps.compression, ps.compressionBlockSize);
 
   // Read compressed filefooter section
   buffer           = source->host_read(len - ps_length - 1 - ps.footerLength, ps.footerLength);
   size_t ff_length = 0;
-  auto ff_data     = decompressor->Decompress(buffer->data(), ps.footerLength, &ff_length);
-  ProtobufReader(ff_data, ff_length).read(ff);
-  CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
+  auto ff_data     = decompressor.Decompress(buffer->data(), ps.footerLength, &ff_length);
+  ProtobufReader(ff_data, ff_length).read(footer->ff);
+  CUDF_EXPECTS(footer->ff.types.size() > 0, "No columns found");
 
   // Read compressed metadata section
   buffer =
     source->host_read(len - ps_length - 1 - ps.footerLength - ps.metadataLength, ps.metadataLength);
   size_t md_length = 0;
-  auto md_data     = decompressor->Decompress(buffer->data(), ps.metadataLength, &md_length);
-  orc::ProtobufReader(md_data, md_length).read(md);
+  auto md_data     = decompressor.Decompress(buffer->data(), ps.metadataLength, &md_length);
+  orc::ProtobufReader(md_data, md_length).read(footer->md);
+
+  footer->column_names = build_column_names(footer->ff);
+  footer->source_size  = len;
+  return footer;
 }
 
 std::vector<metadata::OrcStripeInfo> metadata::select_stripes(const std::vector<size_type> &stripes,
@@ -530,6 +548,145 @@ std::vector<metadata::OrcStripeInfo> metadata::select_stripes(const std::vector<
   return selection;
 }
 
+namespace {
+
+/**
+ * @brief Returns the range of the values of a column in a stripe from its statistics
+ *
+ * The range type is EMPTY for the kinds of columns whose statistics are not supported: booleans,
+ * strings, decimals and nested types.
+ *
+ * @param kind Kind of the column
+ * @param blob Encoded statistics of the column in the stripe
+ * @param num_rows Number of rows in the stripe
+ */
+detail::column_value_range statistics_to_range(TypeKind kind,
+                                               ColStatsBlob const &blob,
+                                               int64_t num_rows)
+{
+  detail::column_value_range range;
+  range.num_rows = num_rows;
+  if (blob.empty()) { return range; }
+
+  column_statistics stats;
+  ProtobufReader(blob.data(), blob.size()).read(stats);
+  if (stats.number_of_values != nullptr) {
+    range.null_count = num_rows - static_cast<int64_t>(*stats.number_of_values);
+  }
+
+  switch (kind) {
+    case BYTE:
+    case SHORT:
+    case INT:
+    case LONG: {
+      auto const &s = stats.int_stats;
+      if (s == nullptr || !s->has_minimum() || !s->has_maximum()) { break; }
+      range.type    = data_type{type_id::INT64};
+      range.int_min = *s->minimum();
+      range.int_max = *s->maximum();
+    } break;
+    case FLOAT:
+    case DOUBLE: {
+      auto const &s = stats.double_stats;
+      if (s == nullptr || !s->has_minimum() || !s->has_maximum() || std::isnan(*s->minimum()) ||
+          std::isnan(*s->maximum())) {
+        break;
+      }
+      range.type      = data_type{type_id::FLOAT64};
+      range.float_min = *s->minimum();
+      range.float_max = *s->maximum();
+    } break;
+    case DATE: {
+      auto const &s = stats.date_stats;
+      if (s == nullptr || !s->has_minimum() || !s->has_maximum()) { break; }
+      range.type    = data_type{type_id::TIMESTAMP_DAYS};
+      range.int_min = *s->minimum();
+      range.int_max = *s->maximum();
+    } break;
+    case TIMESTAMP: {
+      auto const &s = stats.timestamp_stats;
+      if (s == nullptr || !s->has_minimum_utc() || !s->has_maximum_utc()) { break; }
+      // Values are truncated to milliseconds; widen the range to include the truncated values
+      range.type    = data_type{type_id::TIMESTAMP_MILLISECONDS};
+      range.int_min = *s->minimum_utc() - 1;
+      range.int_max = *s->maximum_utc() + 1;
+    } break;
+    default: break;
+  }
+  return range;
+}
+
+}  // namespace
+
+std::vector<size_type> metadata::filter_stripes(const std::vector<size_type> &stripes,
+                                                detail::statistics_filter const &filter,
+                                                size_type &num_pruned) const
+{
+  std::vector<size_type> selection;
+  if (stripes.empty()) {
+    selection.resize(get_num_stripes());
+    std::iota(selection.begin(), selection.end(), 0);
+  } else {
+    selection = stripes;
+  }
+  num_pruned = 0;
+
+  // Stripe statistics are optional
+  auto const &top_level_ids = ff.types[0].subtypes;
+  if (md.stripeStats.size() != ff.stripes.size()) { return selection; }
+  for (auto const col : filter.get_referenced_columns()) {
+    CUDF_EXPECTS(col >= 0 && col < static_cast<size_type>(top_level_ids.size()),
+                 "Filter references a column that is not in the file");
+  }
+
+  std::vector<detail::column_value_range> ranges(top_level_ids.size());
+  auto const is_pruned = [&](size_type stripe_idx) {
+    // Invalid indices are kept, to be reported when selecting the stripes
+    if (stripe_idx < 0 || stripe_idx >= get_num_stripes()) { return false; }
+    auto const &col_stats = md.stripeStats[stripe_idx].colStats;
+    auto const num_rows   = ff.stripes[stripe_idx].numberOfRows;
+    for (auto const col : filter.get_referenced_columns()) {
+      auto const col_id    = top_level_ids[col];
+      ranges[col]          = detail::column_value_range{};
+      ranges[col].num_rows = num_rows;
+      if (col_id < col_stats.size()) {
+        ranges[col] = statistics_to_range(ff.types[col_id].kind, col_stats[col_id], num_rows);
+      }
+    }
+    return !filter.may_match(ranges);
+  };
+  auto const pruned_begin = std::remove_if(selection.begin(), selection.end(), is_pruned);
+  num_pruned              = std::distance(pruned_begin, selection.end());
+  selection.erase(pruned_begin, selection.end());
+  return selection;
+}
+
+int64_t metadata::get_string_length(size_type stripe_idx, int column_id) const
+{
+  auto const string_length = [](ColStatsBlob const &blob) -> int64_t {
+    if (blob.empty()) { return -1; }
+    column_statistics stats;
+    ProtobufReader(blob.data(), blob.size()).read(stats);
+    if (stats.string_stats == nullptr || !stats.string_stats->has_sum()) { return -1; }
+    return static_cast<int64_t>(*stats.string_stats->sum());
+  };
+
+  auto const col_id = static_cast<size_t>(column_id);
+  if (md.stripeStats.size() == ff.stripes.size() &&
+      col_id < md.stripeStats[stripe_idx].colStats.size()) {
+    auto const length = string_length(md.stripeStats[stripe_idx].colStats[col_id]);
+    if (length >= 0) { return length; }
+  }
+  if (col_id < ff.statistics.size() && ff.numberOfRows > 0) {
+    auto const length = string_length(ff.statistics[col_id]);
+    if (length >= 0) {
+      return static_cast<int64_t>(static_cast<double>(length) *
+                                  ff.stripes[stripe_idx].numberOfRows / ff.numberOfRows);
+    }
+  }
+  return -1;
+}
+
 std::vector<int> metadata::select_columns(std::vector<std::string> use_names,
                                           bool &has_timestamp_column)
 {
@@ -564,11 +721,12 @@ std::vector<int> metadata::select_columns(std::vector<std::string> use_names,
   return selection;
 }
 
-void metadata::init_column_names()
+std::vector<std::string> metadata::build_column_names(FileFooter const &ff)
 {
-  auto const schema_idxs = get_schema_indexes();
+  std::vector<std::string> column_names;
+  auto const schema_idxs = get_schema_indexes(ff);
   auto const &types      = ff.types;
-  for (int32_t col_id = 0; col_id < get_num_columns(); ++col_id) {
+  for (int32_t col_id = 0; col_id < static_cast<int32_t>(types.size()); ++col_id) {
     std::string col_name;
     uint32_t parent_idx = col_id;
     uint32_t idx        = col_id;
@@ -587,9 +745,10 @@ void metadata::init_column_names()
     // If we have no name (root column), generate a name
     column_names.push_back(col_name.empty() ? "col" + std::to_string(col_id) : col_name);
   }
+  return column_names;
 }
 
-std::vector<metadata::schema_indexes> metadata::get_schema_indexes() const
+std::vector<metadata::schema_indexes> metadata::get_schema_indexes(FileFooter const &ff)
 {
   std::vector<schema_indexes> result(ff.types.size());
 
@@ -26,6 +26,7 @@
 #include <cudf/utilities/error.hpp>
 
 #include <io/comp/io_uncomp.h>
+#include <io/utilities/statistics_filter.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include "orc_common.h"
@@ -528,16 +529,42 @@ class OrcDecompressor {
   std::vector<uint8_t> m_buf;
 };
 
+/**
+ * @brief Parsed postscript, footer and metadata sections of an ORC file.
+ *
+ * Immutable once parsed, so it can be shared by all `metadata` objects that read the same file.
+ */
+struct parsed_footer {
+  PostScript ps;
+  FileFooter ff;
+  Metadata md;
+  std::vector<std::string> column_names;  // Full names of all columns, in column id order
+  size_t source_size = 0;                 // Size of the source the footer was parsed from
+};
+
 /**
  * @brief A helper class for ORC file metadata. Provides some additional
  * convenience methods for initializing and accessing metadata.
  */
 class metadata {
+ public:
   using OrcStripeInfo = std::pair<const StripeInformation *, const StripeFooter *>;
 
- public:
+  /**
+   * @brief Reads and parses the footer of the source.
+   */
   explicit metadata(datasource *const src);
 
+  /**
+   * @brief Uses a footer previously parsed from the same source.
+   */
+  metadata(datasource *const src, std::shared_ptr<parsed_footer const> footer);
+
+  /**
+   * @brief Reads and parses the postscript, footer and metadata sections of the source.
+   */
+  static std::shared_ptr<parsed_footer const> parse_footer(datasource *const src);
+
   /**
    * @brief Filters and reads the info of only a selection of stripes
    *
@@ -551,6 +578,31 @@ class metadata {
                                             size_type &row_start,
                                             size_type &row_count);
 
+  /**
+   * @brief Removes the stripes whose statistics show that none of their rows pass the filter
+   *
+   * @param[in] stripes Indices of individual stripes; all stripes if empty
+   * @param[in] filter Filter evaluated on the statistics of each stripe
+   * @param[out] num_pruned Number of stripes that were removed
+   *
+   * @return Indices of the remaining stripes
+   */
+  std::vector<size_type> filter_stripes(const std::vector<size_type> &stripes,
+                                        detail::statistics_filter const &filter,
+                                        size_type &num_pruned) const;
+
+  /**
+   * @brief Returns the total length of the string values of a column in a stripe
+   *
+   * Uses the stripe statistics, or the share of the stripe in the file statistics.
+   *
+   * @param[in] stripe_idx Index of the stripe
+   * @param[in] column_id ORC column id of a string column
+   *
+   * @return Length in bytes, or a negative value if the statistics do not include it
+   */
+  int64_t get_string_length(size_type stripe_idx, int column_id) const;
+
   /**
    * @brief Filters and reduces down to a selection of columns
    *
@@ -564,17 +616,20 @@ class metadata {
   size_t get_total_rows() const { return ff.numberOfRows; }
   int get_num_stripes() const { return ff.stripes.size(); }
   int get_num_columns() const { return ff.types.size(); }
-  std::string const &get_column_name(int32_t column_id)
+  std::string const &get_column_name(int32_t column_id) const
   {
-    if (column_names.empty() && get_num_columns() != 0) { init_column_names(); }
-    return column_names[column_id];
+    return _footer->column_names[column_id];
   }
   int get_row_index_stride() const { return ff.rowIndexStride; }
+  std::shared_ptr<parsed_footer const> const &get_parsed_footer() const { return _footer; }
+
+ private:
+  std::shared_ptr<parsed_footer const> const _footer;
 
  public:
-  PostScript ps;
-  FileFooter ff;
-  Metadata md;
+  PostScript const &ps;
+  FileFooter const &ff;
+  Metadata const &md;
   std::vector<StripeFooter> stripefooters;
   std::unique_ptr<OrcDecompressor> decompressor;
 
@@ -583,10 +638,9 @@ class metadata {
     int32_t parent = -1;
     int32_t field  = -1;
   };
-  std::vector<schema_indexes> get_schema_indexes() const;
-  void init_column_names();
+  static std::vector<schema_indexes> get_schema_indexes(FileFooter const &ff);
+  static std::vector<std::string> build_column_names(FileFooter const &ff);
 
-  std::vector<std::string> column_names;
   datasource *const source;
 };
 
@@ -23,6 +23,7 @@
 #include <io/statistics/column_stats.h>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -347,6 +348,9 @@ void CompactOrcDataStreams(detail::device_2dspan<StripeStream> strm_desc,
  * @param[in,out] enc_streams chunk streams device array [column][rowgroup]
  * @param[out] comp_in Per-block compression input parameters
  * @param[out] comp_out Per-block compression status
+ * @param[in] block_groups Per-block index into `group_levels`; blocks with a negative group are
+ * stored uncompressed
+ * @param[in] group_levels Compression level of each group of blocks
  */
 void CompressOrcDataStreams(uint8_t *compressed_data,
                             uint32_t num_compressed_blocks,
@@ -356,6 +360,8 @@ void CompressOrcDataStreams(uint8_t *compressed_data,
                             detail::device_2dspan<encoder_chunk_streams> enc_streams,
                             gpu_inflate_input_s *comp_in,
                             gpu_inflate_status_s *comp_out,
+                            host_span<int const> block_groups,
+                            host_span<int const> group_levels,
                             rmm::cuda_stream_view stream = rmm::cuda_stream_default);
 
 /**
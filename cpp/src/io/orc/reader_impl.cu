@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2021, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,11 +20,13 @@
  */
 
 #include "reader_impl.hpp"
-#include "timezone.cuh"
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/host_codec.h>
 #include <io/orc/orc.h>
+#include <io/utilities/thread_pool.hpp>
 
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -35,6 +37,8 @@
 
 #include <algorithm>
 #include <array>
+#include <iterator>
+#include <limits>
 
 namespace cudf {
 namespace io {
@@ -215,6 +219,15 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+/**
+ * @brief Returns the previously parsed footer of a source, or null if it has to be parsed
+ */
+orc_metadata_handle get_metadata_handle(orc_reader_options const &options, size_t source_idx)
+{
+  auto const &handles = options.get_metadata_handles();
+  return handles.empty() ? options.get_metadata_handle() : handles[source_idx];
+}
+
 }  // namespace
 
 rmm::device_buffer reader::impl::decompress_stripe_data(
@@ -285,11 +298,36 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   if (num_compressed_blocks > 0) {
     switch (decompressor->GetKind()) {
       case orc::ZLIB:
-        CUDA_TRY(
-          gpuinflate(inflate_in.data(), inflate_out.data(), num_compressed_blocks, 0, stream));
+        if (use_host_decompression(host_codec::INFLATE, num_compressed_blocks, total_decomp_size)) {
+          host_decompress(host_codec::INFLATE,
+                          inflate_in.data(),
+                          inflate_out.data(),
+                          num_compressed_blocks,
+                          stream);
+        } else {
+          CUDA_TRY(
+            gpuinflate(inflate_in.data(), inflate_out.data(), num_compressed_blocks, 0, stream));
+        }
         break;
       case orc::SNAPPY:
-        CUDA_TRY(gpu_unsnap(inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream));
+        if (use_host_decompression(host_codec::SNAPPY, num_compressed_blocks, total_decomp_size)) {
+          host_decompress(host_codec::SNAPPY,
+                          inflate_in.data(),
+                          inflate_out.data(),
+                          num_compressed_blocks,
+                          stream);
+        } else {
+          CUDA_TRY(
+            gpu_unsnap(inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream));
+        }
+        break;
+      case orc::ZSTD:
+        host_decompress(
+          host_codec::ZSTD, inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream);
+        break;
+      case orc::LZ4:
+        host_decompress(
+          host_codec::LZ4, inflate_in.data(), inflate_out.data(), num_compressed_blocks, stream);
         break;
       default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
     }
@@ -385,12 +423,17 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
+                   orc_metadata_handle const &metadata_handle,
                    orc_reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr), _source(std::move(source))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<cudf::io::orc::metadata>(_source.get());
+  // Open and parse the source dataset metadata, unless it was parsed by a previous call
+  if (metadata_handle != nullptr) {
+    _metadata = std::make_unique<cudf::io::orc::metadata>(_source.get(), metadata_handle);
+  } else {
+    _metadata = std::make_unique<cudf::io::orc::metadata>(_source.get());
+  }
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.get_columns(), _has_timestamp_column);
@@ -411,197 +454,284 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   _decimals_as_int_scale = options.get_forced_decimals_scale();
 }
 
+size_t reader::impl::num_rows() const { return _metadata->get_total_rows(); }
+
+bool reader::impl::has_same_schema(impl const &other) const
+{
+  auto const &types       = _metadata->ff.types;
+  auto const &other_types = other._metadata->ff.types;
+  return std::equal(types.cbegin(),
+                    types.cend(),
+                    other_types.cbegin(),
+                    other_types.cend(),
+                    [](SchemaType const &lhs, SchemaType const &rhs) {
+                      return lhs.kind == rhs.kind && lhs.subtypes == rhs.subtypes &&
+                             lhs.fieldNames == rhs.fieldNames && lhs.precision == rhs.precision &&
+                             lhs.scale == rhs.scale;
+                    });
+}
+
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        const std::vector<size_type> &stripes,
+                                       ast::expression const *filter,
                                        rmm::cuda_stream_view stream)
 {
-  std::vector<std::unique_ptr<column>> out_columns;
   table_metadata out_metadata;
 
   // There are no columns in table
   if (_selected_columns.size() == 0) return {std::make_unique<table>(), std::move(out_metadata)};
 
-  // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata->select_stripes(stripes, skip_rows, num_rows);
-
-  // Association between each ORC column and its cudf::column
-  std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
+  std::vector<stripe_batch> batches;
+  batches.push_back(read_stripes(
+    skip_rows, num_rows, stripes, filter, true, out_metadata.num_pruned_row_groups, stream));
+  return decode_stripes(batches, std::move(out_metadata), stream);
+}
 
-  // Get a list of column data types
+std::vector<data_type> reader::impl::get_column_types() const
+{
   std::vector<data_type> column_types;
   for (const auto &col : _selected_columns) {
     auto col_type = to_type_id(
       _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float64);
     CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
     column_types.emplace_back(col_type);
+  }
+  return column_types;
+}
+
+reader::impl::stripe_batch reader::impl::read_stripes(size_type skip_rows,
+                                                      size_type num_rows,
+                                                      const std::vector<size_type> &stripes,
+                                                      ast::expression const *filter,
+                                                      bool allow_index,
+                                                      size_type &num_pruned,
+                                                      rmm::cuda_stream_view stream)
+{
+  stripe_batch batch;
 
-    // Map each ORC column to its column
-    orc_col_map[col] = column_types.size() - 1;
+  // Skip the stripes whose statistics do not match the filter
+  std::vector<size_type> filtered_stripes;
+  if (filter != nullptr) {
+    filtered_stripes =
+      _metadata->filter_stripes(stripes, statistics_filter(*filter, stream), num_pruned);
   }
 
-  // If no rows or stripes to read, return empty columns
-  if (num_rows <= 0 || selected_stripes.empty()) {
-    std::transform(column_types.cbegin(),
-                   column_types.cend(),
-                   std::back_inserter(out_columns),
-                   [](auto const &dtype) { return make_empty_column(dtype); });
-  } else {
-    const auto num_columns = _selected_columns.size();
-    const auto num_chunks  = selected_stripes.size() * num_columns;
-    hostdevice_vector<gpu::ColumnDesc> chunks(num_chunks, stream);
-    memset(chunks.host_ptr(), 0, chunks.memory_size());
-
-    const bool use_index =
-      (_use_index == true) &&
-      // Only use if we don't have much work with complete columns & stripes
-      // TODO: Consider nrows, gpu, and tune the threshold
-      (num_rows > _metadata->get_row_index_stride() && !(_metadata->get_row_index_stride() & 7) &&
-       _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
-      // Only use if first row is aligned to a stripe boundary
-      // TODO: Fix logic to handle unaligned rows
-      (skip_rows == 0);
-
-    // Logically view streams as columns
-    std::vector<orc_stream_info> stream_info;
-
-    // Tracker for eventually deallocating compressed and uncompressed data
-    std::vector<rmm::device_buffer> stripe_data;
-
-    size_t stripe_start_row = 0;
-    size_t num_dict_entries = 0;
-    size_t num_rowgroups    = 0;
-    for (size_t i = 0; i < selected_stripes.size(); ++i) {
-      const auto stripe_info   = selected_stripes[i].first;
-      const auto stripe_footer = selected_stripes[i].second;
-
-      auto stream_count          = stream_info.size();
-      const auto total_data_size = gather_stream_info(i,
-                                                      stripe_info,
-                                                      stripe_footer,
-                                                      orc_col_map,
-                                                      _selected_columns,
-                                                      _metadata->ff.types,
-                                                      use_index,
-                                                      &num_dict_entries,
-                                                      chunks,
-                                                      stream_info);
-      CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
-
-      stripe_data.emplace_back(total_data_size, stream);
-      auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
-
-      // Coalesce consecutive streams into one read
-      while (stream_count < stream_info.size()) {
-        const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
-        const auto offset = stream_info[stream_count].offset;
-        auto len          = stream_info[stream_count].length;
-        stream_count++;
+  // Select only stripes required (aka row groups); an empty list selects all stripes
+  const auto selected_stripes =
+    (filter != nullptr && filtered_stripes.empty())
+      ? std::vector<cudf::io::orc::metadata::OrcStripeInfo>{}
+      : _metadata->select_stripes(
+          filter != nullptr ? filtered_stripes : stripes, skip_rows, num_rows);
 
-        while (stream_count < stream_info.size() &&
-               stream_info[stream_count].offset == offset + len) {
-          len += stream_info[stream_count].length;
-          stream_count++;
-        }
-        const auto buffer = _source->host_read(offset, len);
-        CUDA_TRY(
-          cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-        stream.synchronize();
-      }
+  // If no rows or stripes to read, there is nothing to decode
+  if (num_rows <= 0 || selected_stripes.empty()) { return batch; }
 
-      // Update chunks to reference streams pointers
-      for (size_t j = 0; j < num_columns; j++) {
-        auto &chunk         = chunks[i * num_columns + j];
-        chunk.start_row     = stripe_start_row;
-        chunk.num_rows      = stripe_info->numberOfRows;
-        chunk.encoding_kind = stripe_footer->columns[_selected_columns[j]].kind;
-        chunk.type_kind     = _metadata->ff.types[_selected_columns[j]].kind;
-        if (_decimals_as_float64) {
-          chunk.decimal_scale =
-            _metadata->ff.types[_selected_columns[j]].scale | orc::gpu::orc_decimal2float64_scale;
-        } else if (_decimals_as_int_scale < 0) {
-          chunk.decimal_scale = _metadata->ff.types[_selected_columns[j]].scale;
-        } else {
-          chunk.decimal_scale = _decimals_as_int_scale;
-        }
-        chunk.rowgroup_id = num_rowgroups;
-        chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
-                            ? sizeof(std::pair<const char *, size_t>)
-                            : cudf::size_of(column_types[j]);
-        if (chunk.type_kind == orc::TIMESTAMP) {
-          chunk.ts_clock_rate = to_clockrate(_timestamp_type.id());
-        }
-        for (int k = 0; k < gpu::CI_NUM_STREAMS; k++) {
-          chunk.streams[k] = dst_base + stream_info[chunk.strm_id[k]].dst_pos;
-        }
-      }
-      stripe_start_row += stripe_info->numberOfRows;
-      if (use_index) {
-        num_rowgroups += (stripe_info->numberOfRows + _metadata->get_row_index_stride() - 1) /
-                         _metadata->get_row_index_stride();
+  // Association between each ORC column and its cudf::column
+  std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
+  for (size_t i = 0; i < _selected_columns.size(); ++i) {
+    orc_col_map[_selected_columns[i]] = i;
+  }
+  const auto column_types = get_column_types();
+
+  const auto num_columns = _selected_columns.size();
+  const auto num_chunks  = selected_stripes.size() * num_columns;
+  hostdevice_vector<gpu::ColumnDesc> chunks(num_chunks, stream);
+  memset(chunks.host_ptr(), 0, chunks.memory_size());
+
+  const bool use_index =
+    (_use_index == true) && allow_index &&
+    // Only use if we don't have much work with complete columns & stripes
+    // TODO: Consider nrows, gpu, and tune the threshold
+    (num_rows > _metadata->get_row_index_stride() && !(_metadata->get_row_index_stride() & 7) &&
+     _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
+    // Only use if first row is aligned to a stripe boundary
+    // TODO: Fix logic to handle unaligned rows
+    (skip_rows == 0);
+
+  // Logically view streams as columns
+  std::vector<orc_stream_info> stream_info;
+
+  // Tracker for eventually deallocating compressed and uncompressed data
+  std::vector<rmm::device_buffer> stripe_data;
+
+  // Host staging for the stripe data, read with a single request after all stripes are mapped
+  std::vector<std::vector<uint8_t>> stripe_host_data;
+  std::vector<datasource::read_range> read_ranges;
+
+  size_t stripe_start_row = 0;
+  size_t num_dict_entries = 0;
+  size_t num_rowgroups    = 0;
+  for (size_t i = 0; i < selected_stripes.size(); ++i) {
+    const auto stripe_info   = selected_stripes[i].first;
+    const auto stripe_footer = selected_stripes[i].second;
+
+    auto stream_count          = stream_info.size();
+    const auto total_data_size = gather_stream_info(i,
+                                                    stripe_info,
+                                                    stripe_footer,
+                                                    orc_col_map,
+                                                    _selected_columns,
+                                                    _metadata->ff.types,
+                                                    use_index,
+                                                    &num_dict_entries,
+                                                    chunks,
+                                                    stream_info);
+    CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
+
+    stripe_data.emplace_back(total_data_size, stream);
+    auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
+    stripe_host_data.emplace_back(total_data_size);
+    auto host_dst_base = stripe_host_data.back().data();
+
+    // Coalesce consecutive streams into one read
+    while (stream_count < stream_info.size()) {
+      const auto h_dst  = host_dst_base + stream_info[stream_count].dst_pos;
+      const auto offset = stream_info[stream_count].offset;
+      auto len          = stream_info[stream_count].length;
+      stream_count++;
+
+      while (stream_count < stream_info.size() &&
+             stream_info[stream_count].offset == offset + len) {
+        len += stream_info[stream_count].length;
+        stream_count++;
       }
+      read_ranges.push_back({offset, len, h_dst});
     }
 
-    // Process dataset chunk pages into output columns
-    if (stripe_data.size() != 0) {
-      // Setup row group descriptors if using indexes
-      rmm::device_uvector<gpu::RowGroup> row_groups(num_rowgroups * num_columns, stream);
-      if (_metadata->ps.compression != orc::NONE) {
-        auto decomp_data = decompress_stripe_data(chunks,
-                                                  stripe_data,
-                                                  _metadata->decompressor.get(),
-                                                  stream_info,
-                                                  selected_stripes.size(),
-                                                  row_groups,
-                                                  _metadata->get_row_index_stride(),
-                                                  stream);
-        stripe_data.clear();
-        stripe_data.push_back(std::move(decomp_data));
+    // Update chunks to reference streams pointers
+    for (size_t j = 0; j < num_columns; j++) {
+      auto &chunk         = chunks[i * num_columns + j];
+      chunk.start_row     = stripe_start_row;
+      chunk.num_rows      = stripe_info->numberOfRows;
+      chunk.encoding_kind = stripe_footer->columns[_selected_columns[j]].kind;
+      chunk.type_kind     = _metadata->ff.types[_selected_columns[j]].kind;
+      if (_decimals_as_float64) {
+        chunk.decimal_scale =
+          _metadata->ff.types[_selected_columns[j]].scale | orc::gpu::orc_decimal2float64_scale;
+      } else if (_decimals_as_int_scale < 0) {
+        chunk.decimal_scale = _metadata->ff.types[_selected_columns[j]].scale;
       } else {
-        if (not row_groups.is_empty()) {
-          chunks.host_to_device(stream);
-          gpu::ParseRowGroupIndex(row_groups.data(),
-                                  nullptr,
-                                  chunks.device_ptr(),
-                                  num_columns,
-                                  selected_stripes.size(),
-                                  num_rowgroups,
-                                  _metadata->get_row_index_stride(),
-                                  stream);
-        }
+        chunk.decimal_scale = _decimals_as_int_scale;
       }
-
-      // Setup table for converting timestamp columns from local to UTC time
-      auto const tz_table =
-        _has_timestamp_column
-          ? build_timezone_transition_table(selected_stripes[0].second->writerTimezone, stream)
-          : timezone_table{};
-
-      std::vector<column_buffer> out_buffers;
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        bool is_nullable = false;
-        for (size_t j = 0; j < selected_stripes.size(); ++j) {
-          if (chunks[j * num_columns + i].strm_len[gpu::CI_PRESENT] != 0) {
-            is_nullable = true;
-            break;
-          }
-        }
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+      chunk.rowgroup_id = num_rowgroups;
+      chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
+                          ? sizeof(std::pair<const char *, size_t>)
+                          : cudf::size_of(column_types[j]);
+      if (chunk.type_kind == orc::TIMESTAMP) {
+        chunk.ts_clock_rate = to_clockrate(_timestamp_type.id());
+      }
+      for (int k = 0; k < gpu::CI_NUM_STREAMS; k++) {
+        chunk.streams[k] = dst_base + stream_info[chunk.strm_id[k]].dst_pos;
       }
+    }
+    stripe_start_row += stripe_info->numberOfRows;
+    if (use_index) {
+      num_rowgroups += (stripe_info->numberOfRows + _metadata->get_row_index_stride() - 1) /
+                       _metadata->get_row_index_stride();
+    }
+  }
+
+  // Read the streams of all stripes; nearby ranges are merged and read concurrently
+  auto const bytes_read = _source->host_read_ranges(read_ranges);
+  for (size_t r = 0; r < bytes_read.size(); ++r) {
+    CUDF_EXPECTS(bytes_read[r] == read_ranges[r].size,
+                 "Unexpected end of file while reading the stripe data");
+  }
+  for (size_t i = 0; i < stripe_data.size(); ++i) {
+    CUDA_TRY(cudaMemcpyAsync(stripe_data[i].data(),
+                             stripe_host_data[i].data(),
+                             stripe_host_data[i].size(),
+                             cudaMemcpyHostToDevice,
+                             stream.value()));
+  }
+  stream.synchronize();
+  stripe_host_data.clear();
+
+  // Setup row group descriptors if using indexes
+  rmm::device_uvector<gpu::RowGroup> row_groups(num_rowgroups * num_columns, stream);
+  if (_metadata->ps.compression != orc::NONE) {
+    auto decomp_data = decompress_stripe_data(chunks,
+                                              stripe_data,
+                                              _metadata->decompressor.get(),
+                                              stream_info,
+                                              selected_stripes.size(),
+                                              row_groups,
+                                              _metadata->get_row_index_stride(),
+                                              stream);
+    stripe_data.clear();
+    stripe_data.push_back(std::move(decomp_data));
+  } else {
+    if (not row_groups.is_empty()) {
+      chunks.host_to_device(stream);
+      gpu::ParseRowGroupIndex(row_groups.data(),
+                              nullptr,
+                              chunks.device_ptr(),
+                              num_columns,
+                              selected_stripes.size(),
+                              num_rowgroups,
+                              _metadata->get_row_index_stride(),
+                              stream);
+    }
+  }
+
+  batch.chunks           = std::move(chunks);
+  batch.stripe_data      = std::move(stripe_data);
+  batch.row_groups       = std::move(row_groups);
+  batch.num_stripes      = selected_stripes.size();
+  batch.num_stripe_rows  = stripe_start_row;
+  batch.num_dict_entries = num_dict_entries;
+  batch.skip_rows        = skip_rows;
+  batch.num_rows         = num_rows;
+  batch.writer_timezone  = selected_stripes[0].second->writerTimezone;
+  return batch;
+}
+
+table_with_metadata reader::impl::decode_stripes(std::vector<stripe_batch> &batches,
+                                                 table_metadata out_metadata,
+                                                 rmm::cuda_stream_view stream)
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+
+  // There are no columns in table
+  if (_selected_columns.size() == 0) return {std::make_unique<table>(), std::move(out_metadata)};
 
-      decode_stream_data(chunks,
-                         num_dict_entries,
-                         skip_rows,
-                         num_rows,
-                         tz_table.view(),
-                         row_groups,
-                         _metadata->get_row_index_stride(),
-                         out_buffers,
-                         stream);
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, stream, _mr));
+  const auto column_types = get_column_types();
+
+  // Batches without rows to decode do not contribute to the output
+  batches.erase(std::remove_if(batches.begin(),
+                               batches.end(),
+                               [](auto const &batch) { return batch.num_rows == 0; }),
+                batches.end());
+
+  // If no rows or stripes to read, return empty columns
+  if (batches.empty()) {
+    std::transform(column_types.cbegin(),
+                   column_types.cend(),
+                   std::back_inserter(out_columns),
+                   [](auto const &dtype) { return make_empty_column(dtype); });
+  } else {
+    // Timestamps are converted with the transition table of the writer timezone, so only the
+    // batches from the same timezone are decoded together
+    std::vector<std::unique_ptr<table>> runs;
+    for (auto first = batches.begin(); first != batches.end();) {
+      auto last = std::next(first);
+      while (last != batches.end() &&
+             (!_has_timestamp_column || last->writer_timezone == first->writer_timezone)) {
+        ++last;
       }
+      runs.push_back(std::make_unique<table>(decode_batches(first, last, column_types, stream)));
+      first = last;
+    }
+
+    if (runs.size() == 1) {
+      out_columns = runs[0]->release();
+    } else {
+      std::vector<table_view> views;
+      std::transform(runs.cbegin(), runs.cend(), std::back_inserter(views), [](auto const &run) {
+        return run->view();
+      });
+      out_columns = cudf::detail::concatenate(views, stream, _mr)->release();
     }
   }
 
@@ -611,20 +741,233 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     out_metadata.column_names[i] = _metadata->get_column_name(_selected_columns[i]);
   }
   // Return user metadata
+  add_user_data(out_metadata);
+
+  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+}
+
+std::vector<std::unique_ptr<column>> reader::impl::decode_batches(
+  std::vector<stripe_batch>::iterator first,
+  std::vector<stripe_batch>::iterator last,
+  std::vector<data_type> const &column_types,
+  rmm::cuda_stream_view stream)
+{
+  const auto num_columns = column_types.size();
+  const bool is_merged   = std::next(first) != last;
+
+  size_t num_stripes = 0;
+  size_t num_dicts   = 0;
+  size_t num_rows    = 0;
+  for (auto it = first; it != last; ++it) {
+    num_stripes += it->num_stripes;
+    num_dicts += it->num_dict_entries;
+    num_rows += it->num_rows;
+  }
+
+  // The stripes of several batches are decoded as consecutive stripes of one source; their rows
+  // and dictionary entries follow those of the previous batches
+  hostdevice_vector<gpu::ColumnDesc> merged_chunks;
+  if (is_merged) {
+    merged_chunks = hostdevice_vector<gpu::ColumnDesc>(num_stripes * num_columns, stream);
+    size_t chunk_pos  = 0;
+    size_t start_row  = 0;
+    size_t dict_start = 0;
+    for (auto it = first; it != last; ++it) {
+      CUDF_EXPECTS(it == first || it->skip_rows == 0, "Only the first batch can skip rows");
+      CUDF_EXPECTS(std::next(it) == last || it->skip_rows + it->num_rows == it->num_stripe_rows,
+                   "Only the last batch can end before the end of its stripes");
+      CUDF_EXPECTS(it->row_groups.is_empty(), "Batches decoded together cannot use the row index");
+      for (size_t i = 0; i < it->chunks.size(); ++i) {
+        auto chunk = it->chunks[i];
+        chunk.start_row += start_row;
+        if (chunk.dict_len > 0) { chunk.dictionary_start += dict_start; }
+        merged_chunks[chunk_pos++] = chunk;
+      }
+      start_row += it->num_stripe_rows;
+      dict_start += it->num_dict_entries;
+    }
+  }
+  auto &chunks = is_merged ? merged_chunks : first->chunks;
+  auto const row_groups = is_merged ? device_span<gpu::RowGroup const>{}
+                                    : device_span<gpu::RowGroup const>{first->row_groups};
+
+  // Setup table for converting timestamp columns from local to UTC time, unless it was built
+  // by a previous read of the same timezone
+  auto const &writer_timezone = first->writer_timezone;
+  if (_has_timestamp_column && (!_has_tz_table || _tz_table_name != writer_timezone)) {
+    _tz_table      = build_timezone_transition_table(writer_timezone, stream);
+    _tz_table_name = writer_timezone;
+    _has_tz_table  = true;
+  }
+
+  std::vector<column_buffer> out_buffers;
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    bool is_nullable = false;
+    for (size_t j = 0; j < num_stripes; ++j) {
+      if (chunks[j * num_columns + i].strm_len[gpu::CI_PRESENT] != 0) {
+        is_nullable = true;
+        break;
+      }
+    }
+    out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+  }
+
+  decode_stream_data(chunks,
+                     num_dicts,
+                     first->skip_rows,
+                     num_rows,
+                     _tz_table.view(),
+                     row_groups,
+                     _metadata->get_row_index_stride(),
+                     out_buffers,
+                     stream);
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    out_columns.emplace_back(make_column(out_buffers[i], nullptr, stream, _mr));
+  }
+  return out_columns;
+}
+
+void reader::impl::add_user_data(table_metadata &out_metadata) const
+{
   for (const auto &kv : _metadata->ff.metadata) {
     out_metadata.user_data.insert({kv.name, kv.value});
   }
+}
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+std::vector<reader::impl::chunk_rows> reader::impl::plan_chunks(orc_reader_options const &options,
+                                                                 size_t chunk_read_limit,
+                                                                 size_type &num_pruned,
+                                                                 rmm::cuda_stream_view stream)
+{
+  num_pruned   = 0;
+  auto stripes = options.get_stripes();
+  if (options.get_filter() != nullptr) {
+    stripes = _metadata->filter_stripes(
+      stripes, statistics_filter(*options.get_filter(), stream), num_pruned);
+    // Read no rows when all stripes are pruned
+    if (stripes.empty()) { return {chunk_rows{0, 0, {}}}; }
+  }
+
+  // Stripes to read, with the range of their rows to read
+  struct stripe_rows {
+    size_type stripe_idx;
+    int64_t start_row;
+    int64_t end_row;
+  };
+  std::vector<stripe_rows> selection;
+  auto const by_stripe = !stripes.empty();
+  if (by_stripe) {
+    for (auto const stripe_idx : stripes) {
+      CUDF_EXPECTS(stripe_idx >= 0 && stripe_idx < _metadata->get_num_stripes(),
+                   "Invalid stripe index");
+      selection.push_back({stripe_idx, 0, _metadata->ff.stripes[stripe_idx].numberOfRows});
+    }
+  } else {
+    auto const total_rows = static_cast<int64_t>(_metadata->get_total_rows());
+    auto const first_row  = std::min<int64_t>(std::max(options.get_skip_rows(), 0), total_rows);
+    auto const end_row =
+      (options.get_num_rows() < 0)
+        ? total_rows
+        : std::min<int64_t>(first_row + options.get_num_rows(), total_rows);
+    int64_t stripe_start = 0;
+    for (size_type stripe_idx = 0; stripe_idx < _metadata->get_num_stripes(); ++stripe_idx) {
+      auto const stripe_end = stripe_start + _metadata->ff.stripes[stripe_idx].numberOfRows;
+      if (stripe_end > first_row && stripe_start < end_row) {
+        selection.push_back(
+          {stripe_idx, std::max(stripe_start, first_row), std::min(stripe_end, end_row)});
+      }
+      stripe_start = stripe_end;
+    }
+  }
+  if (chunk_read_limit == 0 || selection.empty() || _selected_columns.empty()) {
+    return {chunk_rows{options.get_skip_rows(), options.get_num_rows(), stripes}};
+  }
+
+  std::vector<data_type> column_types;
+  for (const auto &col : _selected_columns) {
+    column_types.emplace_back(to_type_id(
+      _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float64));
+  }
+  auto const estimate_size = [&](stripe_rows const &stripe) {
+    auto const &info = _metadata->ff.stripes[stripe.stripe_idx];
+    auto const rows  = static_cast<size_t>(stripe.end_row - stripe.start_row);
+    size_t size      = 0;
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      size += (rows + 7) / 8;
+      if (column_types[i].id() == type_id::STRING) {
+        // Without statistics, the stripe data size is the best available estimate
+        auto length = _metadata->get_string_length(stripe.stripe_idx, _selected_columns[i]);
+        if (length < 0) { length = info.dataLength; }
+        size += (rows + 1) * sizeof(size_type) +
+                static_cast<size_t>(static_cast<double>(length) * rows / info.numberOfRows);
+      } else if (is_fixed_width(column_types[i])) {
+        size += rows * size_of(column_types[i]);
+      }
+    }
+    return size;
+  };
+
+  // Group consecutive stripes while their total size fits in the limit
+  std::vector<chunk_rows> chunks;
+  auto const add_chunk = [&](size_t begin, size_t end) {
+    if (by_stripe) {
+      std::vector<size_type> chunk_stripes;
+      for (auto s = begin; s < end; ++s) {
+        chunk_stripes.push_back(selection[s].stripe_idx);
+      }
+      chunks.push_back({0, -1, std::move(chunk_stripes)});
+    } else {
+      auto const start_row = selection[begin].start_row;
+      chunks.push_back({static_cast<size_type>(start_row),
+                        static_cast<size_type>(selection[end - 1].end_row - start_row),
+                        {}});
+    }
+  };
+  size_t chunk_begin = 0;
+  size_t chunk_size  = 0;
+  for (size_t s = 0; s < selection.size(); ++s) {
+    auto const size = estimate_size(selection[s]);
+    if (s > chunk_begin && chunk_size + size > chunk_read_limit) {
+      add_chunk(chunk_begin, s);
+      chunk_begin = s;
+      chunk_size  = 0;
+    }
+    chunk_size += size;
+  }
+  add_chunk(chunk_begin, selection.size());
+  return chunks;
+}
+
+chunked_reader::impl::impl(size_t chunk_read_limit,
+                           std::unique_ptr<datasource> source,
+                           orc_reader_options const &options,
+                           rmm::mr::device_memory_resource *mr,
+                           rmm::cuda_stream_view stream)
+  : _reader(std::move(source), get_metadata_handle(options, 0), options, mr)
+{
+  _chunks = _reader.plan_chunks(options, chunk_read_limit, _num_pruned_row_groups, stream);
+}
+
+table_with_metadata chunked_reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No chunk left to read");
+  auto const &chunk = _chunks[_next_chunk];
+  // The stripes were already filtered when planning the chunks
+  auto result = _reader.read(chunk.skip_rows, chunk.num_rows, chunk.stripes, nullptr, stream);
+  // Stripes pruned while planning are reported with the first chunk
+  if (_next_chunk == 0) { result.metadata.num_pruned_row_groups += _num_pruned_row_groups; }
+  ++_next_chunk;
+  return result;
 }
 
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                orc_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
+  : reader(datasource::create(filepaths), options, mr)
 {
-  CUDF_EXPECTS(filepaths.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(datasource::create(filepaths[0]), options, mr);
 }
 
 // Forward to implementation
@@ -632,8 +975,21 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
                orc_reader_options const &options,
                rmm::mr::device_memory_resource *mr)
 {
-  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
-  _impl = std::make_unique<impl>(std::move(sources[0]), options, mr);
+  CUDF_EXPECTS(not sources.empty(), "At least one source is required");
+  CUDF_EXPECTS(sources.size() == 1 || options.get_metadata_handle() == nullptr,
+               "A metadata handle can only be used with a single source");
+  CUDF_EXPECTS(options.get_metadata_handles().empty() ||
+                 options.get_metadata_handles().size() == sources.size(),
+               "The number of metadata handles must match the number of sources");
+
+  // Parse the footers of all sources concurrently, unless they were parsed by a previous call
+  _impls = detail::parallel_transform(sources.size(), [&](size_t i) {
+    return std::make_unique<impl>(
+      std::move(sources[i]), get_metadata_handle(options, i), options, mr);
+  });
+  for (auto const &impl : _impls) {
+    CUDF_EXPECTS(impl->has_same_schema(*_impls[0]), "All sources must have the same schema");
+  }
 }
 
 // Destructor within this translation unit
@@ -642,8 +998,74 @@ reader::~reader() = default;
 // Forward to implementation
 table_with_metadata reader::read(orc_reader_options const &options, rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
+  if (_impls.size() == 1) {
+    return _impls[0]->read(options.get_skip_rows(),
+                           options.get_num_rows(),
+                           options.get_stripes(),
+                           options.get_filter(),
+                           stream);
+  }
+  CUDF_EXPECTS(options.get_stripes().empty(),
+               "Stripe selection is only supported with a single source");
+
+  // Split the selected rows between the sources, in source order
+  auto skip_rows = static_cast<size_t>(std::max(options.get_skip_rows(), 0));
+  auto rows_left = options.get_num_rows() < 0 ? std::numeric_limits<size_t>::max()
+                                              : static_cast<size_t>(options.get_num_rows());
+  table_metadata out_metadata;
+  std::vector<reader::impl::stripe_batch> batches;
+  std::vector<impl *> read_impls;
+  for (auto const &impl : _impls) {
+    if (rows_left == 0) { break; }
+    auto const source_rows = impl->num_rows();
+    if (skip_rows >= source_rows) {
+      skip_rows -= source_rows;
+      continue;
+    }
+    auto const rows = std::min(source_rows - skip_rows, rows_left);
+    batches.push_back(impl->read_stripes(static_cast<size_type>(skip_rows),
+                                         static_cast<size_type>(rows),
+                                         {},
+                                         options.get_filter(),
+                                         false,
+                                         out_metadata.num_pruned_row_groups,
+                                         stream));
+    read_impls.push_back(impl.get());
+    skip_rows = 0;
+    rows_left -= rows;
+  }
+
+  // The sources have the same schema and options, so the stripes of all sources are decoded
+  // together by the reader of the first source that is read
+  auto const decoder = read_impls.empty() ? _impls[0].get() : read_impls[0];
+  auto result        = decoder->decode_stripes(batches, std::move(out_metadata), stream);
+  for (auto const &impl : read_impls) {
+    impl->add_user_data(result.metadata);
+  }
+  return result;
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                               orc_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(sources.size() == 1, "Only a single source is currently supported.");
+  _impl = std::make_unique<impl>(chunk_read_limit, std::move(sources[0]), options, mr, stream);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
 }
 }  // namespace orc
 }  // namespace detail
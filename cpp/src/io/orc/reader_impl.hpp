@@ -18,6 +18,7 @@
 
 #include "orc.h"
 #include "orc_gpu.h"
+#include "timezone.cuh"
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
@@ -27,6 +28,7 @@
 #include <cudf/io/orc.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
 #include <memory>
 #include <string>
@@ -55,19 +57,32 @@ class reader::impl {
    * @brief Constructor from a dataset source with reader options.
    *
    * @param source Dataset source
+   * @param metadata_handle Previously parsed footer of the source, or null to parse it
    * @param options Settings for controlling reading behavior
    * @param mr Device memory resource to use for device memory allocation
    */
   explicit impl(std::unique_ptr<datasource> source,
+                orc_metadata_handle const &metadata_handle,
                 orc_reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
+  /**
+   * @brief Returns the number of rows in the source
+   */
+  size_t num_rows() const;
+
+  /**
+   * @brief Returns whether the source has the same schema as the source of another reader
+   */
+  bool has_same_schema(impl const &other) const;
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param stripes Indices of individual stripes to load if non-empty
+   * @param filter Filter used to skip stripes using their statistics, or null
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
@@ -75,8 +90,99 @@ class reader::impl {
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            const std::vector<size_type> &stripes,
+                           ast::expression const *filter,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Stripes of one source that are read and decompressed, ready to be decoded
+   */
+  struct stripe_batch {
+    hostdevice_vector<gpu::ColumnDesc> chunks;    // One per selected column of each stripe
+    std::vector<rmm::device_buffer> stripe_data;  // Stream data referenced by the chunks
+    rmm::device_uvector<gpu::RowGroup> row_groups{0, rmm::cuda_stream_default};
+    size_t num_stripes      = 0;
+    size_t num_stripe_rows  = 0;  // Rows in the stripes, including the skipped ones
+    size_t num_dict_entries = 0;
+    size_t skip_rows        = 0;  // Rows to skip from the start of the first stripe
+    size_t num_rows         = 0;  // Rows to decode
+    std::string writer_timezone;
+  };
+
+  /**
+   * @brief Reads and decompresses the stripes that contain the selected rows
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read
+   * @param stripes Indices of individual stripes to load if non-empty
+   * @param filter Filter used to skip stripes using their statistics, or null
+   * @param allow_index Whether the row index may be used; stripes that are decoded together with
+   * the stripes of other sources cannot use it
+   * @param[out] num_pruned Incremented by the number of stripes skipped because of the filter
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The stripes ready to be decoded
+   */
+  stripe_batch read_stripes(size_type skip_rows,
+                            size_type num_rows,
+                            const std::vector<size_type> &stripes,
+                            ast::expression const *filter,
+                            bool allow_index,
+                            size_type &num_pruned,
+                            rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Decodes stripes read from this source, or from other sources with the same schema and
+   * options, into one table
+   *
+   * The batches are decoded as consecutive stripes of one source, so that all stripes are decoded
+   * with one set of kernel launches. Only the first batch can skip rows, and only the last one
+   * can end before the end of its stripes.
+   *
+   * @param batches Stripes to decode, in output order
+   * @param out_metadata Metadata to return with the columns; the column names and the user data
+   * of this source are added to it
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata decode_stripes(std::vector<stripe_batch> &batches,
+                                     table_metadata out_metadata,
+                                     rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Adds the user data of the source to the metadata of a table; existing keys are kept
+   */
+  void add_user_data(table_metadata &out_metadata) const;
+
+  /**
+   * @brief Rows of the dataset read as one chunk by the chunked reader
+   */
+  struct chunk_rows {
+    size_type skip_rows = 0;
+    size_type num_rows  = -1;
+    std::vector<size_type> stripes;  // Stripes to read; used instead of the rows when not empty
+  };
+
+  /**
+   * @brief Splits the stripes selected by the options into groups of bounded size
+   *
+   * The size of a stripe is estimated from the types of the selected columns and, for strings,
+   * from the column statistics. Consecutive stripes are read in the same chunk while their total
+   * size fits in the limit, so that each group of stripes is read and decompressed once. Stripes
+   * are never split, and a stripe that exceeds the limit on its own is read as one chunk.
+   *
+   * @param options Settings for controlling reading behavior
+   * @param chunk_read_limit Limit on the estimated size of each chunk, in bytes; 0 for no limit
+   * @param[out] num_pruned Number of stripes skipped because of the filter
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Rows read by each chunk; at least one chunk
+   */
+  std::vector<chunk_rows> plan_chunks(orc_reader_options const &options,
+                                      size_t chunk_read_limit,
+                                      size_type &num_pruned,
+                                      rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Decompresses the stripe data, at stream granularity
@@ -101,6 +207,27 @@ class reader::impl {
                                             size_t row_index_stride,
                                             rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Returns the output types of the selected columns
+   */
+  std::vector<data_type> get_column_types() const;
+
+  /**
+   * @brief Decodes consecutive batches that share one timezone transition table
+   *
+   * @param first First batch to decode
+   * @param last End of the batches to decode
+   * @param column_types Output types of the selected columns
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The decoded columns
+   */
+  std::vector<std::unique_ptr<column>> decode_batches(
+    std::vector<stripe_batch>::iterator first,
+    std::vector<stripe_batch>::iterator last,
+    std::vector<data_type> const &column_types,
+    rmm::cuda_stream_view stream);
+
   /**
    * @brief Converts the stripe column data and outputs to columns
    *
@@ -136,6 +263,52 @@ class reader::impl {
   bool _decimals_as_float64        = true;
   size_type _decimals_as_int_scale = -1;
   data_type _timestamp_type{type_id::EMPTY};
+
+  // Timezone transition table, kept for the following reads of stripes from the same timezone
+  timezone_table _tz_table;
+  std::string _tz_table_name;
+  bool _has_tz_table = false;
+};
+
+/**
+ * @brief Implementation for the chunked ORC reader
+ */
+class chunked_reader::impl {
+ public:
+  /**
+   * @brief Constructor from a dataset source with reader options.
+   *
+   * @param chunk_read_limit Limit on the estimated size of each chunk, in bytes; 0 for no limit
+   * @param source Dataset source
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  explicit impl(size_t chunk_read_limit,
+                std::unique_ptr<datasource> source,
+                orc_reader_options const &options,
+                rmm::mr::device_memory_resource *mr,
+                rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   */
+  bool has_next() const { return _next_chunk < _chunks.size(); }
+
+  /**
+   * @brief Reads the next chunk
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
+ private:
+  reader::impl _reader;
+  std::vector<reader::impl::chunk_rows> _chunks;
+  size_t _next_chunk               = 0;
+  size_type _num_pruned_row_groups = 0;
 };
 
 }  // namespace orc
@@ -17,6 +17,7 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/utilities/bit.hpp>
+#include <io/comp/host_codec.h>
 #include <io/utilities/block_utils.cuh>
 #include <rmm/cuda_stream_view.hpp>
 #include "orc_common.h"
@@ -1230,13 +1231,27 @@ void CompressOrcDataStreams(uint8_t *compressed_data,
                             detail::device_2dspan<encoder_chunk_streams> enc_streams,
                             gpu_inflate_input_s *comp_in,
                             gpu_inflate_status_s *comp_out,
+                            host_span<int const> block_groups,
+                            host_span<int const> group_levels,
                             rmm::cuda_stream_view stream)
 {
   dim3 dim_block_init(256, 1);
   dim3 dim_grid(strm_desc.size().first, strm_desc.size().second);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream.value()>>>(
     strm_desc, enc_streams, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  auto const compress = [&](int group,
+                            gpu_inflate_input_s *in,
+                            gpu_inflate_status_s *out,
+                            int count) {
+    if (compression == SNAPPY) { gpu_snap(in, out, count, stream); }
+    if (compression == ZSTD) {
+      host_compress(host_codec::ZSTD, in, out, count, stream, group_levels[group]);
+    }
+    if (compression == LZ4) { host_compress(host_codec::LZ4, in, out, count, stream); }
+  };
+  CUDF_EXPECTS(block_groups.size() == num_compressed_blocks, "Missing compression block groups");
+  // Skipped blocks keep the non-zero status set above and are stored uncompressed
+  compress_groups(block_groups, comp_in, comp_out, stream, compress);
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream.value()>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
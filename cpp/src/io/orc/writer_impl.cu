@@ -21,6 +21,7 @@
 
 #include "writer_impl.hpp"
 
+#include <io/comp/host_codec.h>
 #include <io/utilities/column_utils.cuh>
 
 #include <cudf/null_mask.hpp>
@@ -65,11 +66,39 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
 }
 
+/**
+ * @brief Function that translates ORC compression to GDF compression
+ */
+compression_type to_compression_type(orc::CompressionKind compression)
+{
+  switch (compression) {
+    case orc::CompressionKind::SNAPPY: return compression_type::SNAPPY;
+    case orc::CompressionKind::ZSTD: return compression_type::ZSTD;
+    case orc::CompressionKind::LZ4: return compression_type::LZ4;
+    default: return compression_type::NONE;
+  }
+}
+
+/**
+ * @brief Checks that compression levels are only set for the columns of ZSTD-compressed files
+ */
+void validate_column_compression(orc::CompressionKind compression,
+                                 std::map<size_type, orc_column_compression> const &settings)
+{
+  CUDF_EXPECTS(compression == orc::CompressionKind::ZSTD ||
+                 std::none_of(settings.cbegin(),
+                              settings.cend(),
+                              [](auto const &col) { return col.second.level.has_value(); }),
+               "Compression levels are only supported with ZSTD");
+}
+
 /**
  * @brief Function that translates GDF dtype to ORC datatype
  */
@@ -958,9 +987,12 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     out_sink_(std::move(sink)),
     single_write_mode(mode == SingleWriteMode::YES),
     user_metadata(options.get_metadata()),
+    column_compression_(options.get_column_compression()),
+    compression_stats_out_(options.get_compression_statistics()),
     stream(stream),
     _mr(mr)
 {
+  validate_column_compression(compression_kind_, column_compression_);
   init_state();
 }
 
@@ -973,9 +1005,12 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     enable_statistics_(options.enable_statistics()),
     out_sink_(std::move(sink)),
     single_write_mode(mode == SingleWriteMode::YES),
+    column_compression_(options.get_column_compression()),
+    compression_stats_out_(options.get_compression_statistics()),
     stream(stream),
     _mr(mr)
 {
+  validate_column_compression(compression_kind_, column_compression_);
   if (options.get_metadata() != nullptr) {
     user_metadata_with_nullability = *options.get_metadata();
     user_metadata                  = &user_metadata_with_nullability;
@@ -1081,16 +1116,35 @@ void writer::impl::write(table_view const &table)
     column_stats = gather_statistic_blobs(*device_columns, orc_columns, stripe_bounds);
   }
 
+  // Compression group of each column; uncompressed columns are in group -1, and the other groups
+  // are indices into the compression levels
+  std::vector<int> group_levels{default_compression_level};
+  std::vector<int> column_groups(num_columns, 0);
+  for (auto const &col : column_compression_) {
+    CUDF_EXPECTS(col.first >= 0 && col.first < num_columns,
+                 "Compression settings for a column that does not exist");
+    if (not col.second.compressed) {
+      column_groups[col.first] = -1;
+    } else if (col.second.level.has_value()) {
+      auto const it = std::find(group_levels.cbegin(), group_levels.cend(), *col.second.level);
+      column_groups[col.first] = std::distance(group_levels.cbegin(), it);
+      if (it == group_levels.cend()) { group_levels.push_back(*col.second.level); }
+    }
+  }
+
   // Allocate intermediate output stream buffer
   size_t compressed_bfr_size   = 0;
   size_t num_compressed_blocks = 0;
-  auto stream_output           = [&]() {
+  std::vector<int> block_groups;
+  std::vector<size_t> column_uncomp_sizes(num_columns, 0);
+  auto stream_output = [&]() {
     size_t max_stream_size = 0;
 
     for (size_t stripe_id = 0; stripe_id < stripe_bounds.size(); stripe_id++) {
       for (size_t i = 0; i < num_data_streams; i++) {  // TODO range for (at least)
         gpu::StripeStream *ss = &strm_descs[stripe_id][i];
         size_t stream_size    = ss->stream_size;
+        column_uncomp_sizes[ss->column_id] += stream_size;
         if (compression_kind_ != NONE) {
           ss->first_block = num_compressed_blocks;
           ss->bfr_offset  = compressed_bfr_size;
@@ -1100,6 +1154,7 @@ void writer::impl::write(table_view const &table)
           stream_size += num_blocks * 3;
           num_compressed_blocks += num_blocks;
           compressed_bfr_size += stream_size;
+          block_groups.insert(block_groups.end(), num_blocks, column_groups[ss->column_id]);
         }
         max_stream_size = std::max(max_stream_size, stream_size);
       }
@@ -1127,11 +1182,34 @@ void writer::impl::write(table_view const &table)
                                 enc_data.streams,
                                 comp_in.device_ptr(),
                                 comp_out.device_ptr(),
+                                block_groups,
+                                group_levels,
                                 stream);
     strm_descs.device_to_host(stream);
     comp_out.device_to_host(stream, true);
   }
 
+  if (ff.headerLength == 0) {
+    // First call
+    compression_stats_.clear();
+    for (auto const &column : orc_columns) {
+      column_compression_statistics col_stats;
+      col_stats.name        = column.orc_name();
+      col_stats.compression = (column_groups[column.id()] < 0)
+                                ? compression_type::NONE
+                                : to_compression_type(compression_kind_);
+      compression_stats_.push_back(col_stats);
+    }
+  }
+  for (size_type col_idx = 0; col_idx < num_columns; ++col_idx) {
+    compression_stats_[col_idx].uncompressed_size += column_uncomp_sizes[col_idx];
+  }
+  for (size_t stripe_id = 0; stripe_id < stripe_bounds.size(); stripe_id++) {
+    for (auto const &strm_desc : strm_descs[stripe_id]) {
+      compression_stats_[strm_desc.column_id].compressed_size += strm_desc.stream_size;
+    }
+  }
+
   ProtobufWriter pbw_(&buffer_);
 
   // Write stripes
@@ -1256,8 +1334,13 @@ void writer::impl::write(table_view const &table)
 
 void writer::impl::close()
 {
-  if (closed) { return; }
+  // Every close() flushes the sink so that pending write errors are thrown to the caller
+  if (closed) {
+    out_sink_->flush();
+    return;
+  }
   closed = true;
+  if (compression_stats_out_ != nullptr) { *compression_stats_out_ = compression_stats_; }
   ProtobufWriter pbw_(&buffer_);
   PostScript ps;
 
@@ -33,6 +33,7 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -374,6 +375,12 @@ class writer::impl {
 
   bool enable_dictionary_ = true;
   bool enable_statistics_ = true;
+  // Per-column compression settings, indexed by column
+  std::map<size_type, orc_column_compression> column_compression_;
+  // Per-column compression statistics, accumulated over all written tables
+  std::vector<column_compression_statistics> compression_stats_;
+  // Optional output for the compression statistics, filled on close
+  std::vector<column_compression_statistics>* compression_stats_out_ = nullptr;
 
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::orc::FileFooter ff;
@@ -120,6 +120,33 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData &s)
   return c.value();
 }
 
+size_t CompactProtocolWriter::write(const PageLocation &p)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, p.offset);
+  c.field_int(2, p.compressed_page_size);
+  c.field_int(3, p.first_row_index);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const OffsetIndex &o)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct_list(1, o.page_locations);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const ColumnIndex &ci)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_bool_list(1, ci.null_pages);
+  c.field_string_list(2, ci.min_values);
+  c.field_string_list(3, ci.max_values);
+  c.field_int(4, static_cast<int32_t>(ci.boundary_order));
+  if (ci.null_counts.size() != 0) { c.field_int64_list(5, ci.null_counts); }
+  return c.value();
+}
+
 void CompactProtocolFieldWriter::put_byte(uint8_t v) { writer.m_buf.push_back(v); }
 
 void CompactProtocolFieldWriter::put_byte(const uint8_t *raw, uint32_t len)
@@ -179,6 +206,24 @@ inline void CompactProtocolFieldWriter::field_int_list(int field, const std::vec
   current_field_value = field;
 }
 
+inline void CompactProtocolFieldWriter::field_int64_list(int field, const std::vector<int64_t> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_I64));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (auto v : val) { put_int(v); }
+  current_field_value = field;
+}
+
+inline void CompactProtocolFieldWriter::field_bool_list(int field, const std::vector<bool> &val)
+{
+  put_field_header(field, current_field_value, ST_FLD_LIST);
+  put_byte((uint8_t)((std::min(val.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));
+  if (val.size() >= 0xf) put_uint(val.size());
+  for (bool v : val) { put_byte(v ? ST_FLD_TRUE : ST_FLD_FALSE); }
+  current_field_value = field;
+}
+
 template <typename T>
 inline void CompactProtocolFieldWriter::field_struct(int field, const T &val)
 {
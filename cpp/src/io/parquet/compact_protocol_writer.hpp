@@ -44,6 +44,9 @@ class CompactProtocolWriter {
   size_t write(const KeyValue &);
   size_t write(const ColumnChunk &);
   size_t write(const ColumnChunkMetaData &);
+  size_t write(const PageLocation &);
+  size_t write(const OffsetIndex &);
+  size_t write(const ColumnIndex &);
 
  protected:
   std::vector<uint8_t> &m_buf;
@@ -78,6 +81,10 @@ class CompactProtocolFieldWriter {
   template <typename Enum>
   inline void field_int_list(int field, const std::vector<Enum> &val);
 
+  inline void field_int64_list(int field, const std::vector<int64_t> &val);
+
+  inline void field_bool_list(int field, const std::vector<bool> &val);
+
   template <typename T>
   inline void field_struct(int field, const T &val);
 
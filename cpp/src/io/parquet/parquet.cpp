@@ -20,22 +20,24 @@
 namespace cudf {
 namespace io {
 namespace parquet {
+// Compact protocol list element types use the struct field type ids, except for booleans
+// which are encoded as one byte per element
 const uint8_t CompactProtocolReader::g_list2struct[16] = {0,
-                                                          1,
-                                                          2,
                                                           ST_FLD_BYTE,
-                                                          ST_FLD_DOUBLE,
-                                                          5,
+                                                          ST_FLD_BYTE,
+                                                          ST_FLD_BYTE,
                                                           ST_FLD_I16,
-                                                          7,
                                                           ST_FLD_I32,
-                                                          9,
                                                           ST_FLD_I64,
+                                                          ST_FLD_DOUBLE,
                                                           ST_FLD_BINARY,
-                                                          ST_FLD_STRUCT,
-                                                          ST_FLD_MAP,
+                                                          ST_FLD_LIST,
                                                           ST_FLD_SET,
-                                                          ST_FLD_LIST};
+                                                          ST_FLD_MAP,
+                                                          ST_FLD_STRUCT,
+                                                          13,
+                                                          14,
+                                                          15};
 
 /**
  * @brief Skips the number of bytes according to the specified struct type
@@ -142,6 +144,20 @@ bool CompactProtocolReader::read(FileMetaData *f)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read_lazy(FileMetaData *f)
+{
+  auto op = std::make_tuple(ParquetFieldInt32(1, f->version),
+                            ParquetFieldStructList(2, f->schema),
+                            ParquetFieldInt64(3, f->num_rows),
+                            ParquetFieldLazyStructList(4, f->row_groups),
+                            ParquetFieldStructList(5, f->key_value_metadata),
+                            ParquetFieldString(6, f->created_by));
+  if (!function_builder(this, op)) { return false; }
+  // The column chunk positions are relative to the start of the footer
+  f->encoded_footer.assign(m_base, m_end);
+  return true;
+}
+
 bool CompactProtocolReader::read(SchemaElement *s)
 {
   auto op = std::make_tuple(ParquetFieldEnum<Type>(1, s->type),
@@ -215,6 +231,14 @@ bool CompactProtocolReader::read(RowGroup *r)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read_lazy(RowGroup *r)
+{
+  auto op = std::make_tuple(ParquetFieldStructSpanList(1, r->encoded_columns),
+                            ParquetFieldInt64(2, r->total_byte_size),
+                            ParquetFieldInt64(3, r->num_rows));
+  return function_builder(this, op);
+}
+
 bool CompactProtocolReader::read(ColumnChunk *c)
 {
   auto op = std::make_tuple(ParquetFieldString(1, c->file_path),
@@ -243,6 +267,17 @@ bool CompactProtocolReader::read(ColumnChunkMetaData *c)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(Statistics *s)
+{
+  auto op = std::make_tuple(ParquetFieldString(1, s->max),
+                            ParquetFieldString(2, s->min),
+                            ParquetFieldInt64(3, s->null_count),
+                            ParquetFieldInt64(4, s->distinct_count),
+                            ParquetFieldString(5, s->max_value),
+                            ParquetFieldString(6, s->min_value));
+  return function_builder(this, op);
+}
+
 bool CompactProtocolReader::read(PageHeader *p)
 {
   auto op = std::make_tuple(ParquetFieldEnum<PageType>(1, p->type),
@@ -275,6 +310,30 @@ bool CompactProtocolReader::read(KeyValue *k)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(PageLocation *p)
+{
+  auto op = std::make_tuple(ParquetFieldInt64(1, p->offset),
+                            ParquetFieldInt32(2, p->compressed_page_size),
+                            ParquetFieldInt64(3, p->first_row_index));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(OffsetIndex *o)
+{
+  auto op = std::make_tuple(ParquetFieldStructList(1, o->page_locations));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(ColumnIndex *c)
+{
+  auto op = std::make_tuple(ParquetFieldBoolList(1, c->null_pages),
+                            ParquetFieldStringList(2, c->min_values),
+                            ParquetFieldStringList(3, c->max_values),
+                            ParquetFieldEnum<BoundaryOrder>(4, c->boundary_order),
+                            ParquetFieldInt64List(5, c->null_counts));
+  return function_builder(this, op);
+}
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -282,6 +341,40 @@ bool CompactProtocolReader::read(KeyValue *k)
  *
  * @return True if schema constructed completely, false otherwise
  */
+namespace {
+
+/**
+ * @brief Sets the schema index of a column chunk from its path in the schema
+ *
+ * @param[in] md File metadata with populated schema
+ * @param[in,out] column Column chunk
+ * @param[in,out] current_schema_index Schema index to start the search from, updated to the
+ * index of the column
+ *
+ * @return True if the path of the column matches a schema element, false otherwise
+ */
+bool map_column_to_schema(FileMetaData const &md, ColumnChunk &column, int &current_schema_index)
+{
+  int parent = 0;  // root of schema
+  for (auto const &path : column.meta_data.path_in_schema) {
+    auto const it = [&] {
+      // find_if starting at (current_schema_index + 1) and then wrapping
+      auto schema = [&](auto const &e) { return e.parent_idx == parent && e.name == path; };
+      auto mid    = md.schema.cbegin() + current_schema_index + 1;
+      auto it     = std::find_if(mid, md.schema.cend(), schema);
+      if (it != md.schema.cend()) return it;
+      return std::find_if(md.schema.cbegin(), mid, schema);
+    }();
+    if (it == md.schema.cend()) return false;
+    current_schema_index = std::distance(md.schema.cbegin(), it);
+    column.schema_idx    = current_schema_index;
+    parent               = current_schema_index;
+  }
+  return true;
+}
+
+}  // namespace
+
 bool CompactProtocolReader::InitSchema(FileMetaData *md)
 {
   if (static_cast<std::size_t>(WalkSchema(md)) != md->schema.size()) return false;
@@ -295,27 +388,28 @@ bool CompactProtocolReader::InitSchema(FileMetaData *md)
   for (auto &row_group : md->row_groups) {
     int current_schema_index = 0;
     for (auto &column : row_group.columns) {
-      int parent = 0;  // root of schema
-      for (auto const &path : column.meta_data.path_in_schema) {
-        auto const it = [&] {
-          // find_if starting at (current_schema_index + 1) and then wrapping
-          auto schema = [&](auto const &e) { return e.parent_idx == parent && e.name == path; };
-          auto mid    = md->schema.cbegin() + current_schema_index + 1;
-          auto it     = std::find_if(mid, md->schema.cend(), schema);
-          if (it != md->schema.cend()) return it;
-          return std::find_if(md->schema.cbegin(), mid, schema);
-        }();
-        if (it == md->schema.cend()) return false;
-        current_schema_index = std::distance(md->schema.cbegin(), it);
-        column.schema_idx    = current_schema_index;
-        parent               = current_schema_index;
-      }
+      if (!map_column_to_schema(*md, column, current_schema_index)) return false;
     }
   }
 
   return true;
 }
 
+bool CompactProtocolReader::DecodeColumnChunk(FileMetaData const &md,
+                                              RowGroup const &row_group,
+                                              size_t column_idx,
+                                              ColumnChunk *chunk)
+{
+  if (column_idx >= row_group.encoded_columns.size()) return false;
+  auto const &span = row_group.encoded_columns[column_idx];
+  if (span.offset + static_cast<size_t>(span.length) > md.encoded_footer.size()) return false;
+
+  CompactProtocolReader cp(md.encoded_footer.data() + span.offset, span.length);
+  *chunk                   = ColumnChunk{};
+  int current_schema_index = 0;
+  return cp.read(chunk) && map_column_to_schema(md, *chunk, current_schema_index);
+}
+
 /**
  * @brief Populates each node in the schema tree
  *
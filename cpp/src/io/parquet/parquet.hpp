@@ -207,6 +207,21 @@ struct SchemaElement {
   }
 };
 
+/**
+ * @brief Thrift-derived struct describing the statistics of a column chunk
+ *
+ * `min` and `max` are deprecated and ordered as signed values; `min_value` and `max_value` use the
+ * sort order of the column's logical type.
+ */
+struct Statistics {
+  std::string max;
+  std::string min;
+  int64_t null_count     = -1;  // Negative if not set
+  int64_t distinct_count = -1;
+  std::string max_value;
+  std::string min_value;
+};
+
 /**
  * @brief Thrift-derived struct describing a column chunk
  */
@@ -248,6 +263,46 @@ struct ColumnChunk {
   int schema_idx = -1;  // Index in flattened schema (derived from path_in_schema)
 };
 
+/**
+ * @brief Thrift-derived struct describing the location of a data page within a column chunk
+ */
+struct PageLocation {
+  int64_t offset               = 0;  // File offset of the page, including its header
+  int32_t compressed_page_size = 0;  // Size of the page, including its header, in bytes
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the locations of the data pages of a column chunk
+ *
+ * Stored in the file outside of the footer; the dictionary page is not included.
+ */
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;
+};
+
+/**
+ * @brief Thrift-derived struct describing the statistics of the data pages of a column chunk
+ *
+ * Stored in the file outside of the footer, with one entry per page of the matching OffsetIndex.
+ * The minimum and maximum values of a page that only contains nulls are empty and meaningless.
+ */
+struct ColumnIndex {
+  std::vector<bool> null_pages;
+  std::vector<std::string> min_values;
+  std::vector<std::string> max_values;
+  BoundaryOrder boundary_order = BoundaryOrder::UNORDERED;
+  std::vector<int64_t> null_counts;  // Optional
+};
+
+/**
+ * @brief Position of an encoded Thrift struct within the footer it was read from
+ */
+struct encoded_span {
+  uint32_t offset = 0;
+  uint32_t length = 0;
+};
+
 /**
  * @brief Thrift-derived struct describing a group of row data
  *
@@ -258,6 +313,11 @@ struct RowGroup {
   int64_t total_byte_size = 0;
   std::vector<ColumnChunk> columns;
   int64_t num_rows = 0;
+
+  // Set instead of `columns` when the footer is read lazily
+  std::vector<encoded_span> encoded_columns;
+
+  size_t num_columns() const { return columns.empty() ? encoded_columns.size() : columns.size(); }
 };
 
 /**
@@ -283,6 +343,19 @@ struct FileMetaData {
   std::vector<KeyValue> key_value_metadata;
   std::string created_by         = "";
   uint32_t column_order_listsize = 0;
+
+  // Encoded footer that the column chunks of lazily read row groups are decoded from
+  std::vector<uint8_t> encoded_footer;
+};
+
+/**
+ * @brief Parsed footers of a set of Parquet sources, with initialized schemas.
+ *
+ * Immutable once parsed, so it can be shared by all readers of the same sources.
+ */
+struct parsed_metadata {
+  std::vector<FileMetaData> per_file_metadata;
+  std::vector<size_t> source_sizes;  // Sizes of the sources the footers were parsed from
 };
 
 /**
@@ -423,10 +496,25 @@ class CompactProtocolReader {
   bool read(RowGroup *r);
   bool read(ColumnChunk *c);
   bool read(ColumnChunkMetaData *c);
+  bool read(Statistics *s);
   bool read(PageHeader *p);
   bool read(DataPageHeader *d);
   bool read(DictionaryPageHeader *d);
   bool read(KeyValue *k);
+  bool read(PageLocation *p);
+  bool read(OffsetIndex *o);
+  bool read(ColumnIndex *c);
+
+  /**
+   * @brief Reads the file metadata without decoding the column chunks of the row groups
+   *
+   * Only the positions of the column chunks are recorded in `RowGroup::encoded_columns`, and the
+   * footer is copied to `FileMetaData::encoded_footer`; use `DecodeColumnChunk` to decode the
+   * chunks that are actually read. Footers of files with many row groups are mostly made of
+   * column chunks, so this avoids materializing the metadata of unselected row groups and columns.
+   */
+  bool read_lazy(FileMetaData *f);
+  bool read_lazy(RowGroup *r);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -435,6 +523,21 @@ class CompactProtocolReader {
   }
   bool InitSchema(FileMetaData *md);
 
+  /**
+   * @brief Decodes a column chunk of a lazily read row group and maps it to the schema
+   *
+   * @param[in] md File metadata read with `read_lazy`, with initialized schema
+   * @param[in] row_group Row group that contains the column chunk
+   * @param[in] column_idx Index of the column chunk within the row group
+   * @param[out] chunk Decoded column chunk
+   *
+   * @return True if the chunk was decoded and matches a schema element, false otherwise
+   */
+  static bool DecodeColumnChunk(FileMetaData const &md,
+                                RowGroup const &row_group,
+                                size_t column_idx,
+                                ColumnChunk *chunk);
+
  protected:
   int WalkSchema(FileMetaData *md,
                  int idx           = 0,
@@ -451,6 +554,8 @@ class CompactProtocolReader {
   friend class ParquetFieldInt8;
   friend class ParquetFieldInt32;
   friend class ParquetFieldInt64;
+  friend class ParquetFieldBoolList;
+  friend class ParquetFieldInt64List;
   template <typename T>
   friend class ParquetFieldStructListFunctor;
   friend class ParquetFieldString;
@@ -464,6 +569,9 @@ class CompactProtocolReader {
   friend class ParquetFieldEnumListFunctor;
   friend class ParquetFieldStringList;
   friend class ParquetFieldStructBlob;
+  template <typename T>
+  friend class ParquetFieldLazyStructListFunctor;
+  friend class ParquetFieldStructSpanList;
 };
 
 /**
@@ -550,6 +658,62 @@ class ParquetFieldInt64 {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of bools from CompactProtocolReader
+ *
+ * List elements are encoded as one byte each, which is 1 for true.
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldBoolList {
+  int field_val;
+  std::vector<bool> &val;
+
+ public:
+  ParquetFieldBoolList(int f, std::vector<bool> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_TRUE && (current_byte & 0xf) != ST_FLD_FALSE) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) { val[i] = (cpr->getb() == ST_FLD_TRUE); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+/**
+ * @brief Functor to read a vector of 64 bit integers from CompactProtocolReader
+ *
+ * @return True if field types mismatch
+ */
+class ParquetFieldInt64List {
+  int field_val;
+  std::vector<int64_t> &val;
+
+ public:
+  ParquetFieldInt64List(int f, std::vector<int64_t> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_I64) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) { val[i] = cpr->get_i64(); }
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 /**
  * @brief Functor to read a vector of structures from CompactProtocolReader
  *
@@ -817,6 +981,81 @@ class ParquetFieldStructBlob {
   int field() { return field_val; }
 };
 
+/**
+ * @brief Functor to read a vector of structures from CompactProtocolReader, without decoding
+ * their nested column chunks
+ *
+ * @return True if field types mismatch or if the process of reading a
+ * struct fails
+ */
+template <typename T>
+class ParquetFieldLazyStructListFunctor {
+  int field_val;
+  std::vector<T> &val;
+
+ public:
+  ParquetFieldLazyStructListFunctor(int f, std::vector<T> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_STRUCT) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      if (!(cpr->read_lazy(&val[i]))) { return true; }
+    }
+
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
+template <typename T>
+ParquetFieldLazyStructListFunctor<T> ParquetFieldLazyStructList(int f, std::vector<T> &v)
+{
+  return ParquetFieldLazyStructListFunctor<T>(f, v);
+}
+
+/**
+ * @brief Functor to record the positions of a vector of structures from CompactProtocolReader,
+ * skipping their content
+ *
+ * @return True if field types mismatch or if a struct cannot be skipped
+ */
+class ParquetFieldStructSpanList {
+  int field_val;
+  std::vector<encoded_span> &val;
+
+ public:
+  ParquetFieldStructSpanList(int f, std::vector<encoded_span> &v) : field_val(f), val(v) {}
+
+  inline bool operator()(CompactProtocolReader *cpr, int field_type)
+  {
+    if (field_type != ST_FLD_LIST) return true;
+
+    int current_byte = cpr->getb();
+    if ((current_byte & 0xf) != ST_FLD_STRUCT) return true;
+    int n = current_byte >> 4;
+    if (n == 0xf) n = cpr->get_u32();
+    val.resize(n);
+    for (int32_t i = 0; i < n; i++) {
+      const uint8_t *start = cpr->m_cur;
+      if (!cpr->skip_struct_field(ST_FLD_STRUCT)) { return true; }
+      val[i].offset = static_cast<uint32_t>(start - cpr->m_base);
+      val[i].length = static_cast<uint32_t>(cpr->m_cur - start);
+    }
+
+    return false;
+  }
+
+  int field() { return field_val; }
+};
+
 }  // namespace parquet
 }  // namespace io
 }  // namespace cudf
@@ -101,6 +101,7 @@ enum Compression {
   BROTLI       = 4,  // Added in 2.3.2
   LZ4          = 5,  // Added in 2.3.2
   ZSTD         = 6,  // Added in 2.3.2
+  LZ4_RAW      = 7,  // Added in 2.9.0
 };
 
 /**
@@ -123,6 +124,15 @@ enum class PageType : uint8_t {
   DATA_PAGE_V2    = 3,
 };
 
+/**
+ * @brief Ordering of the minimum and maximum values of the pages of a column chunk
+ */
+enum class BoundaryOrder : uint8_t {
+  UNORDERED  = 0,
+  ASCENDING  = 1,
+  DESCENDING = 2,
+};
+
 /**
  * @brief Thrift compact protocol struct field types
  */
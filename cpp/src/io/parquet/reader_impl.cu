@@ -22,6 +22,9 @@
 #include "reader_impl.hpp"
 
 #include <io/comp/gpuinflate.h>
+#include <io/comp/host_codec.h>
+#include <io/utilities/statistics_filter.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -34,8 +37,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
 #include <numeric>
 #include <regex>
+#include <tuple>
 
 namespace cudf {
 namespace io {
@@ -230,6 +236,289 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Sets the compressed data pointers of contiguous chunks that were read as a single buffer
+ */
+void set_chunk_data_pointers(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                             size_t begin_chunk,
+                             size_t end_chunk,
+                             uint8_t const *data)
+{
+  for (size_t chunk = begin_chunk; chunk < end_chunk; ++chunk) {
+    chunks[chunk].compressed_data = data;
+    data += chunks[chunk].compressed_size;
+  }
+}
+
+/**
+ * @brief Decodes a little-endian statistics value of the given type, if it has the expected size
+ */
+template <typename T>
+bool decode_statistics_value(std::string const &encoded, T &value)
+{
+  if (encoded.size() != sizeof(T)) { return false; }
+  std::memcpy(&value, encoded.data(), sizeof(T));
+  return true;
+}
+
+/**
+ * @brief Returns the range of the values of a column from their encoded minimum and maximum
+ *
+ * The range type is EMPTY for the types and encodings of values that are not supported: strings,
+ * decimals, INT96 timestamps, and unsigned values that are ordered as signed values.
+ *
+ * @param schema Schema element of the column
+ * @param min Encoded minimum value
+ * @param max Encoded maximum value
+ * @param is_signed_order Whether the values are ordered as signed values, as in legacy statistics
+ * @param null_count Number of null values, negative if unknown
+ * @param num_rows Number of rows the values are from
+ */
+column_value_range encoded_values_to_range(SchemaElement const &schema,
+                                           std::string const &min,
+                                           std::string const &max,
+                                           bool is_signed_order,
+                                           int64_t null_count,
+                                           int64_t num_rows)
+{
+  column_value_range range;
+  range.num_rows   = num_rows;
+  range.null_count = null_count;
+
+  auto const type = data_type{to_type_id(schema, false, type_id::EMPTY, false)};
+  if (is_fixed_point(type) || (!is_numeric(type) && !is_chrono(type))) { return range; }
+  if (schema.converted_type == parquet::DECIMAL) { return range; }
+
+  auto const is_unsigned = type.id() == type_id::UINT8 || type.id() == type_id::UINT16 ||
+                           type.id() == type_id::UINT32 || type.id() == type_id::UINT64;
+  if (is_signed_order && is_unsigned) { return range; }
+
+  switch (schema.type) {
+    case parquet::BOOLEAN: {
+      uint8_t min_val, max_val;
+      if (!decode_statistics_value(min, min_val) || !decode_statistics_value(max, max_val)) {
+        return range;
+      }
+      range.int_min = min_val;
+      range.int_max = max_val;
+    } break;
+    case parquet::INT32: {
+      int32_t min_val, max_val;
+      if (!decode_statistics_value(min, min_val) || !decode_statistics_value(max, max_val)) {
+        return range;
+      }
+      range.int_min = is_unsigned ? static_cast<uint32_t>(min_val) : min_val;
+      range.int_max = is_unsigned ? static_cast<uint32_t>(max_val) : max_val;
+    } break;
+    case parquet::INT64: {
+      int64_t min_val, max_val;
+      if (!decode_statistics_value(min, min_val) || !decode_statistics_value(max, max_val)) {
+        return range;
+      }
+      // Unsigned values above the signed range are stored as negative numbers
+      if (is_unsigned && (min_val < 0 || max_val < 0)) { return range; }
+      range.int_min = min_val;
+      range.int_max = max_val;
+    } break;
+    case parquet::FLOAT: {
+      float min_val, max_val;
+      if (!decode_statistics_value(min, min_val) || !decode_statistics_value(max, max_val) ||
+          std::isnan(min_val) || std::isnan(max_val)) {
+        return range;
+      }
+      range.float_min = min_val;
+      range.float_max = max_val;
+    } break;
+    case parquet::DOUBLE: {
+      double min_val, max_val;
+      if (!decode_statistics_value(min, min_val) || !decode_statistics_value(max, max_val) ||
+          std::isnan(min_val) || std::isnan(max_val)) {
+        return range;
+      }
+      range.float_min = min_val;
+      range.float_max = max_val;
+    } break;
+    default: return range;
+  }
+  range.type = type;
+  return range;
+}
+
+/**
+ * @brief Returns the range of the values of a column chunk from its statistics
+ *
+ * @param schema Schema element of the column
+ * @param col_meta Metadata of the column chunk
+ * @param num_rows Number of rows in the row group
+ */
+column_value_range statistics_to_range(SchemaElement const &schema,
+                                       ColumnChunkMetaData const &col_meta,
+                                       int64_t num_rows)
+{
+  column_value_range range;
+  range.num_rows = num_rows;
+  if (col_meta.statistics_blob.empty()) { return range; }
+
+  // The blob does not include the end of the struct
+  auto blob = col_meta.statistics_blob;
+  blob.push_back(0);
+  Statistics stats;
+  CompactProtocolReader cp(blob.data(), blob.size());
+  if (!cp.read(&stats)) { return range; }
+
+  // Legacy min and max are ordered as signed values
+  auto const has_min_value = !stats.min_value.empty() || !stats.max_value.empty();
+  return encoded_values_to_range(schema,
+                                 has_min_value ? stats.min_value : stats.min,
+                                 has_min_value ? stats.max_value : stats.max,
+                                 !has_min_value,
+                                 stats.null_count,
+                                 num_rows);
+}
+
+/**
+ * @brief Returns the range of the values of a segment of the rows of a page from its column index
+ *
+ * @param schema Schema element of the column
+ * @param column_index Column index of the column chunk
+ * @param page Index of the page that contains the segment
+ * @param num_rows Number of rows in the segment
+ */
+column_value_range page_statistics_to_range(SchemaElement const &schema,
+                                            ColumnIndex const &column_index,
+                                            size_t page,
+                                            int64_t num_rows)
+{
+  if (column_index.null_pages[page]) {
+    column_value_range range;
+    range.num_rows   = num_rows;
+    range.null_count = num_rows;
+    return range;
+  }
+  // The null count of the page is only exact for the segment when the page has no nulls
+  auto const has_no_nulls =
+    !column_index.null_counts.empty() && column_index.null_counts[page] == 0;
+  return encoded_values_to_range(schema,
+                                 column_index.min_values[page],
+                                 column_index.max_values[page],
+                                 false,
+                                 has_no_nulls ? 0 : -1,
+                                 num_rows);
+}
+
+/**
+ * @brief Returns whether the page indexes of a column chunk describe the same pages
+ *
+ * @param offset_index Offset index of the column chunk, possibly empty
+ * @param column_index Column index of the column chunk, possibly empty
+ */
+bool has_page_statistics(OffsetIndex const &offset_index, ColumnIndex const &column_index)
+{
+  auto const num_pages = offset_index.page_locations.size();
+  return num_pages != 0 && offset_index.page_locations[0].first_row_index == 0 &&
+         column_index.null_pages.size() == num_pages &&
+         column_index.min_values.size() == num_pages &&
+         column_index.max_values.size() == num_pages &&
+         (column_index.null_counts.empty() || column_index.null_counts.size() == num_pages);
+}
+
+/**
+ * @brief Selects the data pages of a column chunk that contain the rows to read
+ *
+ * Pages can only be selected when the offset index shows that the data pages are contiguous and
+ * follow any other pages of the chunk, such as the dictionary page, which are always read.
+ *
+ * @param offset_index Offset index of the column chunk
+ * @param chunk_offset File offset of the column chunk
+ * @param chunk_size Size of the column chunk, in bytes
+ * @param num_rows Number of rows in the row group
+ * @param first_row First row to read, relative to the row group
+ * @param end_row Row after the last row to read, relative to the row group
+ * @param[out] ranges File ranges of the pages to read
+ * @param[out] first_page_row First row of the first selected data page, relative to the row group
+ *
+ * @return True if some data pages are skipped, false if the whole chunk is read
+ */
+bool select_pages(OffsetIndex const &offset_index,
+                  size_t chunk_offset,
+                  size_t chunk_size,
+                  int64_t num_rows,
+                  int64_t first_row,
+                  int64_t end_row,
+                  std::vector<datasource::byte_range> &ranges,
+                  int64_t &first_page_row)
+{
+  auto const &locations = offset_index.page_locations;
+  auto const num_pages  = locations.size();
+  if (num_pages == 0 || locations[0].first_row_index != 0 ||
+      locations[0].offset < static_cast<int64_t>(chunk_offset)) {
+    return false;
+  }
+  for (size_t p = 0; p < num_pages; ++p) {
+    auto const page_end = locations[p].offset + locations[p].compressed_page_size;
+    if (p + 1 < num_pages) {
+      if (page_end != locations[p + 1].offset ||
+          locations[p + 1].first_row_index < locations[p].first_row_index) {
+        return false;
+      }
+    } else if (page_end > static_cast<int64_t>(chunk_offset + chunk_size) ||
+               locations[p].first_row_index > num_rows) {
+      return false;
+    }
+  }
+
+  size_t first_page = 0;
+  while (first_page + 1 < num_pages && locations[first_page + 1].first_row_index <= first_row) {
+    ++first_page;
+  }
+  size_t last_page = first_page;
+  while (last_page + 1 < num_pages && locations[last_page + 1].first_row_index < end_row) {
+    ++last_page;
+  }
+  if (first_page == 0 && last_page + 1 == num_pages) { return false; }
+
+  ranges.clear();
+  if (static_cast<size_t>(locations[0].offset) > chunk_offset) {
+    ranges.push_back({chunk_offset, static_cast<size_t>(locations[0].offset) - chunk_offset});
+  }
+  auto const pages_offset = locations[first_page].offset;
+  auto const pages_end    = locations[last_page].offset + locations[last_page].compressed_page_size;
+  ranges.push_back(
+    {static_cast<size_t>(pages_offset), static_cast<size_t>(pages_end - pages_offset)});
+  first_page_row = locations[first_page].first_row_index;
+  return true;
+}
+
+/**
+ * @brief Returns an estimate of the size of the output column data decoded from a column chunk
+ *
+ * Fixed-width values are sized by their output type. Other values are sized by the uncompressed
+ * size of the chunk, which underestimates dictionary-encoded strings.
+ *
+ * @param schema Schema of the column
+ * @param col_meta Metadata of the column chunk
+ * @param column_type_id Output type of the column values
+ *
+ * @return Estimated size in bytes
+ */
+size_t estimate_decoded_size(SchemaElement const &schema,
+                             ColumnChunkMetaData const &col_meta,
+                             type_id column_type_id)
+{
+  auto const num_values = static_cast<size_t>(std::max<int64_t>(col_meta.num_values, 0));
+  size_t size           = 0;
+  if (schema.max_definition_level > 0) { size += (num_values + 7) / 8; }
+  // Offsets of each list level
+  size += schema.max_repetition_level * (num_values + 1) * sizeof(size_type);
+  auto const type = data_type{column_type_id};
+  if (is_fixed_width(type)) {
+    size += num_values * size_of(type);
+  } else {
+    size += (num_values + 1) * sizeof(size_type) + col_meta.total_uncompressed_size;
+  }
+  return size;
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string> &path_in_schema)
@@ -270,49 +559,43 @@ std::string name_from_path(const std::vector<std::string> &path_in_schema)
 }
 
 /**
- * @brief Class for parsing dataset metadata
+ * @brief Reads and parses the footer of a dataset source
  */
-struct metadata : public FileMetaData {
-  explicit metadata(datasource *source)
-  {
-    constexpr auto header_len = sizeof(file_header_s);
-    constexpr auto ender_len  = sizeof(file_ender_s);
-
-    const auto len           = source->size();
-    const auto header_buffer = source->host_read(0, header_len);
-    const auto header        = reinterpret_cast<const file_header_s *>(header_buffer->data());
-    const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
-    const auto ender         = reinterpret_cast<const file_ender_s *>(ender_buffer->data());
-    CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
-    CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
-                 "Corrupted header or footer");
-    CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
-                 "Incorrect footer length");
-
-    const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
-    CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
-    CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
-  }
-};
+FileMetaData parse_file_metadata(datasource *source)
+{
+  constexpr auto header_len = sizeof(file_header_s);
+  constexpr auto ender_len  = sizeof(file_ender_s);
+
+  const auto len           = source->size();
+  const auto header_buffer = source->host_read(0, header_len);
+  const auto header        = reinterpret_cast<const file_header_s *>(header_buffer->data());
+  const auto ender_buffer  = source->host_read(len - ender_len, ender_len);
+  const auto ender         = reinterpret_cast<const file_ender_s *>(ender_buffer->data());
+  CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
+  CUDF_EXPECTS(header->magic == parquet_magic && ender->magic == parquet_magic,
+               "Corrupted header or footer");
+  CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
+               "Incorrect footer length");
+
+  FileMetaData file_metadata;
+  const auto buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
+  CompactProtocolReader cp(buffer->data(), ender->footer_len);
+  CUDF_EXPECTS(cp.read_lazy(&file_metadata), "Cannot parse metadata");
+  CUDF_EXPECTS(cp.InitSchema(&file_metadata), "Cannot initialize schema");
+  return file_metadata;
+}
 
 class aggregate_metadata {
-  std::vector<metadata> const per_file_metadata;
+  std::shared_ptr<cudf::io::parquet::parsed_metadata const> const parsed;
+  std::vector<FileMetaData> const &per_file_metadata;
   std::map<std::string, std::string> const agg_keyval_map;
   size_type const num_rows;
   size_type const num_row_groups;
-  /**
-   * @brief Create a metadata object from each element in the source vector
-   */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const &sources)
-  {
-    std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const &source) {
-        return metadata(source.get());
-      });
-    return metadatas;
-  }
+  // Column chunks of lazily read row groups, by source index, row group index and schema index
+  std::map<std::tuple<size_type, size_type, int>, ColumnChunk> decoded_columns;
+  // Page indexes of the column chunks that were read, with the same keys as `decoded_columns`
+  std::map<std::tuple<size_type, size_type, int>, OffsetIndex> offset_indexes;
+  std::map<std::tuple<size_type, size_type, int>, ColumnIndex> column_indexes;
 
   /**
    * @brief Merge the keyvalue maps from each per-file metadata object into a single map.
@@ -350,20 +633,41 @@ class aggregate_metadata {
   }
 
  public:
-  aggregate_metadata(std::vector<std::unique_ptr<datasource>> const &sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  /**
+   * @brief Create the aggregate view of the previously parsed footers of the sources
+   */
+  aggregate_metadata(std::shared_ptr<cudf::io::parquet::parsed_metadata const> metadata)
+    : parsed(std::move(metadata)),
+      per_file_metadata(parsed->per_file_metadata),
       agg_keyval_map(merge_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
   {
+  }
+
+  /**
+   * @brief Parse the footer of each source and verify that the sources have matching schemas
+   *
+   * The footers are read and parsed concurrently on the I/O thread pool.
+   */
+  static auto parse(std::vector<std::unique_ptr<datasource>> const &sources)
+  {
+    auto result               = std::make_shared<cudf::io::parquet::parsed_metadata>();
+    result->per_file_metadata = detail::parallel_transform(
+      sources.size(), [&](size_t i) { return parse_file_metadata(sources[i].get()); });
+    for (auto const &source : sources) {
+      result->source_sizes.push_back(source->size());
+    }
+    auto const &per_file_metadata = result->per_file_metadata;
+
     // Verify that the input files have matching numbers of columns
     size_type num_cols = -1;
     for (auto const &pfm : per_file_metadata) {
       if (pfm.row_groups.size() != 0) {
         if (num_cols == -1)
-          num_cols = pfm.row_groups[0].columns.size();
+          num_cols = pfm.row_groups[0].num_columns();
         else
-          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm.row_groups[0].columns.size()),
+          CUDF_EXPECTS(num_cols == static_cast<size_type>(pfm.row_groups[0].num_columns()),
                        "All sources must have the same number of columns");
       }
     }
@@ -372,6 +676,7 @@ class aggregate_metadata {
       CUDF_EXPECTS(per_file_metadata[0].schema == pfm.schema,
                    "All sources must have the same schemas");
     }
+    return std::shared_ptr<cudf::io::parquet::parsed_metadata const>(std::move(result));
   }
 
   auto const &get_row_group(size_type row_group_index, size_type src_idx) const
@@ -381,17 +686,53 @@ class aggregate_metadata {
     return per_file_metadata[src_idx].row_groups[row_group_index];
   }
 
-  auto const &get_column_metadata(size_type row_group_index,
-                                  size_type src_idx,
-                                  int schema_idx) const
+  ColumnChunk const &get_column_chunk(size_type row_group_index,
+                                      size_type src_idx,
+                                      int schema_idx) const
   {
+    if (per_file_metadata[src_idx].row_groups[row_group_index].columns.empty()) {
+      auto const col = decoded_columns.find(std::make_tuple(src_idx, row_group_index, schema_idx));
+      CUDF_EXPECTS(col != decoded_columns.end(), "Found no metadata for schema index");
+      return col->second;
+    }
     auto col = std::find_if(
       per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
       per_file_metadata[src_idx].row_groups[row_group_index].columns.end(),
       [schema_idx](ColumnChunk const &col) { return col.schema_idx == schema_idx ? true : false; });
     CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
-    return col->meta_data;
+    return *col;
+  }
+
+  auto const &get_column_metadata(size_type row_group_index,
+                                  size_type src_idx,
+                                  int schema_idx) const
+  {
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
+  }
+
+  /**
+   * @brief Returns the offset index of a column chunk read with `read_page_indexes`
+   */
+  OffsetIndex const &get_offset_index(size_type row_group_index,
+                                      size_type src_idx,
+                                      int schema_idx) const
+  {
+    auto const index = offset_indexes.find(std::make_tuple(src_idx, row_group_index, schema_idx));
+    CUDF_EXPECTS(index != offset_indexes.end(), "Found no offset index for schema index");
+    return index->second;
+  }
+
+  /**
+   * @brief Returns the column index of a column chunk read with `read_page_indexes`
+   */
+  ColumnIndex const &get_column_index(size_type row_group_index,
+                                      size_type src_idx,
+                                      int schema_idx) const
+  {
+    auto const index = column_indexes.find(std::make_tuple(src_idx, row_group_index, schema_idx));
+    CUDF_EXPECTS(index != column_indexes.end(), "Found no column index for schema index");
+    return index->second;
   }
 
   auto get_num_rows() const { return num_rows; }
@@ -547,6 +888,373 @@ class aggregate_metadata {
     return selection;
   }
 
+  /**
+   * @brief Returns the schema index of each top-level column, or -1 for the columns that have no
+   * statistics because they are nested
+   *
+   * @param filter Filter whose referenced columns are checked to be in the file
+   */
+  std::vector<int> get_statistics_schemas(statistics_filter const &filter) const
+  {
+    auto const &schema = per_file_metadata[0].schema;
+    std::vector<int> column_schemas;
+    for (size_t schema_idx = 1; schema_idx < schema.size(); ++schema_idx) {
+      if (schema[schema_idx].parent_idx != 0) { continue; }
+      auto const has_statistics = schema[schema_idx].num_children == 0 &&
+                                  schema[schema_idx].repetition_type != parquet::REPEATED;
+      column_schemas.push_back(has_statistics ? static_cast<int>(schema_idx) : -1);
+    }
+    for (auto const col : filter.get_referenced_columns()) {
+      CUDF_EXPECTS(col >= 0 && col < static_cast<size_type>(column_schemas.size()),
+                   "Filter references a column that is not in the file");
+    }
+    return column_schemas;
+  }
+
+  /**
+   * @brief Returns the schema indices of the columns referenced by the filter that have statistics
+   */
+  static std::vector<int> get_filter_schemas(statistics_filter const &filter,
+                                             std::vector<int> const &column_schemas)
+  {
+    std::vector<int> filter_schemas;
+    for (auto const col : filter.get_referenced_columns()) {
+      if (column_schemas[col] >= 0) { filter_schemas.push_back(column_schemas[col]); }
+    }
+    return filter_schemas;
+  }
+
+  /**
+   * @brief Removes the row groups whose statistics show that none of their rows pass the filter
+   *
+   * @param row_groups Lists of row groups to read, one per source; all row groups if empty
+   * @param filter Filter evaluated on the statistics of each row group
+   * @param[out] num_pruned Number of row groups that were removed
+   *
+   * @return Lists of the remaining row groups, one per source
+   */
+  auto filter_row_groups(std::vector<std::vector<size_type>> const &row_groups,
+                         statistics_filter const &filter,
+                         size_type &num_pruned)
+  {
+    CUDF_EXPECTS(row_groups.empty() || row_groups.size() == per_file_metadata.size(),
+                 "Must specify row groups for each source");
+
+    auto const &schema        = per_file_metadata[0].schema;
+    auto const column_schemas = get_statistics_schemas(filter);
+    auto const filter_schemas = get_filter_schemas(filter, column_schemas);
+
+    std::vector<row_group_info> candidates;
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const num_source_row_groups =
+        static_cast<size_type>(per_file_metadata[src_idx].row_groups.size());
+      if (row_groups.empty()) {
+        for (size_type rg_idx = 0; rg_idx < num_source_row_groups; ++rg_idx) {
+          candidates.emplace_back(rg_idx, 0, src_idx);
+        }
+      } else {
+        for (auto const rg_idx : row_groups[src_idx]) {
+          candidates.emplace_back(rg_idx, 0, src_idx);
+        }
+      }
+    }
+    // Invalid indices are kept, to be reported when selecting the row groups
+    auto const is_valid = [&](row_group_info const &rg) {
+      auto const &pfm = per_file_metadata[rg.source_index];
+      return rg.index >= 0 && rg.index < static_cast<size_type>(pfm.row_groups.size());
+    };
+    std::vector<row_group_info> valid_candidates;
+    std::copy_if(
+      candidates.cbegin(), candidates.cend(), std::back_inserter(valid_candidates), is_valid);
+    decode_column_chunks(valid_candidates, filter_schemas);
+
+    std::vector<std::vector<size_type>> selection(per_file_metadata.size());
+    std::vector<column_value_range> ranges(column_schemas.size());
+    num_pruned = 0;
+    for (auto const &rg : candidates) {
+      if (is_valid(rg)) {
+        auto const &row_group = get_row_group(rg.index, rg.source_index);
+        for (auto const col : filter.get_referenced_columns()) {
+          auto const schema_idx = column_schemas[col];
+          ranges[col]           = column_value_range{};
+          ranges[col].num_rows  = row_group.num_rows;
+          if (schema_idx >= 0) {
+            ranges[col] =
+              statistics_to_range(schema[schema_idx],
+                                  get_column_metadata(rg.index, rg.source_index, schema_idx),
+                                  row_group.num_rows);
+          }
+        }
+        if (!filter.may_match(ranges)) {
+          ++num_pruned;
+          continue;
+        }
+      }
+      selection[rg.source_index].push_back(rg.index);
+    }
+    return selection;
+  }
+
+  /**
+   * @brief Decodes the column chunks of the selected row groups and input columns
+   *
+   * Only the row groups of lazily read footers need to be decoded. Column chunks are stored in
+   * the order of the schema leaves, so the chunk of each input column is decoded directly; all
+   * chunks of a row group that does not follow this order are decoded instead.
+   *
+   * @param row_groups Selected row groups
+   * @param schema_indices Schema indices of the selected input columns
+   */
+  void decode_column_chunks(std::vector<row_group_info> const &row_groups,
+                            std::vector<int> const &schema_indices)
+  {
+    auto const &schema = per_file_metadata[0].schema;
+    for (auto const &rg : row_groups) {
+      auto const &pfm       = per_file_metadata[rg.source_index];
+      auto const &row_group = pfm.row_groups[rg.index];
+      if (!row_group.columns.empty()) { continue; }
+
+      for (auto const schema_idx : schema_indices) {
+        auto const key = std::make_tuple(rg.source_index, rg.index, schema_idx);
+        if (decoded_columns.count(key) != 0) { continue; }
+
+        auto const leaf_idx = std::count_if(schema.cbegin() + 1,
+                                            schema.cbegin() + schema_idx,
+                                            [](auto const &e) { return e.num_children == 0; });
+        ColumnChunk chunk;
+        if (CompactProtocolReader::DecodeColumnChunk(pfm, row_group, leaf_idx, &chunk) &&
+            chunk.schema_idx == schema_idx) {
+          decoded_columns.emplace(key, std::move(chunk));
+          continue;
+        }
+        for (size_t i = 0; i < row_group.encoded_columns.size(); ++i) {
+          CUDF_EXPECTS(CompactProtocolReader::DecodeColumnChunk(pfm, row_group, i, &chunk),
+                       "Cannot parse column chunk metadata");
+          decoded_columns.emplace(std::make_tuple(rg.source_index, rg.index, chunk.schema_idx),
+                                  std::move(chunk));
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Reads the page indexes of the selected column chunks that were not read yet
+   *
+   * The indexes are stored in the file outside of the footer; the indexes of each source are
+   * requested with a single `host_read_ranges` call. Column chunks without page indexes, or with
+   * indexes that cannot be parsed, get empty ones.
+   *
+   * @param sources Dataset sources
+   * @param row_groups Selected row groups
+   * @param schema_indices Schema indices of the selected columns
+   * @param read_column_indexes Whether to also read the column indexes, not only the offset indexes
+   */
+  void read_page_indexes(std::vector<std::unique_ptr<datasource>> const &sources,
+                         std::vector<row_group_info> const &row_groups,
+                         std::vector<int> const &schema_indices,
+                         bool read_column_indexes)
+  {
+    decode_column_chunks(row_groups, schema_indices);
+
+    struct index_read {
+      std::tuple<size_type, size_type, int> key;
+      bool is_column_index;
+      size_type source_index;
+      datasource::byte_range range;
+    };
+    std::vector<index_read> reads;
+    size_t total_read_size = 0;
+    auto const add_read    = [&](auto key, bool is_column_index, auto const &rg, int64_t offset,
+                              int32_t length) {
+      auto const source_size = sources[rg.source_index]->size();
+      if (offset <= 0 || length <= 0 || static_cast<size_t>(offset + length) > source_size) {
+        return false;
+      }
+      reads.push_back({key,
+                       is_column_index,
+                       rg.source_index,
+                       {static_cast<size_t>(offset), static_cast<size_t>(length)}});
+      total_read_size += length;
+      return true;
+    };
+    for (auto const &rg : row_groups) {
+      for (auto const schema_idx : schema_indices) {
+        auto const key    = std::make_tuple(rg.source_index, rg.index, schema_idx);
+        auto const &chunk = get_column_chunk(rg.index, rg.source_index, schema_idx);
+        if (offset_indexes.count(key) == 0 &&
+            !add_read(key, false, rg, chunk.offset_index_offset, chunk.offset_index_length)) {
+          offset_indexes.emplace(key, OffsetIndex{});
+        }
+        if (read_column_indexes && column_indexes.count(key) == 0 &&
+            !add_read(key, true, rg, chunk.column_index_offset, chunk.column_index_length)) {
+          column_indexes.emplace(key, ColumnIndex{});
+        }
+      }
+    }
+    if (reads.empty()) { return; }
+
+    std::vector<uint8_t> host_data(total_read_size);
+    std::vector<std::vector<datasource::read_range>> source_ranges(sources.size());
+    for (size_t i = 0, host_offset = 0; i < reads.size(); ++i) {
+      auto const &range = reads[i].range;
+      source_ranges[reads[i].source_index].push_back(
+        {range.offset, range.size, host_data.data() + host_offset});
+      host_offset += range.size;
+    }
+    for (size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+      if (source_ranges[src_idx].empty()) { continue; }
+      auto const bytes_read = sources[src_idx]->host_read_ranges(source_ranges[src_idx]);
+      for (size_t r = 0; r < bytes_read.size(); ++r) {
+        CUDF_EXPECTS(bytes_read[r] == source_ranges[src_idx][r].size,
+                     "Unexpected end of file while reading the page indexes");
+      }
+    }
+
+    for (size_t i = 0, host_offset = 0; i < reads.size(); ++i) {
+      auto const &read = reads[i];
+      CompactProtocolReader cp(host_data.data() + host_offset, read.range.size);
+      if (read.is_column_index) {
+        ColumnIndex index;
+        if (!cp.read(&index)) { index = ColumnIndex{}; }
+        column_indexes.emplace(read.key, std::move(index));
+      } else {
+        OffsetIndex index;
+        if (!cp.read(&index)) { index = OffsetIndex{}; }
+        offset_indexes.emplace(read.key, std::move(index));
+      }
+      host_offset += read.range.size;
+    }
+  }
+
+  /**
+   * @brief Segment of the rows of a row group, and whether its rows may pass a filter
+   */
+  struct row_segment {
+    int64_t begin;
+    int64_t end;
+    bool may_match;
+  };
+
+  /**
+   * @brief Splits the rows of a row group at the page boundaries of the filter columns, and
+   * evaluates the filter on the column indexes of the pages that contain each segment
+   *
+   * The page indexes of the filter columns must have been read with `read_page_indexes`.
+   *
+   * @param rg Row group
+   * @param filter Filter evaluated on the statistics of each segment
+   * @param column_schemas Schema indices of the top-level columns, from `get_statistics_schemas`
+   */
+  std::vector<row_segment> evaluate_row_segments(row_group_info const &rg,
+                                                 statistics_filter const &filter,
+                                                 std::vector<int> const &column_schemas) const
+  {
+    auto const num_rows = get_row_group(rg.index, rg.source_index).num_rows;
+    auto const &schema  = per_file_metadata[0].schema;
+
+    // Columns whose pages have statistics
+    std::vector<size_type> indexed_columns;
+    std::vector<int64_t> boundaries{0, num_rows};
+    for (auto const col : filter.get_referenced_columns()) {
+      auto const schema_idx = column_schemas[col];
+      if (schema_idx < 0) { continue; }
+      auto const &offset_index = get_offset_index(rg.index, rg.source_index, schema_idx);
+      if (!has_page_statistics(offset_index,
+                               get_column_index(rg.index, rg.source_index, schema_idx))) {
+        continue;
+      }
+      indexed_columns.push_back(col);
+      for (auto const &location : offset_index.page_locations) {
+        if (location.first_row_index < num_rows) { boundaries.push_back(location.first_row_index); }
+      }
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+    std::vector<row_segment> segments;
+    std::vector<column_value_range> ranges(column_schemas.size());
+    for (size_t s = 0; s + 1 < boundaries.size(); ++s) {
+      auto const begin = boundaries[s];
+      auto const end   = boundaries[s + 1];
+      for (auto const col : filter.get_referenced_columns()) {
+        ranges[col]          = column_value_range{};
+        ranges[col].num_rows = end - begin;
+      }
+      for (auto const col : indexed_columns) {
+        auto const schema_idx = column_schemas[col];
+        auto const &locations =
+          get_offset_index(rg.index, rg.source_index, schema_idx).page_locations;
+        auto const &column_index = get_column_index(rg.index, rg.source_index, schema_idx);
+        // Last page that starts at or before the segment
+        auto const page = std::upper_bound(locations.cbegin(),
+                                           locations.cend(),
+                                           begin,
+                                           [](int64_t row, PageLocation const &location) {
+                                             return row < location.first_row_index;
+                                           }) -
+                          locations.cbegin() - 1;
+        ranges[col] =
+          page_statistics_to_range(schema[schema_idx], column_index, page, end - begin);
+      }
+      segments.push_back({begin, end, filter.may_match(ranges)});
+    }
+    return segments;
+  }
+
+  /**
+   * @brief Skips the leading and trailing rows of the selection whose pages cannot pass the filter
+   *
+   * The statistics of the pages are read from the column indexes. Since the rows that are read
+   * are contiguous, only the rows before the first and after the last page that may match are
+   * skipped; the pages of the row groups in between are all read.
+   *
+   * @param sources Dataset sources
+   * @param row_groups Selected row groups
+   * @param filter Filter evaluated on the statistics of the pages
+   * @param[in,out] row_start Starting row of the selection
+   * @param[in,out] row_count Total number of rows selected
+   */
+  void skip_rows_with_page_indexes(std::vector<std::unique_ptr<datasource>> const &sources,
+                                   std::vector<row_group_info> const &row_groups,
+                                   statistics_filter const &filter,
+                                   size_type &row_start,
+                                   size_type &row_count)
+  {
+    auto const column_schemas = get_statistics_schemas(filter);
+    auto const filter_schemas = get_filter_schemas(filter, column_schemas);
+    if (filter_schemas.empty() || row_groups.empty()) { return; }
+
+    int64_t first_row = row_start;
+    int64_t end_row   = static_cast<int64_t>(row_start) + row_count;
+    size_t front      = 0;
+    for (; front < row_groups.size(); ++front) {
+      auto const &rg = row_groups[front];
+      read_page_indexes(sources, {rg}, filter_schemas, true);
+      auto const segments = evaluate_row_segments(rg, filter, column_schemas);
+      auto const match    = std::find_if(
+        segments.cbegin(), segments.cend(), [](auto const &seg) { return seg.may_match; });
+      if (match != segments.cend()) {
+        first_row = std::max<int64_t>(first_row, rg.start_row + match->begin);
+        break;
+      }
+      first_row = rg.start_row + get_row_group(rg.index, rg.source_index).num_rows;
+    }
+    for (size_t back = row_groups.size(); back > front; --back) {
+      auto const &rg = row_groups[back - 1];
+      read_page_indexes(sources, {rg}, filter_schemas, true);
+      auto const segments = evaluate_row_segments(rg, filter, column_schemas);
+      auto const match    = std::find_if(
+        segments.crbegin(), segments.crend(), [](auto const &seg) { return seg.may_match; });
+      if (match != segments.crend()) {
+        end_row = std::min<int64_t>(end_row, rg.start_row + match->end);
+        break;
+      }
+      end_row = rg.start_row;
+    }
+    row_start = static_cast<size_type>(first_row);
+    row_count = static_cast<size_type>(std::max<int64_t>(end_row - first_row, 0));
+  }
+
   /**
    * @brief Build input and output column structures based on schema input. Recursive.
    *
@@ -826,21 +1534,36 @@ void reader::impl::read_column_chunks(
   hostdevice_vector<gpu::ColumnChunkDesc> &chunks,  // TODO const?
   size_t begin_chunk,
   size_t end_chunk,
-  const std::vector<size_t> &column_chunk_offsets,
+  std::vector<std::vector<datasource::byte_range>> const &chunk_ranges,
   std::vector<size_type> const &chunk_source_map,
   rmm::cuda_stream_view stream)
 {
+  // Contiguous range of chunks that are read from the source with a single request
+  struct chunk_read_info {
+    size_t begin_chunk;
+    size_t end_chunk;
+    size_t offset;
+    size_t size;
+  };
+  std::vector<chunk_read_info> device_reads;
+  std::vector<chunk_read_info> host_reads;
+  size_t total_host_read_size = 0;
+
   // Transfer chunk data, coalescing adjacent chunks
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
-    const size_t io_offset   = column_chunk_offsets[chunk];
+    const size_t io_offset   = chunk_ranges[chunk].front().offset;
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
-      const size_t next_offset = column_chunk_offsets[next_chunk];
+    // Chunks with skipped pages are read from several ranges, and are not merged
+    const bool is_split = (chunk_ranges[chunk].size() > 1);
+    while (!is_split && next_chunk < end_chunk) {
+      const size_t next_offset = chunk_ranges[next_chunk].front().offset;
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (chunk_ranges[next_chunk].size() > 1 || next_offset != io_offset + io_size ||
+          is_next_compressed != is_compressed ||
+          chunk_source_map[next_chunk] != chunk_source_map[chunk]) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
@@ -850,23 +1573,76 @@ void reader::impl::read_column_chunks(
       next_chunk++;
     }
     if (io_size != 0) {
-      auto &source = _sources[chunk_source_map[chunk]];
-      if (source->is_device_read_preferred(io_size)) {
-        page_data[chunk] = source->device_read(io_offset, io_size, stream);
+      if (!is_split && _sources[chunk_source_map[chunk]]->is_device_read_preferred(io_size)) {
+        device_reads.push_back({chunk, next_chunk, io_offset, io_size});
       } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), stream));
+        // Host reads are deferred and issued together, so that the source can merge nearby
+        // ranges and service them concurrently
+        host_reads.push_back({chunk, next_chunk, io_offset, io_size});
+        total_host_read_size += io_size;
       }
-      auto d_compdata = page_data[chunk]->data();
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
+    }
+    chunk = next_chunk;
+  }
+
+  // Let the sources start on the host reads while the device reads are in progress
+  std::vector<std::vector<datasource::byte_range>> source_hints(_sources.size());
+  for (auto const &read : host_reads) {
+    auto &hints = source_hints[chunk_source_map[read.begin_chunk]];
+    if (chunk_ranges[read.begin_chunk].size() > 1) {
+      hints.insert(hints.end(),
+                   chunk_ranges[read.begin_chunk].cbegin(),
+                   chunk_ranges[read.begin_chunk].cend());
     } else {
-      chunk = next_chunk;
+      hints.push_back({read.offset, read.size});
     }
   }
+  for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+    if (!source_hints[src_idx].empty()) { _sources[src_idx]->hint_reads(source_hints[src_idx]); }
+  }
+
+  for (auto const &read : device_reads) {
+    page_data[read.begin_chunk] =
+      _sources[chunk_source_map[read.begin_chunk]]->device_read(read.offset, read.size, stream);
+    set_chunk_data_pointers(
+      chunks, read.begin_chunk, read.end_chunk, page_data[read.begin_chunk]->data());
+  }
+  if (host_reads.empty()) { return; }
+
+  std::vector<uint8_t> host_data(total_host_read_size);
+  std::vector<std::vector<datasource::read_range>> source_ranges(_sources.size());
+  for (size_t i = 0, host_offset = 0; i < host_reads.size(); ++i) {
+    auto const &read = host_reads[i];
+    auto &ranges     = source_ranges[chunk_source_map[read.begin_chunk]];
+    if (chunk_ranges[read.begin_chunk].size() > 1) {
+      // The pages that are read are stored contiguously, without the skipped pages
+      auto dst = host_data.data() + host_offset;
+      for (auto const &range : chunk_ranges[read.begin_chunk]) {
+        ranges.push_back({range.offset, range.size, dst});
+        dst += range.size;
+      }
+    } else {
+      ranges.push_back({read.offset, read.size, host_data.data() + host_offset});
+    }
+    host_offset += read.size;
+  }
+  for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+    if (source_ranges[src_idx].empty()) { continue; }
+    auto const bytes_read = _sources[src_idx]->host_read_ranges(source_ranges[src_idx]);
+    for (size_t r = 0; r < bytes_read.size(); ++r) {
+      CUDF_EXPECTS(bytes_read[r] == source_ranges[src_idx][r].size,
+                   "Unexpected end of file while reading the column chunks");
+    }
+  }
+
+  for (size_t i = 0, host_offset = 0; i < host_reads.size(); ++i) {
+    auto const &read            = host_reads[i];
+    page_data[read.begin_chunk] = datasource::buffer::create(
+      rmm::device_buffer(host_data.data() + host_offset, read.size, stream));
+    set_chunk_data_pointers(
+      chunks, read.begin_chunk, read.end_chunk, page_data[read.begin_chunk]->data());
+    host_offset += read.size;
+  }
 }
 
 /**
@@ -932,9 +1708,12 @@ rmm::device_buffer reader::impl::decompress_page_data(
   // Count the exact number of compressed pages
   size_t num_comp_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
-                                                                std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+  std::array<std::pair<parquet::Compression, size_t>, 5> codecs{
+    std::make_pair(parquet::GZIP, 0),
+    std::make_pair(parquet::SNAPPY, 0),
+    std::make_pair(parquet::BROTLI, 0),
+    std::make_pair(parquet::ZSTD, 0),
+    std::make_pair(parquet::LZ4_RAW, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
@@ -956,7 +1735,8 @@ rmm::device_buffer reader::impl::decompress_page_data(
   int32_t argc         = 0;
   for (const auto &codec : codecs) {
     if (codec.second > 0) {
-      int32_t start_pos = argc;
+      int32_t start_pos  = argc;
+      size_t batch_size = 0;
 
       for_each_codec_page(codec.first, [&](size_t page) {
         auto dst_base              = static_cast<uint8_t *>(decomp_pages.data());
@@ -971,6 +1751,7 @@ rmm::device_buffer reader::impl::decompress_page_data(
 
         pages[page].page_data = static_cast<uint8_t *>(inflate_in[argc].dstDevice);
         decomp_offset += inflate_in[argc].dstSize;
+        batch_size += inflate_in[argc].dstSize;
         argc++;
       });
 
@@ -986,17 +1767,33 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                stream.value()));
       switch (codec.first) {
         case parquet::GZIP:
-          CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              1,
-                              stream))
+          if (use_host_decompression(host_codec::GZIP, argc - start_pos, batch_size)) {
+            host_decompress(host_codec::GZIP,
+                            inflate_in.device_ptr(start_pos),
+                            inflate_out.device_ptr(start_pos),
+                            argc - start_pos,
+                            stream);
+          } else {
+            CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
+                                inflate_out.device_ptr(start_pos),
+                                argc - start_pos,
+                                1,
+                                stream))
+          }
           break;
         case parquet::SNAPPY:
-          CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              stream));
+          if (use_host_decompression(host_codec::SNAPPY, argc - start_pos, batch_size)) {
+            host_decompress(host_codec::SNAPPY,
+                            inflate_in.device_ptr(start_pos),
+                            inflate_out.device_ptr(start_pos),
+                            argc - start_pos,
+                            stream);
+          } else {
+            CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
+                                inflate_out.device_ptr(start_pos),
+                                argc - start_pos,
+                                stream));
+          }
           break;
         case parquet::BROTLI:
           CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
@@ -1006,6 +1803,20 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                 argc - start_pos,
                                 stream));
           break;
+        case parquet::ZSTD:
+          host_decompress(host_codec::ZSTD,
+                          inflate_in.device_ptr(start_pos),
+                          inflate_out.device_ptr(start_pos),
+                          argc - start_pos,
+                          stream);
+          break;
+        case parquet::LZ4_RAW:
+          host_decompress(host_codec::LZ4,
+                          inflate_in.device_ptr(start_pos),
+                          inflate_out.device_ptr(start_pos),
+                          argc - start_pos,
+                          stream);
+          break;
         default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
@@ -1373,8 +2184,19 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr), _sources(std::move(sources))
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_metadata>(_sources);
+  // Open and parse the source dataset metadata, unless it was parsed by a previous call
+  auto parsed_metadata = options.get_metadata_handle();
+  if (parsed_metadata != nullptr) {
+    CUDF_EXPECTS(parsed_metadata->source_sizes.size() == _sources.size(),
+                 "Metadata was parsed from a different number of sources");
+    for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+      CUDF_EXPECTS(parsed_metadata->source_sizes[src_idx] == _sources[src_idx]->size(),
+                   "Metadata was parsed from another source");
+    }
+  } else {
+    parsed_metadata = aggregate_metadata::parse(_sources);
+  }
+  _metadata = std::make_unique<aggregate_metadata>(std::move(parsed_metadata));
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1398,19 +2220,83 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
 table_with_metadata reader::impl::read(size_type skip_rows,
                                        size_type num_rows,
                                        std::vector<std::vector<size_type>> const &row_group_list,
+                                       ast::expression const *filter,
                                        rmm::cuda_stream_view stream)
 {
-  // Select only row groups required
-  const auto selected_row_groups =
-    _metadata->select_row_groups(row_group_list, skip_rows, num_rows);
-
   table_metadata out_metadata;
 
+  // Skip the row groups whose statistics do not match the filter
+  std::unique_ptr<statistics_filter> stats_filter;
+  std::vector<std::vector<size_type>> filtered_row_groups;
+  if (filter != nullptr) {
+    stats_filter        = std::make_unique<statistics_filter>(*filter, stream);
+    filtered_row_groups = _metadata->filter_row_groups(
+      row_group_list, *stats_filter, out_metadata.num_pruned_row_groups);
+  }
+
+  // Select only row groups required
+  auto selected_row_groups = _metadata->select_row_groups(
+    filter != nullptr ? filtered_row_groups : row_group_list, skip_rows, num_rows);
+
+  // Skip the leading and trailing pages whose column indexes do not match the filter
+  if (stats_filter != nullptr && !selected_row_groups.empty()) {
+    _metadata->skip_rows_with_page_indexes(
+      _sources, selected_row_groups, *stats_filter, skip_rows, num_rows);
+    std::vector<aggregate_metadata::row_group_info> trimmed_row_groups;
+    std::copy_if(selected_row_groups.cbegin(),
+                 selected_row_groups.cend(),
+                 std::back_inserter(trimmed_row_groups),
+                 [&](auto const &rg) {
+                   auto const end_row =
+                     rg.start_row + _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+                   return end_row > static_cast<size_t>(skip_rows) &&
+                          rg.start_row < static_cast<size_t>(skip_rows) + num_rows;
+                 });
+    selected_row_groups = std::move(trimmed_row_groups);
+  }
+
   // output cudf columns as determined by the top level schema
   std::vector<std::unique_ptr<column>> out_columns;
   out_columns.reserve(_output_columns.size());
 
   if (selected_row_groups.size() != 0 && _input_columns.size() != 0) {
+    // Decode the metadata of the selected column chunks only
+    std::vector<int> input_schema_indices(_input_columns.size());
+    std::transform(_input_columns.cbegin(),
+                   _input_columns.cend(),
+                   input_schema_indices.begin(),
+                   [](auto const &col) { return col.schema_idx; });
+    _metadata->decode_column_chunks(selected_row_groups, input_schema_indices);
+
+    // Only the pages that contain the selected rows are read from the row groups that are not
+    // entirely selected, using the offset indexes of the column chunks. Pages of list columns do
+    // not start at row boundaries in older files, so they are always read entirely.
+    auto const can_skip_pages =
+      std::none_of(_input_columns.cbegin(), _input_columns.cend(), [&](auto const &col) {
+        return _metadata->get_schema(col.schema_idx).max_repetition_level > 0;
+      });
+    auto const row_range_in_group = [&](auto const &rg) {
+      auto const rg_rows   = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+      auto const rg_start  = static_cast<int64_t>(rg.start_row);
+      auto const first_row = std::max<int64_t>(skip_rows - rg_start, 0);
+      auto const end_row =
+        std::min<int64_t>(static_cast<int64_t>(skip_rows) + num_rows - rg_start, rg_rows);
+      return std::make_pair(first_row, end_row);
+    };
+    if (can_skip_pages) {
+      std::vector<aggregate_metadata::row_group_info> partial_row_groups;
+      std::copy_if(selected_row_groups.cbegin(),
+                   selected_row_groups.cend(),
+                   std::back_inserter(partial_row_groups),
+                   [&](auto const &rg) {
+                     auto const rows = row_range_in_group(rg);
+                     return rows.first > 0 ||
+                            rows.second < _metadata->get_row_group(rg.index, rg.source_index)
+                                            .num_rows;
+                   });
+      _metadata->read_page_indexes(_sources, partial_row_groups, input_schema_indices, false);
+    }
+
     // Descriptors for all the chunks that make up the selected columns
     const auto num_input_columns = _input_columns.size();
     const auto num_chunks        = selected_row_groups.size() * num_input_columns;
@@ -1422,8 +2308,8 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     // Tracker for eventually deallocating compressed and uncompressed data
     std::vector<std::unique_ptr<datasource::buffer>> page_data(num_chunks);
 
-    // Keep track of column chunk file offsets
-    std::vector<size_t> column_chunk_offsets(num_chunks);
+    // Keep track of the file ranges of the column chunks
+    std::vector<std::vector<datasource::byte_range>> chunk_ranges(num_chunks);
 
     // if there are lists present, we need to preprocess
     bool has_lists = false;
@@ -1436,7 +2322,6 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       auto const row_group_start  = rg.start_row;
       auto const row_group_source = rg.source_index;
       auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto const io_chunk_idx     = chunks.size();
 
       // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
       for (size_t i = 0; i < num_input_columns; ++i) {
@@ -1466,17 +2351,39 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           schema.converted_type,
           schema.type_length);
 
-        column_chunk_offsets[chunks.size()] =
+        size_t const chunk_offset =
           (col_meta.dictionary_page_offset != 0)
             ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
             : col_meta.data_page_offset;
+        auto &ranges = chunk_ranges[chunks.size()];
+        ranges       = {{chunk_offset, static_cast<size_t>(col_meta.total_compressed_size)}};
+
+        // The first row of the chunk is the first row of its first page that is read
+        auto chunk_start_row = row_group_start;
+        auto const rows      = row_range_in_group(rg);
+        int64_t first_page_row;
+        if (can_skip_pages && (rows.first > 0 || rows.second < row_group.num_rows) &&
+            select_pages(_metadata->get_offset_index(rg.index, rg.source_index, col.schema_idx),
+                         chunk_offset,
+                         col_meta.total_compressed_size,
+                         row_group.num_rows,
+                         rows.first,
+                         rows.second,
+                         ranges,
+                         first_page_row)) {
+          chunk_start_row += first_page_row;
+        }
+        auto const chunk_size = std::accumulate(
+          ranges.cbegin(), ranges.cend(), size_t{0}, [](size_t sum, auto const &range) {
+            return sum + range.size;
+          });
 
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
+        chunks.insert(gpu::ColumnChunkDesc(chunk_size,
                                            nullptr,
                                            col_meta.num_values,
                                            schema.type,
                                            type_width,
-                                           row_group_start,
+                                           chunk_start_row,
                                            row_group_rows,
                                            schema.max_definition_level,
                                            schema.max_repetition_level,
@@ -1497,19 +2404,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
           total_decompressed_size += col_meta.total_uncompressed_size;
         }
       }
-      // Read compressed chunk data to device memory
-      read_column_chunks(page_data,
-                         chunks,
-                         io_chunk_idx,
-                         chunks.size(),
-                         column_chunk_offsets,
-                         chunk_source_map,
-                         stream);
 
       remaining_rows -= row_group.num_rows;
     }
     assert(remaining_rows <= 0);
 
+    // Read compressed chunk data of all row groups to device memory
+    read_column_chunks(
+      page_data, chunks, 0, chunks.size(), chunk_ranges, chunk_source_map, stream);
+
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks, stream);
     if (total_pages > 0) {
@@ -1588,6 +2491,174 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+std::vector<reader::impl::chunk_rows> reader::impl::plan_chunks(
+  parquet_reader_options const &options,
+  size_t chunk_read_limit,
+  size_type &num_pruned,
+  rmm::cuda_stream_view stream)
+{
+  num_pruned      = 0;
+  auto skip_rows  = options.get_skip_rows();
+  auto num_rows   = options.get_num_rows();
+  auto row_groups = options.get_row_groups();
+  if (options.get_filter() != nullptr) {
+    row_groups = _metadata->filter_row_groups(
+      row_groups, statistics_filter(*options.get_filter(), stream), num_pruned);
+  }
+  // Row groups selected by index are read whole
+  auto const split_rows = row_groups.empty();
+
+  auto const selected_row_groups = _metadata->select_row_groups(row_groups, skip_rows, num_rows);
+  std::vector<chunk_rows> chunks;
+  if (chunk_read_limit == 0 || selected_row_groups.empty() || _input_columns.empty()) {
+    chunks.push_back({skip_rows, num_rows, row_groups});
+    return chunks;
+  }
+
+  std::vector<int> input_schema_indices(_input_columns.size());
+  std::transform(_input_columns.cbegin(),
+                 _input_columns.cend(),
+                 input_schema_indices.begin(),
+                 [](auto const &col) { return col.schema_idx; });
+  _metadata->decode_column_chunks(selected_row_groups, input_schema_indices);
+  auto const can_skip_pages =
+    std::none_of(_input_columns.cbegin(), _input_columns.cend(), [&](auto const &col) {
+      return _metadata->get_schema(col.schema_idx).max_repetition_level > 0;
+    });
+
+  // Parts of the selection that are not split further: whole row groups, or ranges of rows
+  struct piece {
+    size_t row_group_pos;  // Position of the row group in the selection
+    int64_t start_row;
+    int64_t end_row;
+    size_t size;
+  };
+  std::vector<piece> pieces;
+  for (size_t pos = 0; pos < selected_row_groups.size(); ++pos) {
+    auto const &rg        = selected_row_groups[pos];
+    auto const &row_group = _metadata->get_row_group(rg.index, rg.source_index);
+
+    size_t rg_size      = 0;
+    size_t largest_size = 0;
+    int largest_schema  = -1;
+    for (auto const schema_idx : input_schema_indices) {
+      auto const &schema = _metadata->get_schema(schema_idx);
+      auto const size    = estimate_decoded_size(
+        schema,
+        _metadata->get_column_metadata(rg.index, rg.source_index, schema_idx),
+        to_type_id(schema, _strings_to_categorical, _timestamp_type.id(), _strict_decimal_types));
+      rg_size += size;
+      if (size > largest_size) {
+        largest_size   = size;
+        largest_schema = schema_idx;
+      }
+    }
+    if (!split_rows) {
+      pieces.push_back({pos, 0, 0, rg_size});
+      continue;
+    }
+
+    auto const rg_start  = static_cast<int64_t>(rg.start_row);
+    auto const first_row = std::max<int64_t>(skip_rows, rg_start);
+    auto const end_row =
+      std::min<int64_t>(static_cast<int64_t>(skip_rows) + num_rows, rg_start + row_group.num_rows);
+    if (end_row <= first_row) { continue; }
+    auto const row_size   = static_cast<double>(rg_size) / row_group.num_rows;
+    auto const piece_size = [&](int64_t start, int64_t end) {
+      return static_cast<size_t>(row_size * (end - start));
+    };
+    if (piece_size(first_row, end_row) <= chunk_read_limit) {
+      pieces.push_back({pos, first_row, end_row, piece_size(first_row, end_row)});
+      continue;
+    }
+
+    // Split at the page boundaries of the largest column, so that its pages are read once
+    std::vector<int64_t> boundaries;
+    if (can_skip_pages && largest_schema >= 0) {
+      _metadata->read_page_indexes(_sources, {rg}, {largest_schema}, false);
+      auto const &offset_index =
+        _metadata->get_offset_index(rg.index, rg.source_index, largest_schema);
+      for (auto const &location : offset_index.page_locations) {
+        auto const row = rg_start + location.first_row_index;
+        if (row > first_row && row < end_row && (boundaries.empty() || row > boundaries.back())) {
+          boundaries.push_back(row);
+        }
+      }
+    }
+    boundaries.push_back(end_row);
+    // Ranges of rows that still exceed the limit, such as large pages, are split evenly
+    auto const max_piece_rows =
+      std::max<int64_t>(1, static_cast<int64_t>(chunk_read_limit / row_size));
+    auto start = first_row;
+    for (auto const boundary : boundaries) {
+      while (start < boundary) {
+        auto const end = std::min(boundary, start + max_piece_rows);
+        pieces.push_back({pos, start, end, piece_size(start, end)});
+        start = end;
+      }
+    }
+  }
+  if (pieces.empty()) {
+    chunks.push_back({skip_rows, num_rows, row_groups});
+    return chunks;
+  }
+
+  // Group consecutive pieces while their total size fits in the limit
+  auto const add_chunk = [&](size_t begin, size_t end) {
+    if (split_rows) {
+      auto const start_row = pieces[begin].start_row;
+      chunks.push_back({static_cast<size_type>(start_row),
+                        static_cast<size_type>(pieces[end - 1].end_row - start_row),
+                        {}});
+    } else {
+      std::vector<std::vector<size_type>> chunk_row_groups(row_groups.size());
+      for (auto p = begin; p < end; ++p) {
+        auto const &rg = selected_row_groups[pieces[p].row_group_pos];
+        chunk_row_groups[rg.source_index].push_back(rg.index);
+      }
+      chunks.push_back({0, -1, std::move(chunk_row_groups)});
+    }
+  };
+  size_t chunk_begin = 0;
+  size_t chunk_size  = 0;
+  for (size_t p = 0; p < pieces.size(); ++p) {
+    if (p > chunk_begin && chunk_size + pieces[p].size > chunk_read_limit) {
+      add_chunk(chunk_begin, p);
+      chunk_begin = p;
+      chunk_size  = 0;
+    }
+    chunk_size += pieces[p].size;
+  }
+  add_chunk(chunk_begin, pieces.size());
+  return chunks;
+}
+
+chunked_reader::impl::impl(size_t chunk_read_limit,
+                           std::vector<std::unique_ptr<datasource>> &&sources,
+                           parquet_reader_options const &options,
+                           rmm::mr::device_memory_resource *mr,
+                           rmm::cuda_stream_view stream)
+  : _reader(std::move(sources), options, mr), _filter(options.get_filter())
+{
+  _chunks = _reader.plan_chunks(options, chunk_read_limit, _num_pruned_row_groups, stream);
+}
+
+table_with_metadata chunked_reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(has_next(), "No chunk left to read");
+  auto const &chunk = _chunks[_next_chunk];
+  // The filter is evaluated again to skip the pages of the row groups in the chunk
+  auto result = _reader.read(chunk.skip_rows,
+                             chunk.num_rows,
+                             chunk.row_groups,
+                             chunk.row_groups.empty() ? nullptr : _filter,
+                             stream);
+  // Row groups pruned while planning are reported with the first chunk
+  if (_next_chunk == 0) { result.metadata.num_pruned_row_groups += _num_pruned_row_groups; }
+  ++_next_chunk;
+  return result;
+}
+
 // Forward to implementation
 reader::reader(std::vector<std::string> const &filepaths,
                parquet_reader_options const &options,
@@ -1604,6 +2675,12 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
 {
 }
 
+std::shared_ptr<cudf::io::parquet::parsed_metadata const> reader::parse_metadata(
+  std::vector<std::unique_ptr<cudf::io::datasource>> const &sources)
+{
+  return aggregate_metadata::parse(sources);
+}
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
@@ -1611,8 +2688,33 @@ reader::~reader() = default;
 table_with_metadata reader::read(parquet_reader_options const &options,
                                  rmm::cuda_stream_view stream)
 {
-  return _impl->read(
-    options.get_skip_rows(), options.get_num_rows(), options.get_row_groups(), stream);
+  return _impl->read(options.get_skip_rows(),
+                     options.get_num_rows(),
+                     options.get_row_groups(),
+                     options.get_filter(),
+                     stream);
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>> &&sources,
+                               parquet_reader_options const &options,
+                               rmm::mr::device_memory_resource *mr,
+                               rmm::cuda_stream_view stream)
+  : _impl(std::make_unique<impl>(chunk_read_limit, std::move(sources), options, mr, stream))
+{
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk(rmm::cuda_stream_view stream)
+{
+  return _impl->read_chunk(stream);
 }
 
 }  // namespace parquet
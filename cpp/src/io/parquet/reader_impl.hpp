@@ -70,6 +70,7 @@ class reader::impl {
    * @param skip_rows Number of rows to skip from the start
    * @param num_rows Number of rows to read
    * @param row_group_indices TODO
+   * @param filter Filter used to skip row groups using their statistics, or null
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    * @return The set of columns along with metadata
@@ -77,17 +78,54 @@ class reader::impl {
   table_with_metadata read(size_type skip_rows,
                            size_type num_rows,
                            std::vector<std::vector<size_type>> const &row_group_indices,
+                           ast::expression const *filter,
                            rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Rows of the dataset read as one chunk by the chunked reader
+   */
+  struct chunk_rows {
+    size_type skip_rows = 0;
+    size_type num_rows  = -1;
+    // Lists of row groups to read, one per source; used instead of the rows when not empty
+    std::vector<std::vector<size_type>> row_groups;
+  };
+
+  /**
+   * @brief Splits the data selected by the options into chunks of bounded size
+   *
+   * The size of a row group is estimated from the metadata of its column chunks. Consecutive row
+   * groups are read in the same chunk while their total size fits in the limit. A row group that
+   * exceeds the limit on its own is split into ranges of rows at the page boundaries of its
+   * largest column, so that each chunk only reads the pages that contain its rows. Row groups are
+   * never split when they are selected by index or with a filter.
+   *
+   * @param options Settings for controlling reading behavior
+   * @param chunk_read_limit Limit on the estimated size of each chunk, in bytes; 0 for no limit
+   * @param[out] num_pruned Number of row groups skipped because of the filter
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return Rows read by each chunk; at least one chunk
+   */
+  std::vector<chunk_rows> plan_chunks(parquet_reader_options const &options,
+                                      size_t chunk_read_limit,
+                                      size_type &num_pruned,
+                                      rmm::cuda_stream_view stream);
+
  private:
   /**
    * @brief Reads compressed page data to device memory
    *
+   * Chunks that are read through the host are requested from each source with a single
+   * `host_read_ranges` call, so that nearby chunks are merged and read concurrently.
+   *
    * @param page_data Buffers to hold compressed page data for each chunk
    * @param chunks List of column chunk descriptors
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
-   * @param column_chunk_offsets File offset for all chunks
+   * @param chunk_ranges File ranges of each chunk; chunks with skipped pages have several ranges,
+   * which are read into a contiguous buffer
+   * @param chunk_source_map Source index of each chunk
    * @param stream CUDA stream used for device memory operations and kernel launches.
    *
    */
@@ -95,7 +133,7 @@ class reader::impl {
                           hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
                           size_t begin_chunk,
                           size_t end_chunk,
-                          const std::vector<size_t> &column_chunk_offsets,
+                          std::vector<std::vector<datasource::byte_range>> const &chunk_ranges,
                           std::vector<size_type> const &chunk_source_map,
                           rmm::cuda_stream_view stream);
 
@@ -213,6 +251,48 @@ class reader::impl {
   bool _strict_decimal_types = false;
 };
 
+/**
+ * @brief Implementation for the chunked Parquet reader
+ */
+class chunked_reader::impl {
+ public:
+  /**
+   * @brief Constructor from an array of dataset sources with reader options.
+   *
+   * @param chunk_read_limit Limit on the estimated size of each chunk, in bytes; 0 for no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  explicit impl(size_t chunk_read_limit,
+                std::vector<std::unique_ptr<datasource>> &&sources,
+                parquet_reader_options const &options,
+                rmm::mr::device_memory_resource *mr,
+                rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns whether there are chunks left to read
+   */
+  bool has_next() const { return _next_chunk < _chunks.size(); }
+
+  /**
+   * @brief Reads the next chunk
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
+ private:
+  reader::impl _reader;
+  ast::expression const *_filter = nullptr;
+  std::vector<reader::impl::chunk_rows> _chunks;
+  size_t _next_chunk               = 0;
+  size_type _num_pruned_row_groups = 0;
+};
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
@@ -21,6 +21,7 @@
 
 #include "writer_impl.hpp"
 
+#include <io/comp/host_codec.h>
 #include <io/parquet/compact_protocol_writer.hpp>
 #include <io/utilities/column_utils.cuh>
 
@@ -63,6 +64,8 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
+    case compression_type::LZ4: return parquet::Compression::LZ4_RAW;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -70,6 +73,118 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Function that translates parquet compression to GDF compression
+ */
+compression_type to_compression_type(parquet::Compression compression)
+{
+  switch (compression) {
+    case parquet::Compression::SNAPPY: return compression_type::SNAPPY;
+    case parquet::Compression::ZSTD: return compression_type::ZSTD;
+    case parquet::Compression::LZ4_RAW: return compression_type::LZ4;
+    default: return compression_type::NONE;
+  }
+}
+
+/**
+ * @brief Compresses a batch of encoded pages with the given codec
+ *
+ * @param codec Parquet codec of the pages
+ * @param level Compression level, or `default_compression_level`
+ */
+void compress_pages(Compression codec,
+                    int level,
+                    gpu_inflate_input_s *comp_in,
+                    gpu_inflate_status_s *comp_out,
+                    int count,
+                    rmm::cuda_stream_view stream)
+{
+  switch (codec) {
+    case Compression::SNAPPY: CUDA_TRY(gpu_snap(comp_in, comp_out, count, stream)); break;
+    case Compression::ZSTD:
+      host_compress(host_codec::ZSTD, comp_in, comp_out, count, stream, level);
+      break;
+    case Compression::LZ4_RAW:
+      host_compress(host_codec::LZ4, comp_in, comp_out, count, stream);
+      break;
+    default: break;
+  }
+}
+
+/**
+ * @brief Encodes a page minimum or maximum value the same way as the column chunk statistics
+ *
+ * @return Empty string if the type of the statistics is not supported
+ */
+std::string encode_page_statistics_value(statistics_val const &value, statistics_dtype dtype)
+{
+  switch (dtype) {
+    case dtype_bool: return std::string(reinterpret_cast<char const *>(&value), 1);
+    case dtype_float32: {
+      auto const fp_val = static_cast<float>(value.fp_val);
+      return std::string(reinterpret_cast<char const *>(&fp_val), sizeof(fp_val));
+    }
+    case dtype_int8:
+    case dtype_int16:
+    case dtype_int32:
+    case dtype_date32: return std::string(reinterpret_cast<char const *>(&value), 4);
+    case dtype_int64:
+    case dtype_timestamp64:
+    case dtype_float64:
+    case dtype_decimal64: return std::string(reinterpret_cast<char const *>(&value), 8);
+    case dtype_decimal128: return std::string(reinterpret_cast<char const *>(&value), 16);
+    default: return {};
+  }
+}
+
+/**
+ * @brief Builds the page indexes of an encoded column chunk
+ *
+ * @param chunk Encoded column chunk
+ * @param pages Encoded pages of the chunk, starting with the dictionary page if any
+ * @param page_stats Statistics of the pages, or null if they were not computed
+ * @param stats_dtype Type of the statistics of the column
+ * @param chunk_offset File offset of the column chunk
+ * @param[out] offset_index Locations of the data pages
+ * @param[out] column_index Statistics of the data pages; left empty if some are not available
+ */
+void build_page_indexes(gpu::EncColumnChunk const &chunk,
+                        gpu::EncPage const *pages,
+                        statistics_chunk const *page_stats,
+                        statistics_dtype stats_dtype,
+                        int64_t chunk_offset,
+                        OffsetIndex &offset_index,
+                        ColumnIndex &column_index)
+{
+  bool has_column_index =
+    page_stats != nullptr && stats_dtype != dtype_string && stats_dtype != dtype_none;
+  int64_t page_offset = chunk_offset;
+  for (uint32_t p = 0; p < chunk.num_pages; ++p) {
+    auto const &page     = pages[p];
+    auto const page_size = page.hdr_size + page.max_data_size;
+    if (page.page_type != PageType::DICTIONARY_PAGE) {
+      offset_index.page_locations.push_back(PageLocation{
+        page_offset, static_cast<int32_t>(page_size), page.start_row - chunk.start_row});
+      if (has_column_index) {
+        auto const &stats   = page_stats[p];
+        bool const all_null = (stats.non_nulls == 0);
+        if (!all_null && !stats.has_minmax) {
+          has_column_index = false;
+        } else {
+          column_index.null_pages.push_back(all_null);
+          column_index.min_values.push_back(
+            all_null ? std::string{} : encode_page_statistics_value(stats.min_value, stats_dtype));
+          column_index.max_values.push_back(
+            all_null ? std::string{} : encode_page_statistics_value(stats.max_value, stats_dtype));
+          column_index.null_counts.push_back(stats.null_count);
+        }
+      }
+    }
+    page_offset += page_size;
+  }
+  if (!has_column_index) { column_index = ColumnIndex{}; }
+}
+
 }  // namespace
 
 struct linked_column_view;
@@ -130,11 +245,14 @@ LinkedColVector input_table_to_linked_columns(table_view const &table)
  * 2. stats_dtype: datatype for statistics calculation required for the data stream of a leaf node.
  * 3. ts_scale: scale to multiply or divide timestamp by in order to convert timestamp to parquet
  *    supported types
+ * 4. compression, compression_level: codec and level of the column, inherited by its children
  */
 struct schema_tree_node : public SchemaElement {
   LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  compression_type compression = compression_type::NONE;
+  int compression_level        = default_compression_level;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -372,7 +490,8 @@ struct leaf_schema_fn {
 std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const &linked_columns,
                                                     table_input_metadata const &metadata,
                                                     bool single_write_mode,
-                                                    bool int96_timestamps)
+                                                    bool int96_timestamps,
+                                                    compression_type compression)
 {
   std::vector<schema_tree_node> schema;
   schema_tree_node root{};
@@ -381,10 +500,19 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const &linke
   root.name            = "schema";
   root.num_children    = linked_columns.size();
   root.parent_idx      = -1;  // root schema has no parent
+  root.compression     = compression;
   schema.push_back(std::move(root));
 
   std::function<void(LinkedColPtr const &, column_in_metadata const &, size_t)> add_schema =
     [&](LinkedColPtr const &col, column_in_metadata const &col_meta, size_t parent_idx) {
+      // Compression settings not set for this column are inherited from its parent
+      auto const col_compression = col_meta.is_compression_set()
+                                     ? col_meta.get_compression()
+                                     : schema[parent_idx].compression;
+      auto const col_compression_level = col_meta.is_compression_level_set()
+                                           ? col_meta.get_compression_level()
+                                           : schema[parent_idx].compression_level;
+
       bool col_nullable = [&]() {
         if (single_write_mode) {
           return col->nullable();
@@ -412,8 +540,10 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const &linke
           col_nullable ? FieldRepetitionType::OPTIONAL : FieldRepetitionType::REQUIRED;
 
         struct_schema.name = (schema[parent_idx].name == "list") ? "element" : col_meta.get_name();
-        struct_schema.num_children = col->num_children();
-        struct_schema.parent_idx   = parent_idx;
+        struct_schema.num_children      = col->num_children();
+        struct_schema.parent_idx        = parent_idx;
+        struct_schema.compression       = col_compression;
+        struct_schema.compression_level = col_compression_level;
         schema.push_back(std::move(struct_schema));
 
         auto struct_node_index = schema.size() - 1;
@@ -436,15 +566,20 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const &linke
         list_schema_1.repetition_type =
           col_nullable ? FieldRepetitionType::OPTIONAL : FieldRepetitionType::REQUIRED;
         list_schema_1.name = (schema[parent_idx].name == "list") ? "element" : col_meta.get_name();
-        list_schema_1.num_children = 1;
-        list_schema_1.parent_idx   = parent_idx;
+        list_schema_1.num_children      = 1;
+        list_schema_1.parent_idx        = parent_idx;
+        list_schema_1.compression       = col_compression;
+        list_schema_1.compression_level = col_compression_level;
         schema.push_back(std::move(list_schema_1));
 
         schema_tree_node list_schema_2{};
-        list_schema_2.repetition_type = FieldRepetitionType::REPEATED;
-        list_schema_2.name            = "list";
-        list_schema_2.num_children    = 1;
-        list_schema_2.parent_idx      = schema.size() - 1;  // Parent is list_schema_1, last added.
+        list_schema_2.repetition_type   = FieldRepetitionType::REPEATED;
+        list_schema_2.name              = "list";
+        list_schema_2.num_children      = 1;
+        // Parent is list_schema_1, last added.
+        list_schema_2.parent_idx        = schema.size() - 1;
+        list_schema_2.compression       = col_compression;
+        list_schema_2.compression_level = col_compression_level;
         schema.push_back(std::move(list_schema_2));
 
         CUDF_EXPECTS(col_meta.num_children() == 2,
@@ -472,8 +607,13 @@ std::vector<schema_tree_node> construct_schema_tree(LinkedColVector const &linke
 
         col_schema.repetition_type = col_nullable ? OPTIONAL : REQUIRED;
         col_schema.name = (schema[parent_idx].name == "list") ? "element" : col_meta.get_name();
-        col_schema.parent_idx  = parent_idx;
-        col_schema.leaf_column = col;
+        col_schema.parent_idx        = parent_idx;
+        col_schema.leaf_column       = col;
+        col_schema.compression       = col_compression;
+        col_schema.compression_level = col_compression_level;
+        CUDF_EXPECTS(col_compression_level == default_compression_level or
+                       to_parquet_compression(col_compression) == Compression::ZSTD,
+                     "Compression levels are only supported with ZSTD");
         schema.push_back(col_schema);
       }
     };
@@ -508,6 +648,8 @@ struct parquet_column_view {
 
   column_view cudf_column_view() const { return cudf_col; }
   parquet::Type physical_type() const { return schema_node.type; }
+  compression_type compression() const { return schema_node.compression; }
+  int compression_level() const { return schema_node.compression_level; }
 
   std::vector<std::string> const &get_path_in_schema() { return path_in_schema; }
 
@@ -821,16 +963,31 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
                                 uint32_t first_rowgroup,
                                 gpu_inflate_input_s *comp_in,
                                 gpu_inflate_status_s *comp_out,
+                                std::vector<std::pair<Compression, int>> const &codecs,
+                                std::vector<int> const &column_codecs,
                                 const statistics_chunk *page_stats,
                                 const statistics_chunk *chunk_stats)
 {
   gpu::EncodePages(
     pages, chunks.device_ptr(), pages_in_batch, first_page_in_batch, comp_in, comp_out, stream);
-  switch (compression_) {
-    case parquet::Compression::SNAPPY:
-      CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
-      break;
-    default: break;
+  if (!codecs.empty()) {
+    // Pages of uncompressed columns keep the non-zero status set by EncodePages
+    std::vector<int> page_codecs(pages_in_batch, -1);
+    for (uint32_t r = first_rowgroup; r < first_rowgroup + rowgroups_in_batch; r++) {
+      for (uint32_t i = 0; i < num_columns; i++) {
+        auto const &ck = chunks[r * num_columns + i];
+        std::fill_n(page_codecs.begin() + (ck.first_page - first_page_in_batch),
+                    ck.num_pages,
+                    column_codecs[i]);
+      }
+    }
+    auto const compress = [&](int codec,
+                              gpu_inflate_input_s *in,
+                              gpu_inflate_status_s *out,
+                              int count) {
+      compress_pages(codecs[codec].first, codecs[codec].second, in, out, count, stream);
+    };
+    compress_groups(page_codecs, comp_in, comp_out, stream, compress);
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
   // chunk-level
@@ -867,9 +1024,10 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
                    rmm::cuda_stream_view stream)
   : _mr(mr),
     stream(stream),
-    compression_(to_parquet_compression(options.get_compression())),
+    compression_(options.get_compression()),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    compression_stats_out_(options.get_compression_statistics()),
     out_sink_(std::move(sink)),
     single_write_mode(mode == SingleWriteMode::YES)
 {
@@ -886,9 +1044,10 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
                    rmm::cuda_stream_view stream)
   : _mr(mr),
     stream(stream),
-    compression_(to_parquet_compression(options.get_compression())),
+    compression_(options.get_compression()),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
+    compression_stats_out_(options.get_compression_statistics()),
     single_write_mode(mode == SingleWriteMode::YES),
     out_sink_(std::move(sink))
 {
@@ -930,7 +1089,8 @@ void writer::impl::write(table_view const &table)
   }
 
   auto vec         = input_table_to_linked_columns(table);
-  auto schema_tree = construct_schema_tree(vec, *table_meta, single_write_mode, int96_timestamps);
+  auto schema_tree =
+    construct_schema_tree(vec, *table_meta, single_write_mode, int96_timestamps, compression_);
   // Construct parquet_column_views from the schema tree leaf nodes.
   std::vector<parquet_column_view> parquet_columns;
 
@@ -947,6 +1107,18 @@ void writer::impl::write(table_view const &table)
 
   std::vector<SchemaElement> this_table_schema(schema_tree.begin(), schema_tree.end());
 
+  // Distinct codec and level pairs of the compressed columns, and the codec index of each column
+  std::vector<std::pair<Compression, int>> codecs;
+  std::vector<int> column_codecs(num_columns, -1);
+  for (size_type i = 0; i < num_columns; i++) {
+    auto const codec = std::make_pair(to_parquet_compression(parquet_columns[i].compression()),
+                                      parquet_columns[i].compression_level());
+    if (codec.first == Compression::UNCOMPRESSED) { continue; }
+    auto const it    = std::find(codecs.begin(), codecs.end(), codec);
+    column_codecs[i] = std::distance(codecs.begin(), it);
+    if (it == codecs.end()) { codecs.push_back(codec); }
+  }
+
   if (md.version == 0) {
     md.version  = 1;
     md.num_rows = num_rows;
@@ -959,6 +1131,16 @@ void writer::impl::write(table_view const &table)
                      return KeyValue{kv.first, kv.second};
                    });
     md.schema = this_table_schema;
+    compression_stats_.clear();
+    for (auto &col : parquet_columns) {
+      auto const &path = col.get_path_in_schema();
+      column_compression_statistics col_stats;
+      col_stats.name = std::accumulate(
+        std::next(path.begin()), path.end(), path.front(), [](auto const &lhs, auto const &rhs) {
+          return lhs + "." + rhs;
+        });
+      compression_stats_.push_back(col_stats);
+    }
   } else {
     // verify the user isn't passing mismatched tables
     CUDF_EXPECTS(md.schema == this_table_schema,
@@ -1158,11 +1340,8 @@ void writer::impl::write(table_view const &table)
 
   // Initialize data pointers in batch
   size_t max_comp_bfr_size =
-    (compression_ != parquet::Compression::UNCOMPRESSED)
-      ? gpu::GetMaxCompressedBfrSize(max_uncomp_bfr_size, max_pages_in_batch)
-      : 0;
-  uint32_t max_comp_pages =
-    (compression_ != parquet::Compression::UNCOMPRESSED) ? max_pages_in_batch : 0;
+    (!codecs.empty()) ? gpu::GetMaxCompressedBfrSize(max_uncomp_bfr_size, max_pages_in_batch) : 0;
+  uint32_t max_comp_pages = (!codecs.empty()) ? max_pages_in_batch : 0;
   uint32_t num_stats_bfr =
     (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? num_pages + num_chunks : 0;
   rmm::device_buffer uncomp_bfr(max_uncomp_bfr_size, stream);
@@ -1197,7 +1376,20 @@ void writer::impl::write(table_view const &table)
                        num_stats_bfr);
   }
 
+  // Page statistics are copied to the host to build the column indexes
+  std::vector<statistics_chunk> host_page_stats(num_stats_bfr != 0 ? num_pages : 0);
+  if (!host_page_stats.empty()) {
+    CUDA_TRY(cudaMemcpyAsync(host_page_stats.data(),
+                             page_stats.data().get(),
+                             num_pages * sizeof(statistics_chunk),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
+  }
+  page_indexes.resize(md.row_groups.size());
+
   pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
+  std::vector<gpu::EncPage> host_pages;
 
   // Encode row groups in batches
   for (uint32_t b = 0, r = 0, global_r = global_rowgroup_base; b < (uint32_t)batch_list.size();
@@ -1218,15 +1410,25 @@ void writer::impl::write(table_view const &table)
       r,
       comp_in.data().get(),
       comp_out.data().get(),
+      codecs,
+      column_codecs,
       (stats_granularity_ == statistics_freq::STATISTICS_PAGE) ? page_stats.data().get() : nullptr,
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
                                                                : nullptr);
+    // Final sizes of the pages in this batch, to locate them in the page indexes
+    host_pages.resize(pages_in_batch);
+    CUDA_TRY(cudaMemcpyAsync(host_pages.data(),
+                             pages.data().get() + first_page_in_batch,
+                             pages_in_batch * sizeof(gpu::EncPage),
+                             cudaMemcpyDeviceToHost,
+                             stream.value()));
+    stream.synchronize();
     for (; r < rnext; r++, global_r++) {
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
         uint8_t *dev_bfr;
         if (ck->is_compressed) {
-          md.row_groups[global_r].columns[i].meta_data.codec = compression_;
+          md.row_groups[global_r].columns[i].meta_data.codec = codecs[column_codecs[i]].first;
           dev_bfr                                            = ck->compressed_bfr;
         } else {
           dev_bfr = ck->uncompressed_bfr;
@@ -1270,6 +1472,16 @@ void writer::impl::write(table_view const &table)
                    ck->ck_stat_size);
           }
         }
+        auto &chunk_indexes = page_indexes[global_r];
+        chunk_indexes.resize(num_columns);
+        build_page_indexes(
+          *ck,
+          host_pages.data() + (ck->first_page - first_page_in_batch),
+          host_page_stats.empty() ? nullptr : host_page_stats.data() + ck->first_page,
+          col_desc[i].stats_dtype,
+          current_chunk_offset,
+          chunk_indexes[i].first,
+          chunk_indexes[i].second);
         md.row_groups[global_r].total_byte_size += ck->compressed_size;
         md.row_groups[global_r].columns[i].meta_data.data_page_offset =
           current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
@@ -1278,6 +1490,15 @@ void writer::impl::write(table_view const &table)
         md.row_groups[global_r].columns[i].meta_data.total_uncompressed_size = ck->bfr_size;
         md.row_groups[global_r].columns[i].meta_data.total_compressed_size   = ck->compressed_size;
         current_chunk_offset += ck->compressed_size;
+        // Chunks that failed to compress or did not shrink are stored, and counted, uncompressed
+        auto &col_stats = compression_stats_[i];
+        col_stats.uncompressed_size += ck->bfr_size;
+        if (ck->is_compressed) {
+          col_stats.compression = to_compression_type(codecs[column_codecs[i]].first);
+          col_stats.compressed_size += ck->compressed_size;
+        } else {
+          col_stats.compressed_size += ck->bfr_size;
+        }
       }
     }
   }
@@ -1286,10 +1507,40 @@ void writer::impl::write(table_view const &table)
 std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
   std::string const &column_chunks_file_path)
 {
-  if (closed) { return nullptr; }
+  // Every close() flushes the sink so that pending write errors are thrown to the caller
+  if (closed) {
+    out_sink_->flush();
+    return nullptr;
+  }
   closed = true;
+  if (compression_stats_out_ != nullptr) { *compression_stats_out_ = compression_stats_; }
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
+
+  // Page indexes are written between the last row group and the footer, column indexes first
+  for (size_t r = 0; r < page_indexes.size(); ++r) {
+    for (size_t i = 0; i < page_indexes[r].size(); ++i) {
+      auto const &column_index = page_indexes[r][i].second;
+      if (column_index.null_pages.empty()) { continue; }
+      buffer_.resize(0);
+      auto &chunk               = md.row_groups[r].columns[i];
+      chunk.column_index_offset = current_chunk_offset;
+      chunk.column_index_length = static_cast<int32_t>(cpw.write(column_index));
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      current_chunk_offset += buffer_.size();
+    }
+  }
+  for (size_t r = 0; r < page_indexes.size(); ++r) {
+    for (size_t i = 0; i < page_indexes[r].size(); ++i) {
+      buffer_.resize(0);
+      auto &chunk               = md.row_groups[r].columns[i];
+      chunk.offset_index_offset = current_chunk_offset;
+      chunk.offset_index_length = static_cast<int32_t>(cpw.write(page_indexes[r][i].first));
+      out_sink_->host_write(buffer_.data(), buffer_.size());
+      current_chunk_offset += buffer_.size();
+    }
+  }
+
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(md));
   fendr.magic      = parquet_magic;
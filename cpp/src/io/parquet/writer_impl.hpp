@@ -37,6 +37,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -198,6 +199,8 @@ class writer::impl {
    * @param first_rowgroup first rowgroup in batch
    * @param comp_in compressor input array
    * @param comp_out compressor status array
+   * @param codecs distinct codec and compression level pairs of the compressed columns
+   * @param column_codecs index of the codec of each column in `codecs`, or -1 if uncompressed
    * @param page_stats optional page-level statistics (nullptr if none)
    * @param chunk_stats optional chunk-level statistics (nullptr if none)
    */
@@ -210,6 +213,8 @@ class writer::impl {
                     uint32_t first_rowgroup,
                     gpu_inflate_input_s* comp_in,
                     gpu_inflate_status_s* comp_out,
+                    std::vector<std::pair<Compression, int>> const& codecs,
+                    std::vector<int> const& column_codecs,
                     const statistics_chunk* page_stats,
                     const statistics_chunk* chunk_stats);
 
@@ -222,13 +227,20 @@ class writer::impl {
   size_t max_rowgroup_size_          = DEFAULT_ROWGROUP_MAXSIZE;
   size_t max_rowgroup_rows_          = DEFAULT_ROWGROUP_MAXROWS;
   size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
-  Compression compression_           = Compression::UNCOMPRESSED;
+  // Default codec of the columns; can be overridden per column in the metadata
+  compression_type compression_      = compression_type::NONE;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
   bool int96_timestamps              = false;
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::parquet::FileMetaData md;
+  // Page indexes of the written column chunks, indexed by row group and column; written by close()
+  std::vector<std::vector<std::pair<OffsetIndex, ColumnIndex>>> page_indexes;
   // optional user metadata
   std::unique_ptr<table_input_metadata> table_meta;
+  // Per-column compression statistics, accumulated over all written tables
+  std::vector<column_compression_statistics> compression_stats_;
+  // Optional output for the compression statistics, filled on close
+  std::vector<column_compression_statistics>* compression_stats_out_ = nullptr;
   // to track if the output has been written to sink
   bool closed = false;
   // current write position for rowgroups/chunks
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/caching_datasource.hpp>
+
+#include <sys/stat.h>
+
+#include <cudf/utilities/error.hpp>
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace cudf {
+namespace io {
+namespace {
+
+/**
+ * @brief Process-wide LRU cache of byte ranges read from datasources.
+ */
+class byte_range_cache {
+ public:
+  /// (source key, source version, source size, offset, length)
+  using key_type  = std::tuple<std::string, int64_t, size_t, size_t, size_t>;
+  using data_type = std::shared_ptr<std::vector<uint8_t> const>;
+
+  static byte_range_cache &instance()
+  {
+    static byte_range_cache _instance(
+      std::stoul(detail::getenv_or("LIBCUDF_BYTE_RANGE_CACHE_SIZE", "0")));
+    return _instance;
+  }
+
+  /**
+   * @brief Returns the cached data for the key and marks it as most recently used, or null.
+   */
+  data_type find(key_type const &key)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const it = _index.find(key);
+    if (it == _index.end()) {
+      ++_stats.misses;
+      _stats.miss_bytes += std::get<4>(key);
+      return nullptr;
+    }
+    _lru.splice(_lru.begin(), _lru, it->second);
+    ++_stats.hits;
+    _stats.hit_bytes += it->second->second->size();
+    return it->second->second;
+  }
+
+  /**
+   * @brief Adds the data to the cache, evicting the least recently used entries as needed.
+   */
+  void insert(key_type const &key, data_type data)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!is_cacheable(data->size()) || _index.count(key) != 0) { return; }
+    _stats.cached_size += data->size();
+    _lru.emplace_front(key, std::move(data));
+    _index.emplace(key, _lru.begin());
+    evict(_budget);
+  }
+
+  /**
+   * @brief Returns whether reads of the given size can be stored in the cache.
+   */
+  bool is_cacheable(size_t size) const { return size != 0 && size <= _budget / 4; }
+
+  size_t budget() const { return _budget; }
+
+  void set_budget(size_t budget)
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _budget = budget;
+    evict(_budget);
+  }
+
+  byte_range_cache_statistics statistics() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _index.clear();
+    _lru.clear();
+    _stats = byte_range_cache_statistics{};
+  }
+
+ private:
+  explicit byte_range_cache(size_t budget) : _budget(budget) {}
+
+  /**
+   * @brief Evicts the least recently used entries until the cached size fits in the limit.
+   *
+   * Must be called with the mutex held.
+   */
+  void evict(size_t limit)
+  {
+    while (_stats.cached_size > limit) {
+      auto const &lru_entry = _lru.back();
+      _stats.cached_size -= lru_entry.second->size();
+      ++_stats.evictions;
+      _index.erase(lru_entry.first);
+      _lru.pop_back();
+    }
+  }
+
+  mutable std::mutex _mutex;
+  std::atomic<size_t> _budget;
+  std::list<std::pair<key_type, data_type>> _lru;  // Most recently used first
+  std::map<key_type, std::list<std::pair<key_type, data_type>>::iterator> _index;
+  byte_range_cache_statistics _stats;
+};
+
+/**
+ * @brief Returns the modification time of the file, in nanoseconds.
+ */
+int64_t file_modification_time(std::string const &filepath)
+{
+  struct stat st;
+  CUDF_EXPECTS(stat(filepath.c_str(), &st) != -1, "Cannot query file modification time");
+  return static_cast<int64_t>(st.st_mtim.tv_sec) * 1'000'000'000 + st.st_mtim.tv_nsec;
+}
+
+}  // namespace
+
+void set_byte_range_cache_budget(size_t budget) { byte_range_cache::instance().set_budget(budget); }
+
+size_t get_byte_range_cache_budget() { return byte_range_cache::instance().budget(); }
+
+byte_range_cache_statistics get_byte_range_cache_statistics()
+{
+  return byte_range_cache::instance().statistics();
+}
+
+void clear_byte_range_cache() { byte_range_cache::instance().clear(); }
+
+caching_datasource::caching_datasource(std::unique_ptr<datasource> source,
+                                       std::string const &filepath)
+  : caching_datasource(std::move(source), filepath, file_modification_time(filepath))
+{
+}
+
+caching_datasource::caching_datasource(std::unique_ptr<datasource> source,
+                                       std::string key,
+                                       int64_t version)
+  : _source(std::move(source)), _key(std::move(key)), _version(version)
+{
+  CUDF_EXPECTS(_source != nullptr, "Cannot cache reads from a null datasource");
+}
+
+std::unique_ptr<datasource::buffer> caching_datasource::host_read(size_t offset, size_t size)
+{
+  auto &cache = byte_range_cache::instance();
+  if (!cache.is_cacheable(size)) { return _source->host_read(offset, size); }
+
+  byte_range_cache::key_type const key{_key, _version, _source->size(), offset, size};
+  auto data = cache.find(key);
+  if (data == nullptr) {
+    auto const buffer = _source->host_read(offset, size);
+    data = std::make_shared<std::vector<uint8_t> const>(buffer->data(),
+                                                        buffer->data() + buffer->size());
+    cache.insert(key, data);
+  }
+  auto const data_ptr  = data->data();
+  auto const data_size = data->size();
+  // The returned buffer shares the ownership of the cached data
+  return std::make_unique<owning_buffer<byte_range_cache::data_type>>(
+    std::move(data), data_ptr, data_size);
+}
+
+size_t caching_datasource::host_read(size_t offset, size_t size, uint8_t *dst)
+{
+  auto &cache = byte_range_cache::instance();
+  if (!cache.is_cacheable(size)) { return _source->host_read(offset, size, dst); }
+
+  byte_range_cache::key_type const key{_key, _version, _source->size(), offset, size};
+  auto const cached = cache.find(key);
+  if (cached != nullptr) {
+    std::memcpy(dst, cached->data(), cached->size());
+    return cached->size();
+  }
+
+  auto const bytes_read = _source->host_read(offset, size, dst);
+  cache.insert(key, std::make_shared<std::vector<uint8_t> const>(dst, dst + bytes_read));
+  return bytes_read;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/chunked_host_buffer_sink.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace cudf {
+namespace io {
+namespace {
+
+void free_pinned_chunk(uint8_t* ptr) { cudaFreeHost(ptr); }
+
+void free_pageable_chunk(uint8_t* ptr) { delete[] ptr; }
+
+}  // namespace
+
+chunked_host_buffer_sink::chunked_host_buffer_sink(size_t chunk_size, bool pinned)
+  : _chunk_size(chunk_size), _pinned(pinned)
+{
+  CUDF_EXPECTS(chunk_size > 0, "The chunk size must be positive");
+}
+
+template <typename CopyFn>
+void chunked_host_buffer_sink::append(size_t size, CopyFn copy)
+{
+  auto const num_chunks = (_size + size + _chunk_size - 1) / _chunk_size;
+  while (_chunks.size() < num_chunks) {
+    if (_pinned) {
+      uint8_t* ptr = nullptr;
+      CUDA_TRY(cudaMallocHost(&ptr, _chunk_size));
+      _chunks.emplace_back(ptr, free_pinned_chunk);
+    } else {
+      _chunks.emplace_back(new uint8_t[_chunk_size], free_pageable_chunk);
+    }
+  }
+
+  for (size_t src_offset = 0; src_offset < size;) {
+    auto const chunk_offset = _size % _chunk_size;
+    auto const len          = std::min(size - src_offset, _chunk_size - chunk_offset);
+    copy(_chunks[_size / _chunk_size].get() + chunk_offset, src_offset, len);
+    src_offset += len;
+    _size += len;
+  }
+}
+
+void chunked_host_buffer_sink::host_write(void const* data, size_t size)
+{
+  auto const src = static_cast<uint8_t const*>(data);
+  append(size, [&](uint8_t* dst, size_t src_offset, size_t len) {
+    std::memcpy(dst, src + src_offset, len);
+  });
+}
+
+void chunked_host_buffer_sink::device_write(void const* gpu_data,
+                                            size_t size,
+                                            rmm::cuda_stream_view stream)
+{
+  auto const src = static_cast<uint8_t const*>(gpu_data);
+  append(size, [&](uint8_t* dst, size_t src_offset, size_t len) {
+    CUDA_TRY(cudaMemcpyAsync(dst, src + src_offset, len, cudaMemcpyDeviceToHost, stream.value()));
+  });
+  stream.synchronize();
+}
+
+std::vector<host_span<uint8_t const>> chunked_host_buffer_sink::chunks() const
+{
+  std::vector<host_span<uint8_t const>> result;
+  for (size_t offset = 0; offset < _size; offset += _chunk_size) {
+    result.emplace_back(_chunks[offset / _chunk_size].get(), std::min(_chunk_size, _size - offset));
+  }
+  return result;
+}
+
+}  // namespace io
+}  // namespace cudf
@@ -16,12 +16,24 @@
 
 #include <fstream>
 
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 #include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <iostream>
+
 namespace cudf {
 namespace io {
 /**
@@ -70,6 +82,144 @@ class file_sink : public data_sink {
   std::unique_ptr<detail::cufile_output_impl> _cufile_out;
 };
 
+/**
+ * @brief Implementation class for storing data into a local file without blocking on the writes.
+ *
+ * Host writes are copied into a ring of aligned staging buffers. Each full buffer is written with
+ * `pwrite` on the I/O thread pool while the caller fills the next one, and the caller only waits
+ * when all buffers are still being written. `flush()` waits for the pending writes and writes the
+ * partially filled buffer, which stays in the ring so that later writes complete it.
+ *
+ * With O_DIRECT, all writes are aligned to the block size: the partial buffer is padded when it is
+ * flushed and the file is then truncated to the number of bytes written. The file space is
+ * preallocated ahead of the writes where the file system supports it.
+ *
+ * Errors of the writes in flight are reported by the next `flush()`, or by the next host write
+ * that waits for the buffer of the failed write.
+ */
+class async_file_sink : public data_sink {
+ public:
+  explicit async_file_sink(std::string const& filepath, bool direct)
+  {
+    auto const flags = O_WRONLY | O_CREAT | O_TRUNC;
+    if (direct) {
+      _fd     = open(filepath.c_str(), flags | O_DIRECT, 0644);
+      _direct = (_fd != -1);
+    }
+    // Not all file systems support O_DIRECT
+    if (_fd == -1) { _fd = open(filepath.c_str(), flags, 0644); }
+    CUDF_EXPECTS(_fd != -1, "Cannot open output file");
+
+    for (auto& buffer : _buffers) {
+      void* ptr = nullptr;
+      CUDF_EXPECTS(posix_memalign(&ptr, alignment, buffer_size) == 0,
+                   "Cannot allocate the output staging buffers");
+      buffer.data.reset(static_cast<uint8_t*>(ptr));
+    }
+  }
+
+  virtual ~async_file_sink()
+  {
+    // The writers flush the sink when they close, so this only fails if a write error was not
+    // reported by an explicit flush(); destructors cannot throw, so the error is logged instead
+    try {
+      flush();
+    } catch (std::exception const& e) {
+      std::cerr << "Failed to write the output file: " << e.what() << std::endl;
+    } catch (...) {
+      std::cerr << "Failed to write the output file" << std::endl;
+    }
+    close(_fd);
+  }
+
+  void host_write(void const* data, size_t size) override
+  {
+    auto src = static_cast<uint8_t const*>(data);
+    while (size > 0) {
+      auto const len = std::min(size, buffer_size - _fill);
+      std::memcpy(_buffers[_current].data.get() + _fill, src, len);
+      _fill += len;
+      _bytes_written += len;
+      src += len;
+      size -= len;
+
+      if (_fill == buffer_size) {
+        preallocate(_buffer_offset + buffer_size);
+        _buffers[_current].pending = detail::io_thread_pool().submit(
+          [this, ptr = _buffers[_current].data.get(), offset = _buffer_offset]() {
+            write_at(ptr, buffer_size, offset);
+          });
+        _buffer_offset += buffer_size;
+        _fill    = 0;
+        _current = (_current + 1) % num_buffers;
+        // The next buffer can only be reused once its previous contents are in the file
+        if (_buffers[_current].pending.valid()) { _buffers[_current].pending.get(); }
+      }
+    }
+  }
+
+  void flush() override
+  {
+    for (auto& buffer : _buffers) {
+      if (buffer.pending.valid()) { buffer.pending.get(); }
+    }
+    if (_fill == 0) { return; }
+
+    auto const size = _direct ? util::round_up_safe(_fill, alignment) : _fill;
+    write_at(_buffers[_current].data.get(), size, _buffer_offset);
+    if (_direct) {
+      CUDF_EXPECTS(ftruncate(_fd, _bytes_written) == 0, "Cannot truncate the output file");
+    }
+  }
+
+  size_t bytes_written() override { return _bytes_written; }
+
+ private:
+  static constexpr size_t buffer_size        = 8 << 20;
+  static constexpr size_t num_buffers        = 4;
+  static constexpr size_t alignment          = 4096;
+  static constexpr size_t preallocation_size = 64 << 20;
+
+  struct aligned_deleter {
+    void operator()(uint8_t* ptr) const { free(ptr); }
+  };
+
+  struct staging_buffer {
+    std::unique_ptr<uint8_t, aligned_deleter> data;
+    std::future<void> pending;  // Write of the buffer contents, if in flight
+  };
+
+  void write_at(uint8_t const* data, size_t size, size_t offset) const
+  {
+    while (size > 0) {
+      auto const written = pwrite(_fd, data, size, offset);
+      CUDF_EXPECTS(written > 0, "Cannot write to the output file");
+      data += written;
+      size -= written;
+      offset += written;
+    }
+  }
+
+  void preallocate(size_t end)
+  {
+    if (not _preallocate || end <= _allocated) { return; }
+    auto const size = std::max(end - _allocated, preallocation_size);
+    // Only an optimization; file systems without fallocate support are written without it
+    _preallocate = (fallocate(_fd, FALLOC_FL_KEEP_SIZE, _allocated, size) == 0);
+    if (_preallocate) { _allocated += size; }
+  }
+
+  int _fd      = -1;
+  bool _direct = false;
+  std::array<staging_buffer, num_buffers> _buffers;
+  size_t _current       = 0;  // Index of the buffer being filled
+  size_t _fill          = 0;  // Number of bytes in the buffer being filled
+  size_t _buffer_offset = 0;  // File offset of the buffer being filled
+  size_t _bytes_written = 0;
+  bool _preallocate     = true;
+  size_t _allocated     = 0;
+};
+
 /**
  * @brief Implementation class for storing data into a std::vector.
  */
@@ -144,9 +294,10 @@ class user_sink_wrapper : public data_sink {
   cudf::io::data_sink* const user_sink;
 };
 
-std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
+std::unique_ptr<data_sink> data_sink::create(const std::string& filepath, file_sink_mode mode)
 {
-  return std::make_unique<file_sink>(filepath);
+  if (mode == file_sink_mode::SYNC) { return std::make_unique<file_sink>(filepath); }
+  return std::make_unique<async_file_sink>(filepath, mode == file_sink_mode::ASYNC_DIRECT);
 }
 
 std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
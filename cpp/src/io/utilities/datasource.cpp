@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/io/caching_datasource.hpp>
 #include <cudf/io/datasource.hpp>
 
 #include <fcntl.h>
@@ -22,13 +23,81 @@
 
 #include <cudf/utilities/error.hpp>
 #include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <numeric>
 
 namespace cudf {
 namespace io {
 namespace {
 
 /**
- * @brief Base class for file input. Only implements direct device reads.
+ * @brief Set of requested ranges that are read from the source with a single call.
+ */
+struct coalesced_range {
+  size_t offset;
+  size_t size;
+  std::vector<size_t> range_indices;  ///< Indices of the requested ranges covered by this read
+};
+
+/**
+ * @brief Merges the ranges that are separated by no more than `max_gap` bytes.
+ *
+ * @return Merged reads, sorted by offset
+ */
+std::vector<coalesced_range> coalesce_ranges(host_span<datasource::read_range const> ranges,
+                                             size_t max_gap)
+{
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+    return ranges[lhs].offset < ranges[rhs].offset;
+  });
+
+  std::vector<coalesced_range> coalesced;
+  for (auto const idx : order) {
+    auto const &range = ranges[idx];
+    if (range.size == 0) { continue; }
+    if (!coalesced.empty() &&
+        range.offset <= coalesced.back().offset + coalesced.back().size + max_gap) {
+      auto &last = coalesced.back();
+      last.size  = std::max(last.size, range.offset + range.size - last.offset);
+      last.range_indices.push_back(idx);
+    } else {
+      coalesced.push_back({range.offset, range.size, {idx}});
+    }
+  }
+  return coalesced;
+}
+
+/**
+ * @brief Copies the data of a merged read to the destinations of the ranges it covers.
+ */
+void scatter_coalesced_read(coalesced_range const &read,
+                            uint8_t const *data,
+                            size_t read_size,
+                            host_span<datasource::read_range const> ranges,
+                            std::vector<size_t> &bytes_read)
+{
+  for (auto const idx : read.range_indices) {
+    auto const &range      = ranges[idx];
+    auto const range_start = range.offset - read.offset;
+    // Range starts past the end of the data; nothing to copy
+    if (range_start >= read_size) { continue; }
+
+    bytes_read[idx] = std::min(range.size, read_size - range_start);
+    std::memcpy(range.dst, data + range_start, bytes_read[idx]);
+  }
+}
+
+/**
+ * @brief Base class for file input. Only implements direct device reads and multi-range reads.
+ *
+ * File sources never modify the file offset of the shared descriptor, so all reads are safe to
+ * issue concurrently from multiple threads.
  */
 class file_source : public datasource {
  public:
@@ -69,7 +138,54 @@ class file_source : public datasource {
 
   size_t size() const override { return _file.size(); }
 
+  /**
+   * @brief Reads the merged ranges concurrently, using positional reads on the IO thread pool.
+   */
+  std::vector<size_t> host_read_ranges(host_span<read_range const> ranges,
+                                       size_t max_gap) override
+  {
+    auto const reads = coalesce_ranges(ranges, max_gap);
+    std::vector<size_t> bytes_read(ranges.size(), 0);
+
+    auto read_one = [&](coalesced_range const &read) {
+      if (read.range_indices.size() == 1) {
+        auto const idx  = read.range_indices.front();
+        bytes_read[idx] = positional_read(ranges[idx].offset, ranges[idx].size, ranges[idx].dst);
+      } else {
+        std::vector<uint8_t> staging(read.size);
+        auto const read_size = positional_read(read.offset, read.size, staging.data());
+        scatter_coalesced_read(read, staging.data(), read_size, ranges, bytes_read);
+      }
+    };
+
+    detail::parallel_for(reads.size(), [&](size_t i) { read_one(reads[i]); });
+    return bytes_read;
+  }
+
  protected:
+  /**
+   * @brief Reads a range of the file with `pread`; does not use or modify the file offset.
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t positional_read(size_t offset, size_t size, uint8_t *dst) const
+  {
+    if (offset >= _file.size()) { return 0; }
+    // Clamp length to available data
+    auto const read_size = std::min(size, _file.size() - offset);
+
+    size_t total_read = 0;
+    while (total_read < read_size) {
+      auto const n =
+        pread(_file.desc(), dst + total_read, read_size - total_read, offset + total_read);
+      if (n == -1 && errno == EINTR) { continue; }
+      CUDF_EXPECTS(n != -1, "read failed");
+      if (n == 0) { break; }
+      total_read += n;
+    }
+    return total_read;
+  }
+
   detail::file_wrapper _file;
 
  private:
@@ -143,10 +259,11 @@ class memory_mapped_source : public file_source {
 };
 
 /**
- * @brief Implementation class for reading from a file using `read` calls
+ * @brief Implementation class for reading from a file using `pread` calls
  *
  * Potentially faster than `memory_mapped_source` when only a small portion of the file is read
- * through the host.
+ * through the host. Positional reads do not use the shared file offset, so concurrent reads from
+ * multiple threads are safe.
  */
 class direct_read_source : public file_source {
  public:
@@ -154,25 +271,20 @@ class direct_read_source : public file_source {
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
-    ssize_t const read_size = std::min(size, _file.size() - offset);
+    auto const read_size = offset < _file.size() ? std::min(size, _file.size() - offset) : 0;
 
     std::vector<uint8_t> v(read_size);
-    CUDF_EXPECTS(read(_file.desc(), v.data(), read_size) == read_size, "read failed");
+    CUDF_EXPECTS(positional_read(offset, read_size, v.data()) == read_size, "read failed");
     return buffer::create(std::move(v));
   }
 
   size_t host_read(size_t offset, size_t size, uint8_t *dst) override
   {
-    lseek(_file.desc(), offset, SEEK_SET);
-
     // Clamp length to available data
-    auto const read_size = std::min(size, _file.size() - offset);
+    auto const read_size = offset < _file.size() ? std::min(size, _file.size() - offset) : 0;
 
-    CUDF_EXPECTS(read(_file.desc(), dst, read_size) == static_cast<ssize_t>(read_size),
-                 "read failed");
+    CUDF_EXPECTS(positional_read(offset, read_size, dst) == read_size, "read failed");
     return read_size;
   }
 };
@@ -198,6 +310,14 @@ class user_datasource_wrapper : public datasource {
     return source->host_read(offset, size);
   }
 
+  std::vector<size_t> host_read_ranges(host_span<read_range const> ranges,
+                                       size_t max_gap) override
+  {
+    return source->host_read_ranges(ranges, max_gap);
+  }
+
+  void hint_reads(host_span<byte_range const> ranges) override { source->hint_reads(ranges); }
+
   bool supports_device_read() const override { return source->supports_device_read(); }
 
   size_t device_read(size_t offset,
@@ -223,18 +343,56 @@ class user_datasource_wrapper : public datasource {
 
 }  // namespace
 
+namespace detail {
+std::unique_ptr<datasource> make_direct_read_source(std::string const &filepath)
+{
+  return std::make_unique<direct_read_source>(filepath.c_str());
+}
+}  // namespace detail
+
+std::vector<size_t> datasource::host_read_ranges(host_span<read_range const> ranges,
+                                                 size_t max_gap)
+{
+  std::vector<size_t> bytes_read(ranges.size(), 0);
+  for (auto const &read : coalesce_ranges(ranges, max_gap)) {
+    if (read.range_indices.size() == 1) {
+      auto const idx  = read.range_indices.front();
+      bytes_read[idx] = host_read(ranges[idx].offset, ranges[idx].size, ranges[idx].dst);
+    } else {
+      auto const buffer = host_read(read.offset, read.size);
+      scatter_coalesced_read(read, buffer->data(), buffer->size(), ranges, bytes_read);
+    }
+  }
+  return bytes_read;
+}
+
 std::unique_ptr<datasource> datasource::create(const std::string &filepath,
                                                size_t offset,
                                                size_t size)
 {
+  std::unique_ptr<datasource> source;
 #ifdef CUFILE_FOUND
   if (detail::cufile_config::instance()->is_required()) {
     // avoid mmap as GDS is expected to be used for most reads
-    return std::make_unique<direct_read_source>(filepath.c_str());
+    source = std::make_unique<direct_read_source>(filepath.c_str());
   }
 #endif
-  // Use our own memory mapping implementation for direct file reads
-  return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
+  if (source == nullptr) {
+    // Use our own memory mapping implementation for direct file reads
+    source = std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
+  }
+  if (get_byte_range_cache_budget() != 0) {
+    // Serve repeated reads of the same ranges (e.g. file footers) from the process-wide cache
+    return std::make_unique<caching_datasource>(std::move(source), filepath);
+  }
+  return source;
+}
+
+std::vector<std::unique_ptr<datasource>> datasource::create(
+  std::vector<std::string> const &filepaths)
+{
+  return detail::parallel_transform(
+    filepaths.size(), [&](size_t i) { return datasource::create(filepaths[i]); });
 }
 
 std::unique_ptr<datasource> datasource::create(host_buffer const &buffer)
@@ -32,6 +32,11 @@ namespace cudf {
 namespace io {
 namespace detail {
 
+/**
+ * @brief Returns the value of an environment variable, or the default value if it is not set.
+ */
+std::string getenv_or(std::string const &env_var_name, std::string const &default_val);
+
 /**
  * @brief Class that provides RAII for file handling.
  */
@@ -264,6 +269,13 @@ std::unique_ptr<cufile_input_impl> make_cufile_input(std::string const &filepath
  */
 std::unique_ptr<cufile_output_impl> make_cufile_output(std::string const &filepath);
 
+/**
+ * @brief Creates a file `datasource` that reads through `pread` calls instead of memory mapping.
+ *
+ * The returned source is safe to read from multiple threads concurrently.
+ */
+std::unique_ptr<datasource> make_direct_read_source(std::string const &filepath);
+
 }  // namespace detail
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/prefetching_datasource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Implementation of the prefetching datasource.
+ *
+ * The plan is a list of entries in read order; overlapping hints are merged, and the parts of a
+ * hint that are already read or being read are not planned again. Background threads read the
+ * first planned entries that fit in the read-ahead window. A read that is fully covered by an entry
+ * is served from it. Since the plan is expected to be read in order, every read drops the entries
+ * that end before it and, on a hit, the entries planned before the one that serves it; hints that
+ * are never read do not hold on to the window.
+ *
+ * Prefetch threads are owned by the object instead of using the shared IO thread pool, so that the
+ * readers can block on prefetches while the pool is busy with the wrapped source's reads.
+ */
+class prefetching_datasource::impl {
+  enum class entry_state { PLANNED, IN_FLIGHT, READY };
+
+  struct entry {
+    size_t offset;
+    size_t size;
+    entry_state state = entry_state::PLANNED;
+    std::vector<uint8_t> data;
+    size_t consumed = 0;
+    std::exception_ptr error;
+  };
+  using entry_ptr = std::shared_ptr<entry>;
+
+ public:
+  impl(std::unique_ptr<datasource> source, size_t read_ahead_size, size_t num_threads)
+    : _source(std::move(source)), _read_ahead_size(read_ahead_size)
+  {
+    CUDF_EXPECTS(_source != nullptr, "Cannot prefetch from a null datasource");
+    num_threads = std::max<size_t>(num_threads, 1);
+    for (size_t i = 0; i < num_threads; ++i) {
+      _workers.emplace_back([this]() { worker_loop(); });
+    }
+  }
+
+  ~impl()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _work_available.notify_all();
+    for (auto& worker : _workers) {
+      worker.join();
+    }
+  }
+
+  void hint_reads(host_span<datasource::byte_range const> ranges)
+  {
+    auto const source_size = _source->size();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (auto const& range : ranges) {
+        if (range.size == 0 || range.offset >= source_size) { continue; }
+        auto begin = range.offset;
+        auto end   = std::min(range.offset + range.size, source_size);
+
+        // The parts that are already read or being read are not planned again
+        for (bool trimmed = true; trimmed && begin < end;) {
+          trimmed = false;
+          for (auto const& e : _plan) {
+            if (e->state == entry_state::PLANNED) { continue; }
+            if (begin >= e->offset && begin < e->offset + e->size) {
+              begin   = e->offset + e->size;
+              trimmed = true;
+            }
+            if (end > e->offset && end <= e->offset + e->size) {
+              end     = e->offset;
+              trimmed = true;
+            }
+          }
+        }
+        if (begin >= end) { continue; }
+
+        // Overlapping planned entries are merged into the first one
+        auto merged = _plan.end();
+        for (auto it = _plan.begin(); it != _plan.end();) {
+          auto const& e = *it;
+          auto const overlaps = e->offset < end && e->offset + e->size > begin;
+          if (e->state != entry_state::PLANNED || !overlaps) {
+            ++it;
+            continue;
+          }
+          begin = std::min(begin, e->offset);
+          end   = std::max(end, e->offset + e->size);
+          if (merged == _plan.end()) {
+            merged = it++;
+          } else {
+            it = _plan.erase(it);
+          }
+        }
+        if (merged != _plan.end()) {
+          (*merged)->offset = begin;
+          (*merged)->size   = end - begin;
+          continue;
+        }
+        auto new_entry    = std::make_shared<entry>();
+        new_entry->offset = begin;
+        new_entry->size   = end - begin;
+        _plan.push_back(std::move(new_entry));
+      }
+    }
+    _work_available.notify_all();
+  }
+
+  /**
+   * @brief Returns the prefetched entry that covers the range, waiting for it if in flight.
+   *
+   * Returns a null pointer if no planned entry covers the range; this is counted as a miss.
+   */
+  entry_ptr acquire(size_t offset, size_t size)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    // The reader moved past the entries that end before the range; drop them to free the window,
+    // whether they were read or not
+    auto const num_entries = _plan.size();
+    for (auto e = _plan.begin(); e != _plan.end();) {
+      e = ((*e)->offset + (*e)->size <= offset) ? erase(e) : std::next(e);
+    }
+    auto const it = std::find_if(_plan.begin(), _plan.end(), [&](auto const& e) {
+      return offset >= e->offset && offset + size <= e->offset + e->size;
+    });
+    if (it == _plan.end()) {
+      ++_stats.misses;
+      auto const dropped = _plan.size() != num_entries;
+      lock.unlock();
+      if (dropped) { _work_available.notify_all(); }
+      return nullptr;
+    }
+
+    auto const found = *it;
+    // Entries planned before the range are not read either
+    for (auto e = _plan.begin(); e != it;) {
+      e = erase(e);
+    }
+    if (found->state == entry_state::PLANNED) {
+      // Not started yet; the caller reads the range directly instead of waiting for a thread
+      erase(it);
+      ++_stats.misses;
+      lock.unlock();
+      _work_available.notify_all();
+      return nullptr;
+    }
+    if (_plan.size() != num_entries) { _work_available.notify_all(); }
+
+    if (found->state == entry_state::IN_FLIGHT) {
+      auto const start = std::chrono::steady_clock::now();
+      _entry_ready.wait(lock, [&]() { return found->state == entry_state::READY; });
+      _stats.stall_time += std::chrono::steady_clock::now() - start;
+      ++_stats.stalls;
+    }
+    if (found->error) {
+      auto const failed = std::find(_plan.begin(), _plan.end(), found);
+      if (failed != _plan.end()) { erase(failed); }
+      std::rethrow_exception(found->error);
+    }
+    ++_stats.hits;
+    return found;
+  }
+
+  /**
+   * @brief Marks the part of the entry as read, and drops the entry once it is fully read.
+   */
+  void release(entry_ptr const& e, size_t size)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      e->consumed += size;
+      if (e->consumed < e->size) { return; }
+      auto const it = std::find(_plan.begin(), _plan.end(), e);
+      if (it != _plan.end()) { erase(it); }
+    }
+    _work_available.notify_all();
+  }
+
+  std::unique_ptr<datasource::buffer> host_read(size_t offset, size_t size)
+  {
+    auto e = acquire(offset, size);
+    if (e == nullptr) { return _source->host_read(offset, size); }
+
+    release(e, size);
+    auto const data_ptr = e->data.data() + (offset - e->offset);
+    // The buffer shares the ownership of the entry's data
+    return std::make_unique<datasource::owning_buffer<entry_ptr>>(std::move(e), data_ptr, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst)
+  {
+    auto const e = acquire(offset, size);
+    if (e == nullptr) { return _source->host_read(offset, size, dst); }
+
+    std::memcpy(dst, e->data.data() + (offset - e->offset), size);
+    release(e, size);
+    return size;
+  }
+
+  std::vector<size_t> host_read_ranges(host_span<datasource::read_range const> ranges,
+                                       size_t max_gap)
+  {
+    std::vector<size_t> bytes_read(ranges.size(), 0);
+    std::vector<datasource::read_range> missed_ranges;
+    std::vector<size_t> missed_indices;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      auto const& range = ranges[i];
+      if (range.size == 0) { continue; }
+      auto const e = acquire(range.offset, range.size);
+      if (e == nullptr) {
+        missed_ranges.push_back(range);
+        missed_indices.push_back(i);
+        continue;
+      }
+      std::memcpy(range.dst, e->data.data() + (range.offset - e->offset), range.size);
+      release(e, range.size);
+      bytes_read[i] = range.size;
+    }
+
+    // Reads not covered by the plan are still coalesced by the wrapped source
+    if (!missed_ranges.empty()) {
+      auto const missed_bytes_read = _source->host_read_ranges(missed_ranges, max_gap);
+      for (size_t i = 0; i < missed_indices.size(); ++i) {
+        bytes_read[missed_indices[i]] = missed_bytes_read[i];
+      }
+    }
+    return bytes_read;
+  }
+
+  datasource* source() const { return _source.get(); }
+
+  prefetch_statistics statistics() const
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+  }
+
+ private:
+  /**
+   * @brief Removes an entry from the plan, returning its bytes to the read-ahead window.
+   *
+   * Must be called with the mutex held. In-flight entries are completed by the worker, which holds
+   * its own reference to the entry.
+   */
+  std::list<entry_ptr>::iterator erase(std::list<entry_ptr>::iterator it)
+  {
+    if ((*it)->state != entry_state::PLANNED) { _window_bytes -= (*it)->size; }
+    return _plan.erase(it);
+  }
+
+  /**
+   * @brief Returns the first planned entry that fits in the read-ahead window.
+   *
+   * Must be called with the mutex held. An entry larger than the window is prefetched only when
+   * nothing else is buffered, so that large ranges are not skipped.
+   */
+  entry_ptr next_prefetch() const
+  {
+    for (auto const& e : _plan) {
+      if (e->state != entry_state::PLANNED) { continue; }
+      if (_window_bytes == 0 || _window_bytes + e->size <= _read_ahead_size) { return e; }
+      return nullptr;
+    }
+    return nullptr;
+  }
+
+  void worker_loop()
+  {
+    while (true) {
+      entry_ptr e;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _work_available.wait(lock, [&]() {
+          if (_stop) { return true; }
+          e = next_prefetch();
+          return e != nullptr;
+        });
+        if (_stop) { return; }
+        e->state = entry_state::IN_FLIGHT;
+        _window_bytes += e->size;
+      }
+
+      try {
+        e->data.resize(e->size);
+        auto const bytes_read = _source->host_read(e->offset, e->size, e->data.data());
+        CUDF_EXPECTS(bytes_read == e->size, "Prefetch read fewer bytes than requested");
+      } catch (...) {
+        e->error = std::current_exception();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        e->state = entry_state::READY;
+        if (!e->error) { _stats.prefetched_bytes += e->size; }
+      }
+      _entry_ready.notify_all();
+    }
+  }
+
+  std::unique_ptr<datasource> const _source;
+  size_t const _read_ahead_size;
+
+  mutable std::mutex _mutex;
+  std::condition_variable _work_available;
+  std::condition_variable _entry_ready;
+  std::list<entry_ptr> _plan;
+  size_t _window_bytes = 0;  // Bytes in flight or prefetched and not dropped yet
+  prefetch_statistics _stats;
+  bool _stop = false;
+
+  std::vector<std::thread> _workers;
+};
+
+prefetching_datasource::prefetching_datasource(std::unique_ptr<datasource> source,
+                                               size_t read_ahead_size,
+                                               size_t num_threads)
+  : _impl(std::make_unique<impl>(std::move(source), read_ahead_size, num_threads))
+{
+}
+
+prefetching_datasource::~prefetching_datasource() = default;
+
+void prefetching_datasource::hint_reads(host_span<byte_range const> ranges)
+{
+  _impl->hint_reads(ranges);
+}
+
+std::unique_ptr<datasource::buffer> prefetching_datasource::host_read(size_t offset, size_t size)
+{
+  return _impl->host_read(offset, size);
+}
+
+size_t prefetching_datasource::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  return _impl->host_read(offset, size, dst);
+}
+
+std::vector<size_t> prefetching_datasource::host_read_ranges(host_span<read_range const> ranges,
+                                                             size_t max_gap)
+{
+  return _impl->host_read_ranges(ranges, max_gap);
+}
+
+bool prefetching_datasource::supports_device_read() const
+{
+  return _impl->source()->supports_device_read();
+}
+
+bool prefetching_datasource::is_device_read_preferred(size_t size) const
+{
+  return _impl->source()->is_device_read_preferred(size);
+}
+
+std::unique_ptr<datasource::buffer> prefetching_datasource::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  return _impl->source()->device_read(offset, size, stream);
+}
+
+size_t prefetching_datasource::device_read(size_t offset,
+                                           size_t size,
+                                           uint8_t* dst,
+                                           rmm::cuda_stream_view stream)
+{
+  return _impl->source()->device_read(offset, size, dst, stream);
+}
+
+size_t prefetching_datasource::size() const { return _impl->source()->size(); }
+
+prefetch_statistics prefetching_datasource::statistics() const { return _impl->statistics(); }
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "statistics_filter.hpp"
+
+#include <cudf/ast/linearizer.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+
+enum class value_category { NONE, INTEGER, FLOAT, TIMESTAMP, DURATION };
+
+value_category get_category(data_type type)
+{
+  if (is_boolean(type)) { return value_category::INTEGER; }
+  if (is_floating_point(type)) { return value_category::FLOAT; }
+  if (is_numeric(type)) { return value_category::INTEGER; }
+  if (is_timestamp(type)) { return value_category::TIMESTAMP; }
+  if (is_duration(type)) { return value_category::DURATION; }
+  return value_category::NONE;
+}
+
+/**
+ * @brief Returns the length of a tick of a timestamp or duration type, in nanoseconds.
+ */
+int64_t tick_length(data_type type)
+{
+  switch (type.id()) {
+    case type_id::TIMESTAMP_DAYS: return 86'400'000'000'000;
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::DURATION_SECONDS: return 1'000'000'000;
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::DURATION_MILLISECONDS: return 1'000'000;
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::DURATION_MICROSECONDS: return 1'000;
+    case type_id::DURATION_DAYS: return 86'400'000'000'000;
+    default: return 1;
+  }
+}
+
+int64_t floor_div(int64_t a, int64_t b) { return a / b - (a % b != 0 && a < 0); }
+
+int64_t ceil_div(int64_t a, int64_t b) { return a / b + (a % b != 0 && a > 0); }
+
+// Integers beyond 2^53 may be rounded when converted to double; widen the range to stay inclusive
+constexpr int64_t max_exact_double_int = int64_t{1} << 53;
+
+bool is_exact_double(int64_t v) { return v >= -max_exact_double_int && v <= max_exact_double_int; }
+
+double to_double_down(int64_t v)
+{
+  auto const d = static_cast<double>(v);
+  return is_exact_double(v) ? d : std::nextafter(d, -HUGE_VAL);
+}
+
+double to_double_up(int64_t v)
+{
+  auto const d = static_cast<double>(v);
+  return is_exact_double(v) ? d : std::nextafter(d, HUGE_VAL);
+}
+
+ast::ast_operator flip_comparison(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+    case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+    case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+    case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+bool is_comparison(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::EQUAL:
+    case ast::ast_operator::NOT_EQUAL:
+    case ast::ast_operator::LESS:
+    case ast::ast_operator::GREATER:
+    case ast::ast_operator::LESS_EQUAL:
+    case ast::ast_operator::GREATER_EQUAL: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Copies the value of a literal's scalar to the host.
+ */
+struct literal_to_host {
+  template <typename T>
+  static constexpr bool is_integer()
+  {
+    return cudf::is_numeric<T>() && not cudf::is_floating_point<T>();
+  }
+
+  template <typename T, typename Value, std::enable_if_t<is_integer<T>()>* = nullptr>
+  void operator()(scalar const& s, Value& result, rmm::cuda_stream_view stream)
+  {
+    auto const value = static_cast<numeric_scalar<T> const&>(s).value(stream);
+    if (std::is_unsigned<T>::value &&
+        static_cast<uint64_t>(value) > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+      return;
+    }
+    result.type      = s.type();
+    result.int_value = static_cast<int64_t>(value);
+  }
+
+  template <typename T, typename Value, std::enable_if_t<cudf::is_floating_point<T>()>* = nullptr>
+  void operator()(scalar const& s, Value& result, rmm::cuda_stream_view stream)
+  {
+    auto const value = static_cast<numeric_scalar<T> const&>(s).value(stream);
+    if (std::isnan(value)) { return; }
+    result.type        = s.type();
+    result.float_value = static_cast<double>(value);
+  }
+
+  template <typename T, typename Value, std::enable_if_t<cudf::is_timestamp<T>()>* = nullptr>
+  void operator()(scalar const& s, Value& result, rmm::cuda_stream_view stream)
+  {
+    result.type = s.type();
+    result.int_value =
+      static_cast<timestamp_scalar<T> const&>(s).value(stream).time_since_epoch().count();
+  }
+
+  template <typename T, typename Value, std::enable_if_t<cudf::is_duration<T>()>* = nullptr>
+  void operator()(scalar const& s, Value& result, rmm::cuda_stream_view stream)
+  {
+    result.type      = s.type();
+    result.int_value = static_cast<duration_scalar<T> const&>(s).value(stream).count();
+  }
+
+  template <typename T,
+            typename Value,
+            std::enable_if_t<not cudf::is_numeric<T>() and not cudf::is_chrono<T>()>* = nullptr>
+  void operator()(scalar const&, Value&, rmm::cuda_stream_view)
+  {
+    // Not comparable with statistics; the type stays EMPTY
+  }
+};
+
+}  // namespace
+
+statistics_filter::statistics_filter(ast::expression const& filter, rmm::cuda_stream_view stream)
+{
+  root = add_node(filter, stream);
+  std::sort(referenced_columns.begin(), referenced_columns.end());
+  referenced_columns.erase(std::unique(referenced_columns.begin(), referenced_columns.end()),
+                           referenced_columns.end());
+}
+
+size_t statistics_filter::add_node(ast::detail::node const& node, rmm::cuda_stream_view stream)
+{
+  filter_node result{};
+  if (auto const column = dynamic_cast<ast::column_reference const*>(&node)) {
+    CUDF_EXPECTS(column->get_table_source() == ast::table_reference::LEFT,
+                 "Filter can only reference the columns of the file");
+    result.kind         = node_kind::COLUMN;
+    result.column_index = column->get_column_index();
+    referenced_columns.push_back(result.column_index);
+  } else if (auto const literal = dynamic_cast<ast::literal const*>(&node)) {
+    auto const& s  = literal->get_scalar();
+    result.kind    = node_kind::LITERAL;
+    result.literal.is_valid = s.is_valid(stream);
+    if (result.literal.is_valid) {
+      type_dispatcher(s.type(), literal_to_host{}, s, result.literal, stream);
+    }
+  } else {
+    auto const expression = dynamic_cast<ast::expression const*>(&node);
+    CUDF_EXPECTS(expression != nullptr, "Unsupported filter expression node");
+    result.kind = node_kind::EXPRESSION;
+    result.op   = expression->get_operator();
+    for (auto const& operand : expression->get_operands()) {
+      result.operands.push_back(add_node(operand.get(), stream));
+    }
+  }
+  nodes.push_back(std::move(result));
+  return nodes.size() - 1;
+}
+
+bool statistics_filter::may_match(std::vector<column_value_range> const& ranges) const
+{
+  return evaluate(root, ranges).can_be_true;
+}
+
+statistics_filter::possible_results statistics_filter::evaluate(
+  size_t node_idx, std::vector<column_value_range> const& ranges) const
+{
+  possible_results const unknown{true, true, true};
+  auto const& node = nodes[node_idx];
+  if (node.kind != node_kind::EXPRESSION) { return unknown; }
+
+  auto const& operands = node.operands;
+  switch (node.op) {
+    case ast::ast_operator::IDENTITY: return evaluate(operands[0], ranges);
+    case ast::ast_operator::NOT: {
+      auto const r = evaluate(operands[0], ranges);
+      return {r.can_be_false, r.can_be_true, r.can_be_null};
+    }
+    // Three-valued logic: false AND null is false, true OR null is true
+    case ast::ast_operator::LOGICAL_AND: {
+      auto const a = evaluate(operands[0], ranges);
+      auto const b = evaluate(operands[1], ranges);
+      return {a.can_be_true && b.can_be_true,
+              a.can_be_false || b.can_be_false,
+              (a.can_be_null && (b.can_be_true || b.can_be_null)) ||
+                (b.can_be_null && a.can_be_true)};
+    }
+    case ast::ast_operator::LOGICAL_OR: {
+      auto const a = evaluate(operands[0], ranges);
+      auto const b = evaluate(operands[1], ranges);
+      return {a.can_be_true || b.can_be_true,
+              a.can_be_false && b.can_be_false,
+              (a.can_be_null && (b.can_be_false || b.can_be_null)) ||
+                (b.can_be_null && a.can_be_false)};
+    }
+    default: break;
+  }
+  if (not is_comparison(node.op)) { return unknown; }
+
+  auto const& lhs = nodes[operands[0]];
+  auto const& rhs = nodes[operands[1]];
+  if (lhs.kind == node_kind::COLUMN && rhs.kind == node_kind::LITERAL) {
+    if (static_cast<size_t>(lhs.column_index) >= ranges.size()) { return unknown; }
+    return compare(ranges[lhs.column_index], node.op, rhs.literal);
+  }
+  if (lhs.kind == node_kind::LITERAL && rhs.kind == node_kind::COLUMN) {
+    if (static_cast<size_t>(rhs.column_index) >= ranges.size()) { return unknown; }
+    return compare(ranges[rhs.column_index], flip_comparison(node.op), lhs.literal);
+  }
+  return unknown;
+}
+
+namespace {
+
+/**
+ * @brief Which results `value op literal` may produce for the values in [min, max].
+ */
+template <typename T>
+std::pair<bool, bool> compare_range(T min, T max, ast::ast_operator op, T literal)
+{
+  auto const contains = min <= literal && literal <= max;
+  auto const is_all   = min == literal && max == literal;
+  switch (op) {
+    case ast::ast_operator::EQUAL: return {contains, not is_all};
+    case ast::ast_operator::NOT_EQUAL: return {not is_all, contains};
+    case ast::ast_operator::LESS: return {min < literal, max >= literal};
+    case ast::ast_operator::LESS_EQUAL: return {min <= literal, max > literal};
+    case ast::ast_operator::GREATER: return {max > literal, min <= literal};
+    case ast::ast_operator::GREATER_EQUAL: return {max >= literal, min < literal};
+    default: return {true, true};
+  }
+}
+
+}  // namespace
+
+statistics_filter::possible_results statistics_filter::compare(column_value_range const& range,
+                                                               ast::ast_operator op,
+                                                               literal_value const& literal)
+{
+  possible_results const unknown{true, true, true};
+  // Comparisons with nulls are null, and so are comparisons of null rows
+  if (not literal.is_valid) { return {false, false, true}; }
+  if (range.null_count >= 0 && range.null_count == range.num_rows) { return {false, false, true}; }
+  auto const has_nulls = range.null_count != 0;
+
+  auto const range_category   = get_category(range.type);
+  auto const literal_category = get_category(literal.type);
+  if (range_category == value_category::NONE || literal_category == value_category::NONE) {
+    return unknown;
+  }
+
+  std::pair<bool, bool> result;
+  if (range_category == value_category::INTEGER && literal_category == value_category::INTEGER) {
+    result = compare_range(range.int_min, range.int_max, op, literal.int_value);
+  } else if (range_category == value_category::INTEGER &&
+             literal_category == value_category::FLOAT) {
+    result = compare_range(
+      to_double_down(range.int_min), to_double_up(range.int_max), op, literal.float_value);
+  } else if (range_category == value_category::FLOAT) {
+    if (literal_category == value_category::FLOAT) {
+      result = compare_range(range.float_min, range.float_max, op, literal.float_value);
+    } else if (literal_category == value_category::INTEGER &&
+               is_exact_double(literal.int_value)) {
+      result = compare_range(
+        range.float_min, range.float_max, op, static_cast<double>(literal.int_value));
+    } else {
+      return unknown;
+    }
+    // NaN values are not included in the statistics; they compare false, except for NOT_EQUAL
+    result.second = true;
+    if (op == ast::ast_operator::NOT_EQUAL) { result.first = true; }
+  } else if (range_category == literal_category) {
+    // Timestamps or durations: convert the range to the literal's resolution, rounding outwards
+    auto const range_tick   = tick_length(range.type);
+    auto const literal_tick = tick_length(literal.type);
+    auto min                = range.int_min;
+    auto max                = range.int_max;
+    if (range_tick >= literal_tick) {
+      auto const factor = range_tick / literal_tick;
+      auto const limit  = std::numeric_limits<int64_t>::max() / factor;
+      if (min < -limit || min > limit || max < -limit || max > limit) { return unknown; }
+      min *= factor;
+      max *= factor;
+    } else {
+      auto const factor = literal_tick / range_tick;
+      min               = floor_div(min, factor);
+      max               = ceil_div(max, factor);
+    }
+    result = compare_range(min, max, op, literal.int_value);
+  } else {
+    return unknown;
+  }
+  return {result.first, result.second, has_nulls};
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
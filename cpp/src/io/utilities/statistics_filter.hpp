@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/operators.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <vector>
+
+namespace cudf {
+namespace ast {
+class expression;
+namespace detail {
+class node;
+}  // namespace detail
+}  // namespace ast
+
+namespace io {
+namespace detail {
+
+/**
+ * @brief Range of the values of a column within a row group or stripe, from its statistics.
+ *
+ * Integral and boolean values are stored in `int_min` and `int_max`, and so are timestamps and
+ * durations, as numbers of ticks of `type`. Floating point values are stored in `float_min` and
+ * `float_max`. The type is EMPTY when the statistics do not include a usable minimum and maximum.
+ */
+struct column_value_range {
+  data_type type{type_id::EMPTY};
+  int64_t int_min    = 0;
+  int64_t int_max    = 0;
+  double float_min   = 0;
+  double float_max   = 0;
+  int64_t num_rows   = 0;
+  int64_t null_count = -1;  // Negative if unknown
+};
+
+/**
+ * @brief Filter expression evaluated on the host against the statistics of row groups or stripes.
+ *
+ * Supports comparisons between a column and a literal, combined with `LOGICAL_AND`, `LOGICAL_OR`
+ * and `NOT`. Any other part of the expression is assumed to possibly match any row, so a row group
+ * or stripe is only pruned when its statistics prove that none of its rows pass the filter.
+ *
+ * The column references are indices of the top-level columns in the file.
+ */
+class statistics_filter {
+ public:
+  /**
+   * @brief Converts the filter expression and copies its literal values to the host.
+   *
+   * @param filter Boolean filter expression
+   * @param stream CUDA stream used to copy the literal values
+   */
+  statistics_filter(ast::expression const& filter, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the indices of the columns referenced by the filter.
+   */
+  std::vector<size_type> const& get_referenced_columns() const { return referenced_columns; }
+
+  /**
+   * @brief Returns whether any row of a row group or stripe may pass the filter.
+   *
+   * @param ranges Value ranges of the columns in the row group or stripe, indexed by column index;
+   * only the ranges of the referenced columns are used
+   */
+  bool may_match(std::vector<column_value_range> const& ranges) const;
+
+ private:
+  struct literal_value {
+    data_type type{type_id::EMPTY};  // EMPTY if the type is not supported
+    bool is_valid      = true;
+    int64_t int_value  = 0;
+    double float_value = 0;
+  };
+
+  enum class node_kind { COLUMN, LITERAL, EXPRESSION };
+
+  struct filter_node {
+    node_kind kind;
+    ast::ast_operator op = ast::ast_operator::IDENTITY;
+    std::vector<size_t> operands;  // Indices of the operand nodes
+    size_type column_index = 0;
+    literal_value literal;
+  };
+
+  /**
+   * @brief Which results an expression may produce for the rows of a row group or stripe.
+   */
+  struct possible_results {
+    bool can_be_true;
+    bool can_be_false;
+    bool can_be_null;
+  };
+
+  size_t add_node(ast::detail::node const& node, rmm::cuda_stream_view stream);
+
+  possible_results evaluate(size_t node_idx, std::vector<column_value_range> const& ranges) const;
+
+  static possible_results compare(column_value_range const& range,
+                                  ast::ast_operator op,
+                                  literal_value const& literal);
+
+  std::vector<filter_node> nodes;
+  size_t root = 0;
+  std::vector<size_type> referenced_columns;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
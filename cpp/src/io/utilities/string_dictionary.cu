@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "string_dictionary.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+using str_pair = thrust::pair<char const*, size_type>;
+
+std::unique_ptr<column> encode_strings(device_span<str_pair const> strings,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows  = static_cast<size_type>(strings.size());
+  auto const d_strings = strings.data();
+  auto const to_string = [d_strings] __device__(size_type row) {
+    return string_view(d_strings[row].first, d_strings[row].second);
+  };
+  auto const is_valid = [d_strings] __device__(size_type row) {
+    return d_strings[row].first != nullptr;
+  };
+
+  // Rows of the non-null strings, sorted by value
+  rmm::device_uvector<size_type> sorted_rows(num_rows, stream);
+  auto const sorted_end = thrust::copy_if(rmm::exec_policy(stream),
+                                          thrust::make_counting_iterator<size_type>(0),
+                                          thrust::make_counting_iterator<size_type>(num_rows),
+                                          sorted_rows.begin(),
+                                          is_valid);
+  auto const num_valid = static_cast<size_type>(sorted_end - sorted_rows.begin());
+  thrust::sort(rmm::exec_policy(stream),
+               sorted_rows.begin(),
+               sorted_end,
+               [to_string] __device__(size_type lhs, size_type rhs) {
+                 return to_string(lhs) < to_string(rhs);
+               });
+
+  // Key of each sorted string: the number of distinct strings before it
+  rmm::device_uvector<uint32_t> sorted_keys(num_valid, stream);
+  auto const d_sorted_rows = sorted_rows.data();
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_valid),
+                    sorted_keys.begin(),
+                    [to_string, d_sorted_rows] __device__(size_type idx) -> uint32_t {
+                      return idx > 0 && to_string(d_sorted_rows[idx]) !=
+                                          to_string(d_sorted_rows[idx - 1]);
+                    });
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), sorted_keys.begin(), sorted_keys.end(), sorted_keys.begin());
+  auto const num_keys =
+    (num_valid > 0) ? static_cast<size_type>(sorted_keys.back_element(stream)) + 1 : 0;
+
+  // The keys are the first string of each run of equal strings
+  rmm::device_uvector<str_pair> key_strings(num_keys, stream);
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(num_valid),
+                   [d_strings,
+                    d_sorted_rows,
+                    d_sorted_keys = sorted_keys.data(),
+                    d_key_strings = key_strings.data()] __device__(size_type idx) {
+                     if (idx == 0 || d_sorted_keys[idx] != d_sorted_keys[idx - 1]) {
+                       d_key_strings[d_sorted_keys[idx]] = d_strings[d_sorted_rows[idx]];
+                     }
+                   });
+  auto keys_column = make_strings_column(key_strings, stream, mr);
+
+  // Null rows keep the first key as their index
+  auto indices_column = make_numeric_column(
+    data_type{type_id::UINT32}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const indices = indices_column->mutable_view().begin<uint32_t>();
+  thrust::fill(rmm::exec_policy(stream), indices, indices + num_rows, 0);
+  thrust::scatter(
+    rmm::exec_policy(stream), sorted_keys.begin(), sorted_keys.end(), sorted_rows.begin(), indices);
+
+  rmm::device_buffer null_mask{0, stream, mr};
+  if (num_valid < num_rows) {
+    null_mask = cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                                       thrust::make_counting_iterator<size_type>(num_rows),
+                                       is_valid,
+                                       stream,
+                                       mr)
+                  .first;
+  }
+  return make_dictionary_column(
+    std::move(keys_column), std::move(indices_column), std::move(null_mask), num_rows - num_valid);
+}
+
+std::unique_ptr<column> replace_dictionary_keys(column_view const& dictionary,
+                                                column_view const& transformed_keys,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  dictionary_column_view const dict(dictionary);
+  CUDF_EXPECTS(transformed_keys.size() == dict.keys_size(), "Each key must be transformed");
+  if (dict.keys_size() == 0) { return std::make_unique<column>(dictionary, stream, mr); }
+
+  // Index of each transformed key in the sorted distinct transformed keys
+  auto encoded = cudf::dictionary::detail::encode(
+    transformed_keys, data_type{type_id::UINT32}, stream, rmm::mr::get_current_device_resource());
+  dictionary_column_view const encoded_view(encoded->view());
+  auto const key_map = encoded_view.indices().begin<uint32_t>();
+
+  auto indices_column = make_numeric_column(
+    data_type{type_id::UINT32}, dict.size(), mask_state::UNALLOCATED, stream, mr);
+  auto const old_indices = dict.indices().begin<uint32_t>();
+  thrust::gather(rmm::exec_policy(stream),
+                 old_indices,
+                 old_indices + dict.size(),
+                 key_map,
+                 indices_column->mutable_view().begin<uint32_t>());
+
+  auto keys_column = std::make_unique<column>(encoded_view.keys(), stream, mr);
+  return make_dictionary_column(std::move(keys_column),
+                                std::move(indices_column),
+                                cudf::detail::copy_bitmask(dictionary, stream, mr),
+                                dictionary.null_count());
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
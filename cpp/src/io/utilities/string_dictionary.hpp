@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <thrust/pair.h>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Creates a `DICTIONARY32` column from the decoded strings of a column buffer.
+ *
+ * The keys are built from the distinct strings without creating a strings column of all rows, so
+ * the device memory of the output scales with the number of distinct strings. Null strings have a
+ * null `first` pointer.
+ *
+ * @param strings Pointer and length of the string of each row
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return Dictionary column with sorted `STRING` keys and `UINT32` indices
+ */
+std::unique_ptr<column> encode_strings(
+  device_span<thrust::pair<char const*, size_type> const> strings,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Replaces the keys of a dictionary column with transformed keys.
+ *
+ * The transformed keys may be unsorted and may have duplicates; they are sorted and merged, and
+ * the indices are remapped accordingly.
+ *
+ * @param dictionary Dictionary column
+ * @param transformed_keys New value of each key of `dictionary`, in the same order
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return Dictionary column with the same rows and nulls as `dictionary`
+ */
+std::unique_ptr<column> replace_dictionary_keys(column_view const& dictionary,
+                                                column_view const& transformed_keys,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/utilities/file_io_utilities.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+// Pool that owns the calling thread, if any
+thread_local thread_pool const *current_pool = nullptr;
+}  // namespace
+
+thread_pool::thread_pool(size_t num_threads)
+{
+  num_threads = std::max<size_t>(num_threads, 1);
+  _workers.reserve(num_threads);
+  for (size_t i = 0; i < num_threads; ++i) {
+    _workers.emplace_back([this]() { worker_loop(); });
+  }
+}
+
+thread_pool::~thread_pool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _task_available.notify_all();
+  for (auto &worker : _workers) {
+    worker.join();
+  }
+}
+
+bool thread_pool::is_worker_thread() const { return current_pool == this; }
+
+void thread_pool::worker_loop()
+{
+  current_pool = this;
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _task_available.wait(lock, [this]() { return _stop || !_tasks.empty(); });
+      // Drain the queue before exiting so that no future is left without a result
+      if (_stop && _tasks.empty()) { return; }
+      task = std::move(_tasks.front());
+      _tasks.pop();
+    }
+    task();
+  }
+}
+
+thread_pool &io_thread_pool()
+{
+  static thread_pool _instance([]() -> size_t {
+    auto const env_count = getenv_or("LIBCUDF_IO_THREAD_COUNT", "");
+    if (!env_count.empty()) { return std::stoul(env_count); }
+    return std::min(std::thread::hardware_concurrency(), 16u);
+  }());
+  return _instance;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
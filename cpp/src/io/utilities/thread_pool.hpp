@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief Fixed-size pool of worker threads used to run host-side IO tasks.
+ *
+ * Tasks are executed in submission order by the first available worker. Tasks running in the pool
+ * must not block on the results of other tasks submitted to the same pool, since this can exhaust
+ * the workers and deadlock; use `parallel_transform`, which runs nested work inline.
+ */
+class thread_pool {
+ public:
+  /**
+   * @brief Creates a pool with the given number of worker threads.
+   *
+   * @param num_threads Number of worker threads; at least one thread is always created
+   */
+  explicit thread_pool(size_t num_threads);
+
+  thread_pool(thread_pool const &) = delete;
+  thread_pool &operator=(thread_pool const &) = delete;
+
+  /**
+   * @brief Waits for all queued tasks to complete and joins the worker threads.
+   */
+  ~thread_pool();
+
+  /**
+   * @brief Returns the number of worker threads in the pool.
+   */
+  size_t size() const { return _workers.size(); }
+
+  /**
+   * @brief Returns whether the calling thread is one of the worker threads of the pool.
+   */
+  bool is_worker_thread() const;
+
+  /**
+   * @brief Queues a callable for execution on one of the worker threads.
+   *
+   * @param func Callable object with no parameters
+   *
+   * @return Future that holds the result of the callable, or the exception it threw
+   */
+  template <typename F>
+  auto submit(F &&func) -> std::future<std::result_of_t<F()>>
+  {
+    using result_type = std::result_of_t<F()>;
+    auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(func));
+    auto result = task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _tasks.emplace([task]() { (*task)(); });
+    }
+    _task_available.notify_one();
+    return result;
+  }
+
+ private:
+  void worker_loop();
+
+  std::vector<std::thread> _workers;
+  std::queue<std::function<void()>> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _task_available;
+  bool _stop = false;
+};
+
+/**
+ * @brief Returns the process-wide thread pool used for host-side IO.
+ *
+ * The number of threads can be set with the `LIBCUDF_IO_THREAD_COUNT` environment variable; it
+ * defaults to the number of hardware threads, capped at 16.
+ */
+thread_pool &io_thread_pool();
+
+/**
+ * @brief Calls `func(i)` for each index in `[0, count)` on the I/O thread pool.
+ *
+ * Waits for all calls to complete before rethrowing the first exception, so `func` can reference
+ * local state of the caller. When called from a task running in the I/O thread pool, the calls
+ * are made in order on the calling thread, so that nested parallel work never waits for a worker.
+ *
+ * @param count Number of calls
+ * @param func Callable that takes the index of the call
+ *
+ * @return Results of the calls, in index order
+ */
+template <typename F>
+auto parallel_transform(size_t count, F const &func) -> std::vector<std::result_of_t<F(size_t)>>
+{
+  std::vector<std::result_of_t<F(size_t)>> results;
+  results.reserve(count);
+  if (count == 1 || io_thread_pool().is_worker_thread()) {
+    for (size_t i = 0; i < count; ++i) {
+      results.push_back(func(i));
+    }
+    return results;
+  }
+
+  std::vector<std::future<std::result_of_t<F(size_t)>>> tasks;
+  tasks.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    tasks.push_back(io_thread_pool().submit([&func, i]() { return func(i); }));
+  }
+  for (auto &task : tasks) {
+    task.wait();
+  }
+  for (auto &task : tasks) {
+    results.push_back(task.get());
+  }
+  return results;
+}
+
+/**
+ * @brief Calls `func(i)` for each index in `[0, count)` on the I/O thread pool.
+ *
+ * Same as `parallel_transform`, for callables that return no result.
+ *
+ * @param count Number of calls
+ * @param func Callable that takes the index of the call
+ */
+template <typename F>
+void parallel_for(size_t count, F const &func)
+{
+  parallel_transform(count, [&func](size_t i) {
+    func(i);
+    return true;
+  });
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
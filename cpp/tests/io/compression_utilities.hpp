@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <arrow/util/compression.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+/**
+ * @brief Returns uniform random integers
+ *
+ * Random digits compress poorly, so text made of these values stays large once compressed.
+ */
+inline std::vector<int64_t> random_integers(size_t size)
+{
+  static constexpr auto seed = 0xc0ffee;
+  std::mt19937_64 engine{seed};
+  std::uniform_int_distribution<int64_t> dist{0, int64_t{1} << 40};
+  std::vector<int64_t> values(size);
+  std::generate(values.begin(), values.end(), [&]() { return dist(engine); });
+  return values;
+}
+
+/**
+ * @brief Compresses data into consecutive gzip members
+ *
+ * @param data Data to compress
+ * @param member_size Size of the uncompressed data of each member
+ * @param bgzf Whether each member records its size in a BGZF extra field; requires members that
+ * compress to less than 64KB
+ * @param level Compression level; level 0 stores the data verbatim
+ */
+inline std::string gzip_members(std::string const& data,
+                                size_t member_size,
+                                bool bgzf,
+                                int level = Z_DEFAULT_COMPRESSION)
+{
+  std::string out;
+  auto const put_le = [&out](size_t value, int num_bytes) {
+    for (int i = 0; i < num_bytes; ++i) {
+      out.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+  };
+  for (size_t pos = 0; pos < data.size(); pos += member_size) {
+    auto const len = std::min(member_size, data.size() - pos);
+    auto const in  = reinterpret_cast<Bytef const*>(data.data() + pos);
+
+    z_stream strm{};
+    CUDF_EXPECTS(deflateInit2(&strm, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK,
+                 "Cannot initialize deflate");
+    std::string deflated(deflateBound(&strm, len), '\0');
+    strm.next_in   = const_cast<Bytef*>(in);
+    strm.avail_in  = len;
+    strm.next_out  = reinterpret_cast<Bytef*>(&deflated[0]);
+    strm.avail_out = deflated.size();
+    auto const zerr = deflate(&strm, Z_FINISH);
+    deflated.resize(strm.total_out);
+    deflateEnd(&strm);
+    CUDF_EXPECTS(zerr == Z_STREAM_END, "Cannot deflate the test data");
+
+    out.append("\x1f\x8b\x08");
+    out.push_back(bgzf ? 4 : 0);  // FEXTRA
+    put_le(0, 4);                 // MTIME
+    out.push_back(0);             // XFL
+    out.push_back('\xff');        // OS
+    if (bgzf) {
+      auto const member_len = 18 + deflated.size() + 8;
+      CUDF_EXPECTS(member_len <= (1 << 16), "BGZF blocks must be smaller than 64KB");
+      put_le(6, 2);
+      out.append("BC");
+      put_le(2, 2);
+      put_le(member_len - 1, 2);
+    }
+    out.append(deflated);
+    put_le(crc32(0, in, len), 4);
+    put_le(len, 4);
+  }
+  return out;
+}
+
+/**
+ * @brief Compresses data into a bzip2 stream of 900KB blocks
+ *
+ * @return Compressed data, or an empty string if Arrow is built without bzip2
+ */
+inline std::string bzip2_compress(std::string const& data)
+{
+  if (!arrow::util::Codec::IsAvailable(arrow::Compression::BZ2)) { return {}; }
+  auto const codec      = arrow::util::Codec::Create(arrow::Compression::BZ2).ValueOrDie();
+  auto const compressor = codec->MakeCompressor().ValueOrDie();
+
+  // bzip2 expands incompressible data by at most 1% plus 600 bytes
+  std::string out(data.size() + data.size() / 100 + 4096, '\0');
+  auto in         = reinterpret_cast<uint8_t const*>(data.data());
+  int64_t in_len  = data.size();
+  int64_t out_pos = 0;
+
+  auto const out_ptr = [&]() { return reinterpret_cast<uint8_t*>(&out[out_pos]); };
+  while (in_len > 0) {
+    auto const result =
+      compressor->Compress(in_len, in, out.size() - out_pos, out_ptr()).ValueOrDie();
+    in += result.bytes_read;
+    in_len -= result.bytes_read;
+    out_pos += result.bytes_written;
+  }
+  for (bool done = false; !done;) {
+    auto const result = compressor->End(out.size() - out_pos, out_ptr()).ValueOrDie();
+    out_pos += result.bytes_written;
+    done = !result.should_retry;
+  }
+  out.resize(out_pos);
+  return out;
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -21,7 +21,12 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <tests/io/compression_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
@@ -32,6 +37,8 @@
 
 #include <arrow/io/api.h>
 
+#include <zlib.h>
+
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -284,6 +291,51 @@ std::vector<std::string> prepend_zeros(const std::vector<T>& input,
   return output;
 }
 
+// CSV text of rows [begin, end) of an "id,name,value" table; every seventh name is quoted and
+// contains a line terminator
+std::string multiline_rows_csv(int begin, int end, bool header)
+{
+  std::ostringstream text;
+  if (header) { text << "id,name,value\n"; }
+  for (int i = begin; i < end; ++i) {
+    text << i << ",";
+    if (i % 7 == 0) {
+      text << "\"multi\nline " << i << "\"";
+    } else {
+      text << "name" << i;
+    }
+    text << "," << i * 0.5 << "\n";
+  }
+  return text.str();
+}
+
+// CSV text of two columns of random integers; compressed copies of it are large enough to be
+// decompressed in parallel
+std::string random_integer_csv(size_t num_rows)
+{
+  auto const values = cudf::test::random_integers(num_rows * 2);
+  std::string text  = "a,b\n";
+  for (size_t i = 0; i < values.size(); i += 2) {
+    text += std::to_string(values[i]) + "," + std::to_string(values[i + 1]) + "\n";
+  }
+  return text;
+}
+
+// Writes `data` to a temporary file and reads it as CSV
+cudf_io::table_with_metadata read_csv_data(std::string const& data,
+                                           std::string const& filename,
+                                           cudf_io::compression_type compression)
+{
+  auto const filepath = temp_env->get_temp_filepath(filename);
+  {
+    std::ofstream outfile(filepath, std::ofstream::binary);
+    outfile << data;
+  }
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath}).compression(compression);
+  return cudf_io::read_csv(in_opts);
+}
+
 }  // namespace
 
 TYPED_TEST(CsvReaderNumericTypeTest, SingleColumn)
@@ -1890,4 +1942,304 @@ TEST_F(CsvReaderTest, DefaultWriteChunkSize)
   }
 }
 
+TEST_F(CsvReaderTest, DecompressionWindows)
+{
+  auto filepath = temp_env->get_temp_filepath("DecompressionWindows.csv.gz");
+  std::string all_text;
+  {
+    // Two gzip members
+    for (int member = 0; member < 2; ++member) {
+      auto const str = multiline_rows_csv(member * 500, (member + 1) * 500, member == 0);
+      all_text += str;
+      auto file = gzopen(filepath.c_str(), member == 0 ? "wb" : "ab");
+      ASSERT_NE(file, nullptr);
+      ASSERT_EQ(gzwrite(file, str.data(), str.size()), static_cast<int>(str.size()));
+      ASSERT_EQ(gzclose(file), Z_OK);
+    }
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+      .compression(cudf_io::compression_type::GZIP);
+  auto const expected = cudf_io::read_csv(in_opts);
+  ASSERT_EQ(expected.tbl->num_rows(), 1000);
+
+  for (size_t window_size : {256, 1000, 1 << 20}) {
+    in_opts.set_decompression_window_size(window_size);
+    auto const result = cudf_io::read_csv(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+    EXPECT_EQ(expected.metadata.column_names, result.metadata.column_names);
+  }
+
+  // bzip2 input is read in windows as well
+  auto const bz2_data = cudf::test::bzip2_compress(all_text);
+  if (!bz2_data.empty()) {
+    auto const bz2_filepath = temp_env->get_temp_filepath("DecompressionWindows.csv.bz2");
+    {
+      std::ofstream outfile(bz2_filepath, std::ofstream::binary);
+      outfile << bz2_data;
+    }
+    cudf_io::csv_reader_options bz2_opts =
+      cudf_io::csv_reader_options::builder(cudf_io::source_info{bz2_filepath})
+        .compression(cudf_io::compression_type::BZIP2)
+        .decompression_window_size(1000);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), cudf_io::read_csv(bz2_opts).tbl->view());
+  }
+
+  // Row limit reached before the end of the data
+  in_opts.set_nrows(300);
+  in_opts.set_decompression_window_size(0);
+  auto const expected_nrows = cudf_io::read_csv(in_opts);
+  in_opts.set_decompression_window_size(1000);
+  auto const result_nrows = cudf_io::read_csv(in_opts);
+  ASSERT_EQ(result_nrows.tbl->num_rows(), 300);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_nrows.tbl->view(), result_nrows.tbl->view());
+}
+
+TEST_F(CsvReaderTest, StagingChunks)
+{
+  auto filepath = temp_env->get_temp_filepath("StagingChunks.csv");
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << multiline_rows_csv(0, 1000, true);
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath});
+  auto const expected = cudf_io::read_csv(in_opts);
+  ASSERT_EQ(expected.tbl->num_rows(), 1000);
+
+  for (size_t chunk_size : {256, 1000, 4096}) {
+    in_opts.set_staging_chunk_size(chunk_size);
+    auto const result = cudf_io::read_csv(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+  }
+
+  EXPECT_THROW(in_opts.set_staging_chunk_size(0), cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, TypeInferenceSample)
+{
+  auto filepath = temp_env->get_temp_filepath("TypeInferenceSample.csv");
+  {
+    // The first rows are all integers; later rows have floats, strings and nulls
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "int,float,string,null,bool\n";
+    for (int i = 0; i < 1000; ++i) {
+      outfile << i << ",";
+      if (i == 500) {
+        outfile << i + 0.5;
+      } else {
+        outfile << i;
+      }
+      outfile << ",";
+      if (i == 900) {
+        outfile << "abc";
+      } else {
+        outfile << i;
+      }
+      outfile << "," << ((i == 700) ? "" : "1") << "," << (i % 2 ? "true" : "false") << "\n";
+    }
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath});
+  auto const expected = cudf_io::read_csv(in_opts);
+  auto const view     = expected.tbl->view();
+  EXPECT_EQ(view.column(0).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(view.column(1).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(view.column(2).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(view.column(3).type().id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(view.column(4).type().id(), cudf::type_id::BOOL8);
+
+  // The columns that do not fit the types inferred from the sample are promoted
+  for (auto const sample : {std::make_pair(10, 1), std::make_pair(100, 4), std::make_pair(3, 5)}) {
+    in_opts.set_type_inference_sample(sample.first, sample.second);
+    auto const result = cudf_io::read_csv(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(view, result.tbl->view());
+    EXPECT_EQ(expected.metadata.column_names, result.metadata.column_names);
+  }
+
+  EXPECT_THROW(in_opts.set_type_inference_sample(-1), cudf::logic_error);
+  EXPECT_THROW(in_opts.set_type_inference_sample(10, 0), cudf::logic_error);
+}
+
+TEST_F(CsvReaderTest, DictionaryColumns)
+{
+  auto filepath = temp_env->get_temp_filepath("DictionaryColumns.csv");
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "status,value,name\n"
+            << "ok,1,a\n"
+            << "\"a \"\"quoted\"\" value\",2,b\n"
+            << ",3,c\n"
+            << "ok,4,d\n"
+            << "error,5,e\n"
+            << "\"a \"\"quoted\"\" value\",6,f\n";
+  }
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+      .dictionary_columns({"status", "value"});
+  auto const result = cudf_io::read_csv(in_opts);
+  auto const view   = result.tbl->view();
+
+  ASSERT_EQ(view.column(0).type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(cudf::dictionary_column_view(view.column(0)).keys_size(), 3);
+  auto const decoded = cudf::dictionary::decode(view.column(0));
+  cudf::test::strings_column_wrapper expected_status(
+    {"ok", "a \"quoted\" value", "", "ok", "error", "a \"quoted\" value"}, {1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*decoded, expected_status);
+
+  // Columns that are not strings, or not listed, are not affected
+  EXPECT_EQ(view.column(1).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(view.column(2).type().id(), cudf::type_id::STRING);
+}
+
+TEST_F(CsvReaderTest, ChunkedReader)
+{
+  auto filepath = temp_env->get_temp_filepath("ChunkedReader.csv");
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << multiline_rows_csv(0, 1000, true);
+  }
+
+  // The first chunks may be too small to infer the types
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepath})
+      .dtypes({"int32", "str", "float64"});
+  auto const read_chunks = [&in_opts](std::size_t chunk_size) {
+    cudf_io::csv_chunked_reader reader(chunk_size, in_opts);
+    std::vector<cudf_io::table_with_metadata> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(reader.read_chunk());
+    }
+    return chunks;
+  };
+  auto const concatenate_chunks = [](std::vector<cudf_io::table_with_metadata> const& chunks) {
+    std::vector<cudf::table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(chunk.tbl->view());
+    }
+    return cudf::concatenate(views);
+  };
+
+  auto const expected = cudf_io::read_csv(in_opts);
+  ASSERT_EQ(expected.tbl->num_rows(), 1000);
+  for (std::size_t chunk_size : {0, 64, 1000, 100000}) {
+    auto const chunks = read_chunks(chunk_size);
+    EXPECT_EQ(chunks.size() > 1, chunk_size == 64 || chunk_size == 1000);
+    for (auto const& chunk : chunks) {
+      EXPECT_EQ(chunk.metadata.column_names, expected.metadata.column_names);
+    }
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), concatenate_chunks(chunks)->view());
+  }
+
+  // Row selection applies to the whole input
+  in_opts.set_skiprows(10);
+  in_opts.set_header(-1);
+  in_opts.set_nrows(500);
+  auto const expected_rows = cudf_io::read_csv(in_opts);
+  ASSERT_EQ(expected_rows.tbl->num_rows(), 500);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_rows.tbl->view(),
+                                concatenate_chunks(read_chunks(256))->view());
+}
+
+TEST_F(CsvReaderTest, MultipleFiles)
+{
+  std::vector<std::string> const contents{"id,name\n1,a\n2,\"b\nb\"\n",
+                                          "id,name\n3,c\n4,d",
+                                          "",
+                                          "id,name\n\n5,\n6,f\n"};
+  std::vector<std::string> filepaths;
+  for (auto const& content : contents) {
+    filepaths.push_back(
+      temp_env->get_temp_filepath("MultipleFiles" + std::to_string(filepaths.size()) + ".csv"));
+    std::ofstream outfile(filepaths.back(), std::ofstream::out);
+    outfile << content;
+  }
+
+  // The header of every file is removed, and no row spans two files
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepaths});
+  auto const result = cudf_io::read_csv(in_opts);
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"id", "name"}));
+  auto const view = result.tbl->view();
+  ASSERT_EQ(view.num_columns(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(view.column(0), wrapper<int64_t>{1, 2, 3, 4, 5, 6});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    view.column(1),
+    cudf::test::strings_column_wrapper({"a", "b\nb", "c", "d", "", "f"}, {1, 1, 1, 1, 0, 1}));
+
+  // The number of rows applies to all files
+  in_opts.set_nrows(3);
+  auto const first_rows = cudf_io::read_csv(in_opts);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(first_rows.tbl->get_column(0), wrapper<int64_t>{1, 2, 3});
+}
+
+TEST_F(CsvReaderTest, MultipleCompressedFiles)
+{
+  // Each source is large enough that its members are decompressed in parallel
+  auto const text = random_integer_csv(500000);
+  auto const rows = text.substr(text.find('\n') + 1);
+  std::vector<std::string> filepaths;
+  for (bool bgzf : {true, false, true}) {
+    filepaths.push_back(temp_env->get_temp_filepath("MultipleCompressedFiles" +
+                                                    std::to_string(filepaths.size()) + ".csv.gz"));
+    std::ofstream outfile(filepaths.back(), std::ofstream::binary);
+    outfile << cudf::test::gzip_members(text, bgzf ? 60000 : 1 << 20, bgzf);
+  }
+  auto const expected = read_csv_data(
+    text + rows + rows, "MultipleCompressedFiles.csv", cudf_io::compression_type::NONE);
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{filepaths})
+      .compression(cudf_io::compression_type::GZIP);
+  auto const result = cudf_io::read_csv(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+}
+
+TEST_F(CsvReaderTest, ParallelGzipDecompression)
+{
+  auto const text     = random_integer_csv(500000);
+  auto const expected = read_csv_data(text, "ParallelGzip.csv", cudf_io::compression_type::NONE);
+  ASSERT_EQ(expected.tbl->num_rows(), 500000);
+
+  // BGZF blocks, plain members, and a single member that is decompressed sequentially
+  for (auto const& compressed : {cudf::test::gzip_members(text, 60000, true),
+                                 cudf::test::gzip_members(text, 1 << 20, false),
+                                 cudf::test::gzip_members(text, text.size(), false)}) {
+    ASSERT_GE(compressed.size(), 4u << 20);
+    auto const result =
+      read_csv_data(compressed, "ParallelGzip.csv.gz", cudf_io::compression_type::GZIP);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+  }
+
+  // A gzip header inside the stored data of a single member, after a size trailer that the
+  // member data cannot produce; the input is decompressed sequentially
+  constexpr char fake_row[] = "1,2\xff\xff\xff\xff\x1f\x8b\x08\0\0\0\0\0\0\xff\n";
+  auto fake_text            = text;
+  fake_text.insert(fake_text.find('\n', 1000) + 1, fake_row, sizeof(fake_row) - 1);
+  auto const expected_fake =
+    read_csv_data(fake_text, "ParallelGzipFake.csv", cudf_io::compression_type::NONE);
+  auto const result_fake =
+    read_csv_data(cudf::test::gzip_members(fake_text, fake_text.size(), false, Z_NO_COMPRESSION),
+                  "ParallelGzipFake.csv.gz",
+                  cudf_io::compression_type::GZIP);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_fake.tbl->view(), result_fake.tbl->view());
+}
+
+TEST_F(CsvReaderTest, ParallelBz2Decompression)
+{
+  auto const text       = random_integer_csv(500000);
+  auto const compressed = cudf::test::bzip2_compress(text);
+  if (compressed.empty()) { GTEST_SKIP() << "Arrow is built without bzip2"; }
+  ASSERT_GE(compressed.size(), 4u << 20);
+
+  auto const expected = read_csv_data(text, "ParallelBz2.csv", cudf_io::compression_type::NONE);
+  auto const result =
+    read_csv_data(compressed, "ParallelBz2.csv.bz2", cudf_io::compression_type::BZIP2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/iterator.cuh>
+#include <cudf/io/chunked_host_buffer_sink.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+std::vector<char> make_test_data(size_t size)
+{
+  std::mt19937 engine(size);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  std::vector<char> data(size);
+  std::generate(data.begin(), data.end(), [&]() { return static_cast<char>(byte_dist(engine)); });
+  return data;
+}
+
+std::vector<char> read_file(std::string const& filepath)
+{
+  std::ifstream file(filepath, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+struct FileSinkTest : public cudf::test::BaseFixture,
+                      public ::testing::WithParamInterface<cudf_io::file_sink_mode> {
+};
+
+INSTANTIATE_TEST_CASE_P(FileSinkModes,
+                        FileSinkTest,
+                        ::testing::Values(cudf_io::file_sink_mode::SYNC,
+                                          cudf_io::file_sink_mode::ASYNC,
+                                          cudf_io::file_sink_mode::ASYNC_DIRECT));
+
+TEST_P(FileSinkTest, HostWrites)
+{
+  auto const filepath = temp_env->get_temp_filepath("FileSinkHostWrites.bin");
+  // Spans several staging buffers of the asynchronous sinks, and ends with a partial buffer
+  auto const data = make_test_data((40 << 20) + 12345);
+
+  auto sink = cudf_io::data_sink::create(filepath, GetParam());
+  // Mix of small writes and writes larger than the staging buffers
+  std::vector<size_t> const write_sizes{1, 100, 5000, 1 << 20, 20 << 20, 3};
+  size_t offset = 0;
+  for (size_t i = 0; offset < data.size(); ++i) {
+    auto const size = std::min(write_sizes[i % write_sizes.size()], data.size() - offset);
+    sink->host_write(data.data() + offset, size);
+    offset += size;
+  }
+  sink->flush();
+  EXPECT_EQ(sink->bytes_written(), data.size());
+
+  EXPECT_EQ(read_file(filepath), data);
+}
+
+TEST_P(FileSinkTest, WritesAfterFlush)
+{
+  auto const filepath = temp_env->get_temp_filepath("FileSinkWritesAfterFlush.bin");
+  auto const data     = make_test_data((9 << 20) + 777);
+  auto const split    = (8 << 20) + 100;
+
+  auto sink = cudf_io::data_sink::create(filepath, GetParam());
+  sink->host_write(data.data(), split);
+  sink->flush();
+  EXPECT_EQ(read_file(filepath), std::vector<char>(data.begin(), data.begin() + split));
+
+  // The partially filled buffer written by the flush is completed by the following writes
+  sink->host_write(data.data() + split, data.size() - split);
+  sink->flush();
+  EXPECT_EQ(read_file(filepath), data);
+}
+
+TEST_P(FileSinkTest, ParquetRoundTrip)
+{
+  auto const filepath = temp_env->get_temp_filepath("FileSinkParquetRoundTrip.parquet");
+
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  cudf::test::fixed_width_column_wrapper<int64_t> col(values, values + 1000000);
+  cudf::table_view expected({col});
+
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath, GetParam()}, expected);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+std::vector<char> gather_chunks(cudf_io::chunked_host_buffer_sink const& sink)
+{
+  std::vector<char> result;
+  for (auto const& chunk : sink.chunks()) {
+    result.insert(result.end(), chunk.begin(), chunk.end());
+  }
+  return result;
+}
+
+struct ChunkedHostBufferSinkTest : public cudf::test::BaseFixture,
+                                   public ::testing::WithParamInterface<bool> {
+};
+
+INSTANTIATE_TEST_CASE_P(PinnedAndPageable, ChunkedHostBufferSinkTest, ::testing::Bool());
+
+TEST_P(ChunkedHostBufferSinkTest, HostWrites)
+{
+  constexpr size_t chunk_size = 1000;
+  auto const data             = make_test_data(10 * chunk_size + 123);
+
+  cudf_io::chunked_host_buffer_sink sink(chunk_size, GetParam());
+  // Writes that fit in a chunk, end at a chunk boundary and span several chunks
+  std::vector<size_t> const write_sizes{10, 990, 1, 2500, 4000};
+  size_t offset = 0;
+  for (size_t i = 0; offset < data.size(); ++i) {
+    auto const size = std::min(write_sizes[i % write_sizes.size()], data.size() - offset);
+    sink.host_write(data.data() + offset, size);
+    offset += size;
+  }
+  EXPECT_EQ(sink.bytes_written(), data.size());
+
+  auto const chunks = sink.chunks();
+  ASSERT_EQ(chunks.size(), 11u);
+  auto const is_full = [](auto const& chunk) { return chunk.size() == chunk_size; };
+  EXPECT_TRUE(std::all_of(chunks.begin(), chunks.end() - 1, is_full));
+  EXPECT_EQ(chunks.back().size(), 123u);
+  EXPECT_EQ(gather_chunks(sink), data);
+
+  // Cleared sinks reuse their chunks
+  sink.clear();
+  EXPECT_EQ(sink.bytes_written(), 0u);
+  EXPECT_TRUE(sink.chunks().empty());
+  sink.host_write(data.data(), 10);
+  EXPECT_EQ(gather_chunks(sink), std::vector<char>(data.begin(), data.begin() + 10));
+}
+
+TEST_P(ChunkedHostBufferSinkTest, ParquetRoundTrip)
+{
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  cudf::test::fixed_width_column_wrapper<int64_t> col(values, values + 1000000);
+  cudf::table_view expected({col});
+
+  cudf_io::chunked_host_buffer_sink sink(1 << 20, GetParam());
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&sink}, expected);
+  cudf_io::write_parquet(out_opts);
+  EXPECT_GT(sink.chunks().size(), 1u);
+
+  auto const buffer = gather_chunks(sink);
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info{buffer.data(), buffer.size()});
+  auto const result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf/io/dataset.hpp>
+#include <cudf/io/orc.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <sys/stat.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+using int32_wrapper = cudf::test::fixed_width_column_wrapper<int32_t>;
+using str_wrapper   = cudf::test::strings_column_wrapper;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct DatasetTest : public cudf::test::BaseFixture,
+                     public ::testing::WithParamInterface<cudf_io::dataset_format> {
+  /**
+   * @brief Writes a dataset partitioned by date and region, with one or two files per partition.
+   *
+   * Rows are numbered in the order in which the partitions are discovered.
+   *
+   * @return Path of the root directory of the dataset
+   */
+  std::string write_dataset(std::string const& name)
+  {
+    auto const root = temp_env->get_temp_filepath(name);
+    std::vector<std::string> dirs{"",
+                                  "/date=2021-01-01",
+                                  "/date=2021-01-01/region=EU",
+                                  "/date=2021-01-01/region=US%20West",
+                                  "/date=2021-01-02",
+                                  "/date=2021-01-02/region=EU",
+                                  "/date=2021-01-02/region=__HIVE_DEFAULT_PARTITION__"};
+    for (auto& dir : dirs) {
+      dir = root + dir;
+      mkdir(dir.c_str(), 0755);
+    }
+    // Hidden files are not part of the dataset
+    std::ofstream success_marker(root + "/_SUCCESS");
+
+    std::vector<std::pair<std::string, std::vector<int32_t>>> const files{
+      {dirs[2] + "/part-0", {0, 1}},
+      {dirs[3] + "/part-0", {2, 3, 4}},
+      {dirs[5] + "/part-0", {5}},
+      {dirs[5] + "/part-1", {6, 7}},
+      {dirs[6] + "/part-0", {8, 9}}};
+    for (auto const& file : files) {
+      int32_wrapper values(file.second.begin(), file.second.end());
+      auto const tbl = cudf::table_view{std::vector<cudf::column_view>{values}};
+      if (GetParam() == cudf_io::dataset_format::PARQUET) {
+        auto const sink    = cudf_io::sink_info{file.first + ".parquet"};
+        auto const options = cudf_io::parquet_writer_options::builder(sink, tbl).build();
+        cudf_io::write_parquet(options);
+      } else {
+        auto const sink    = cudf_io::sink_info{file.first + ".orc"};
+        auto const options = cudf_io::orc_writer_options::builder(sink, tbl).build();
+        cudf_io::write_orc(options);
+      }
+    }
+    return root;
+  }
+};
+
+INSTANTIATE_TEST_CASE_P(DatasetFormats,
+                        DatasetTest,
+                        ::testing::Values(cudf_io::dataset_format::PARQUET,
+                                          cudf_io::dataset_format::ORC));
+
+TEST_P(DatasetTest, DiscoverPartitions)
+{
+  auto const root    = write_dataset("DiscoverPartitions");
+  auto const dataset = cudf_io::discover_hive_partitions(root);
+
+  EXPECT_EQ(dataset.partition_keys, (std::vector<std::string>{"date", "region"}));
+  ASSERT_EQ(dataset.partitions.size(), 4u);
+  EXPECT_EQ(dataset.partitions[1].values.at("date"), "2021-01-01");
+  EXPECT_EQ(dataset.partitions[1].values.at("region"), "US West");
+  EXPECT_EQ(dataset.partitions[2].files.size(), 2u);
+  EXPECT_EQ(dataset.partitions[3].values.at("region"), cudf_io::hive_null_partition_value);
+
+  // The filter is evaluated on each level, with the keys parsed so far
+  std::vector<size_t> num_filtered_keys;
+  auto const pruned = cudf_io::discover_hive_partitions(root, [&](auto const& values) {
+    num_filtered_keys.push_back(values.size());
+    return values.at("date") == "2021-01-02";
+  });
+  EXPECT_EQ(pruned.partitions.size(), 2u);
+  // The partitions of the first date are pruned without listing their directory
+  EXPECT_EQ(num_filtered_keys, (std::vector<size_t>{1, 1, 2, 2}));
+}
+
+TEST_P(DatasetTest, ReadAll)
+{
+  auto const root    = write_dataset("ReadAll");
+  auto const options = cudf_io::dataset_reader_options::builder(root, GetParam()).build();
+  auto const result  = cudf_io::read_dataset(options);
+
+  ASSERT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.metadata.column_names[1], "date");
+  EXPECT_EQ(result.metadata.column_names[2], "region");
+
+  int32_wrapper expected_values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0), expected_values);
+
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::DICTIONARY32);
+  auto const dates = cudf::dictionary::decode(result.tbl->get_column(1).view());
+  str_wrapper expected_dates{"2021-01-01",
+                             "2021-01-01",
+                             "2021-01-01",
+                             "2021-01-01",
+                             "2021-01-01",
+                             "2021-01-02",
+                             "2021-01-02",
+                             "2021-01-02",
+                             "2021-01-02",
+                             "2021-01-02"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*dates, expected_dates);
+
+  auto const regions = cudf::dictionary::decode(result.tbl->get_column(2).view());
+  str_wrapper expected_regions(
+    {"EU", "EU", "US West", "US West", "US West", "EU", "EU", "EU", "", ""},
+    {1, 1, 1, 1, 1, 1, 1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*regions, expected_regions);
+  EXPECT_EQ(cudf::dictionary_column_view(result.tbl->get_column(2)).keys_size(), 2);
+}
+
+TEST_P(DatasetTest, PartitionFilter)
+{
+  auto const root    = write_dataset("PartitionFilter");
+  auto const options = cudf_io::dataset_reader_options::builder(root, GetParam())
+                         .partition_filter([](auto const& values) {
+                           return values.count("region") == 0 || values.at("region") == "EU";
+                         })
+                         .build();
+  auto const result = cudf_io::read_dataset(options);
+
+  int32_wrapper expected_values{0, 1, 5, 6, 7};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0), expected_values);
+  auto const regions = cudf::dictionary::decode(result.tbl->get_column(2).view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*regions, str_wrapper({"EU", "EU", "EU", "EU", "EU"}));
+
+  // No partition selected
+  auto const none_options = cudf_io::dataset_reader_options::builder(root, GetParam())
+                              .partition_filter([](auto const&) { return false; })
+                              .build();
+  EXPECT_EQ(cudf_io::read_dataset(none_options).tbl->num_columns(), 0);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2021, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/caching_datasource.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/prefetching_datasource.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <io/utilities/file_io_utilities.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+/**
+ * @brief Host memory source that counts the read calls it receives.
+ */
+class CountingSource : public cudf_io::datasource {
+ public:
+  std::vector<uint8_t> const data;
+  std::atomic<size_t> num_reads{0};
+
+  CountingSource(std::vector<uint8_t> d) : data(std::move(d)) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++num_reads;
+    size = std::min(size, data.size() - offset);
+    return std::make_unique<non_owning_buffer>(const_cast<uint8_t*>(data.data()) + offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++num_reads;
+    auto const read_size = std::min(size, data.size() - offset);
+    std::memcpy(dst, data.data() + offset, read_size);
+    return read_size;
+  }
+
+  size_t size() const override { return data.size(); }
+};
+
+std::vector<uint8_t> make_test_data(size_t size)
+{
+  std::mt19937 engine(size);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  std::vector<uint8_t> data(size);
+  std::generate(data.begin(), data.end(), [&]() { return byte_dist(engine); });
+  return data;
+}
+
+std::string write_test_file(std::string const& name, std::vector<uint8_t> const& data)
+{
+  auto const filepath = temp_env->get_temp_filepath(name);
+  std::ofstream file(filepath, std::ios::binary);
+  file.write(reinterpret_cast<char const*>(data.data()), data.size());
+  return filepath;
+}
+
+struct DatasourceTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DatasourceTest, ReadRangesCoalescesNearbyRanges)
+{
+  CountingSource source(make_test_data(1 << 16));
+
+  // Two pairs of nearby ranges, far apart from each other; passed out of order
+  std::vector<uint8_t> out(4 * 100);
+  std::vector<cudf_io::datasource::read_range> ranges{{40000, 100, out.data() + 200},
+                                                      {100, 100, out.data()},
+                                                      {250, 100, out.data() + 100},
+                                                      {40150, 100, out.data() + 300}};
+
+  auto const bytes_read = source.host_read_ranges(ranges, 64);
+  EXPECT_EQ(source.num_reads, 2u);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    EXPECT_EQ(bytes_read[i], ranges[i].size);
+    EXPECT_EQ(std::memcmp(ranges[i].dst, source.data.data() + ranges[i].offset, ranges[i].size),
+              0);
+  }
+
+  // No gap allowed; only the adjacent ranges are merged
+  source.num_reads = 0;
+  std::vector<cudf_io::datasource::read_range> adjacent{
+    {0, 100, out.data()}, {100, 100, out.data() + 100}, {300, 100, out.data() + 200}};
+  source.host_read_ranges(adjacent, 0);
+  EXPECT_EQ(source.num_reads, 2u);
+}
+
+TEST_F(DatasourceTest, ReadRangesClampsToSourceSize)
+{
+  CountingSource source(make_test_data(1000));
+
+  std::vector<uint8_t> out(300);
+  std::vector<cudf_io::datasource::read_range> ranges{{900, 200, out.data()},
+                                                      {1100, 100, out.data() + 200}};
+
+  auto const bytes_read = source.host_read_ranges(ranges);
+  EXPECT_EQ(bytes_read[0], 100u);
+  EXPECT_EQ(bytes_read[1], 0u);
+}
+
+TEST_F(DatasourceTest, FileReadRanges)
+{
+  auto const data     = make_test_data(4 << 20);
+  auto const filepath = write_test_file("FileReadRanges.bin", data);
+  auto source         = cudf_io::datasource::create(filepath);
+
+  // Pairs of nearby ranges that can be merged, with large gaps between the pairs
+  std::vector<size_t> offsets;
+  for (size_t offset = 0; offset + 11'000 < data.size(); offset += 300'000) {
+    offsets.push_back(offset);
+    offsets.push_back(offset + 6'000);
+  }
+  std::vector<std::vector<uint8_t>> outputs(offsets.size(), std::vector<uint8_t>(5'000));
+  std::vector<cudf_io::datasource::read_range> ranges;
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    ranges.push_back({offsets[i], outputs[i].size(), outputs[i].data()});
+  }
+
+  auto const bytes_read = source->host_read_ranges(ranges);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_EQ(bytes_read[i], ranges[i].size);
+    EXPECT_TRUE(std::equal(outputs[i].begin(), outputs[i].end(), data.begin() + ranges[i].offset));
+  }
+}
+
+/**
+ * @brief Reads random ranges of a source from multiple threads and counts the mismatched reads.
+ */
+int concurrent_read_mismatches(cudf_io::datasource& source, std::vector<uint8_t> const& expected)
+{
+  constexpr int num_threads      = 16;
+  constexpr int reads_per_thread = 200;
+  constexpr size_t max_read_size = 64 << 10;
+  std::atomic<int> num_mismatches{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      std::mt19937 engine(t);
+      std::uniform_int_distribution<size_t> offset_dist(0, expected.size() - 1);
+      std::uniform_int_distribution<size_t> size_dist(1, max_read_size);
+      std::vector<uint8_t> dst(max_read_size);
+      for (int r = 0; r < reads_per_thread; ++r) {
+        auto const offset = offset_dist(engine);
+        auto const size   = std::min(size_dist(engine), expected.size() - offset);
+        bool matches      = false;
+        if (r % 2 == 0) {
+          auto const buffer = source.host_read(offset, size);
+          matches = buffer->size() == size && std::equal(buffer->data(),
+                                                         buffer->data() + size,
+                                                         expected.data() + offset);
+        } else {
+          matches = source.host_read(offset, size, dst.data()) == size &&
+                    std::equal(dst.data(), dst.data() + size, expected.data() + offset);
+        }
+        if (!matches) { ++num_mismatches; }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return num_mismatches;
+}
+
+TEST_F(DatasourceTest, ConcurrentDirectReads)
+{
+  auto const data     = make_test_data(8 << 20);
+  auto const filepath = write_test_file("ConcurrentDirectReads.bin", data);
+  auto source         = cudf_io::detail::make_direct_read_source(filepath);
+
+  EXPECT_EQ(concurrent_read_mismatches(*source, data), 0);
+}
+
+TEST_F(DatasourceTest, ConcurrentMemoryMappedReads)
+{
+  auto const data     = make_test_data(8 << 20);
+  auto const filepath = write_test_file("ConcurrentMemoryMappedReads.bin", data);
+  auto source         = cudf_io::datasource::create(filepath);
+
+  EXPECT_EQ(concurrent_read_mismatches(*source, data), 0);
+}
+
+TEST_F(DatasourceTest, ConcurrentHostBufferReads)
+{
+  auto const data = make_test_data(8 << 20);
+  auto source     = cudf_io::datasource::create(
+    cudf_io::host_buffer{reinterpret_cast<char const*>(data.data()), data.size()});
+
+  EXPECT_EQ(concurrent_read_mismatches(*source, data), 0);
+}
+
+TEST_F(DatasourceTest, ConcurrentReadRanges)
+{
+  auto const data     = make_test_data(8 << 20);
+  auto const filepath = write_test_file("ConcurrentReadRanges.bin", data);
+  auto source         = cudf_io::detail::make_direct_read_source(filepath);
+
+  constexpr int num_threads = 8;
+  std::atomic<int> num_mismatches{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      // Each thread reads an interleaved set of ranges
+      std::vector<std::vector<uint8_t>> outputs;
+      std::vector<cudf_io::datasource::read_range> ranges;
+      for (size_t offset = t * 10'000; offset + 10'000 < data.size(); offset += 500'000) {
+        outputs.emplace_back(10'000);
+      }
+      for (size_t i = 0; i < outputs.size(); ++i) {
+        ranges.push_back({t * 10'000 + i * 500'000, outputs[i].size(), outputs[i].data()});
+      }
+      source->host_read_ranges(ranges);
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        if (!std::equal(outputs[i].begin(), outputs[i].end(), data.begin() + ranges[i].offset)) {
+          ++num_mismatches;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(num_mismatches, 0);
+}
+
+/**
+ * @brief Waits until the source has prefetched the given number of bytes.
+ */
+bool wait_for_prefetch(cudf_io::prefetching_datasource const& source, size_t bytes)
+{
+  for (int i = 0; i < 1000; ++i) {
+    if (source.statistics().prefetched_bytes >= bytes) { return true; }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  return false;
+}
+
+TEST_F(DatasourceTest, PrefetchPlannedReads)
+{
+  auto counting_source = std::make_unique<CountingSource>(make_test_data(1 << 20));
+  auto const& data     = counting_source->data;
+  cudf_io::prefetching_datasource source(std::move(counting_source), 1 << 20);
+
+  std::vector<cudf_io::datasource::byte_range> plan;
+  size_t planned_bytes = 0;
+  for (size_t offset = 0; offset < data.size(); offset += 100'000) {
+    plan.push_back({offset, std::min<size_t>(50'000, data.size() - offset)});
+    planned_bytes += plan.back().size;
+  }
+  source.hint_reads(plan);
+  ASSERT_TRUE(wait_for_prefetch(source, planned_bytes));
+
+  // Planned ranges are read in parts, through both host_read overloads
+  std::vector<uint8_t> out(50'000);
+  for (auto const& range : plan) {
+    auto const half = range.size / 2;
+    auto const head = source.host_read(range.offset, half);
+    EXPECT_TRUE(std::equal(head->data(), head->data() + half, data.begin() + range.offset));
+    EXPECT_EQ(source.host_read(range.offset + half, range.size - half, out.data()),
+              range.size - half);
+    EXPECT_TRUE(
+      std::equal(out.begin(), out.begin() + range.size - half, data.begin() + range.offset + half));
+  }
+
+  auto const stats = source.statistics();
+  EXPECT_EQ(stats.hits, 2 * plan.size());
+  EXPECT_EQ(stats.misses, 0u);
+}
+
+TEST_F(DatasourceTest, PrefetchUnplannedReads)
+{
+  auto counting_source = std::make_unique<CountingSource>(make_test_data(1 << 16));
+  auto const& data     = counting_source->data;
+  cudf_io::prefetching_datasource source(std::move(counting_source), 1 << 16);
+
+  std::vector<cudf_io::datasource::byte_range> plan{{0, 1000}};
+  source.hint_reads(plan);
+
+  std::vector<uint8_t> out(1000);
+  std::vector<cudf_io::datasource::read_range> ranges{{5000, 1000, out.data()}};
+  EXPECT_EQ(source.host_read_ranges(ranges)[0], 1000u);
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin() + 5000));
+  EXPECT_EQ(source.statistics().misses, 1u);
+}
+
+TEST_F(DatasourceTest, PrefetchRespectsReadAheadSize)
+{
+  auto counting_source = std::make_unique<CountingSource>(make_test_data(1 << 20));
+  auto const& source_reads = counting_source->num_reads;
+  cudf_io::prefetching_datasource source(std::move(counting_source), 20'000);
+
+  std::vector<cudf_io::datasource::byte_range> plan;
+  for (size_t offset = 0; offset < 100'000; offset += 10'000) {
+    plan.push_back({offset, 10'000});
+  }
+  source.hint_reads(plan);
+  ASSERT_TRUE(wait_for_prefetch(source, 20'000));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  // Nothing is read ahead beyond the window until the prefetched data is consumed
+  EXPECT_EQ(source.statistics().prefetched_bytes, 20'000u);
+  EXPECT_EQ(source_reads, 2u);
+
+  std::vector<uint8_t> out(10'000);
+  source.host_read(0, 10'000, out.data());
+  ASSERT_TRUE(wait_for_prefetch(source, 30'000));
+}
+
+TEST_F(DatasourceTest, PrefetchSkippedHints)
+{
+  auto counting_source = std::make_unique<CountingSource>(make_test_data(1 << 20));
+  auto const& data     = counting_source->data;
+  cudf_io::prefetching_datasource source(std::move(counting_source), 20'000);
+
+  std::vector<cudf_io::datasource::byte_range> plan;
+  for (size_t offset = 0; offset < 100'000; offset += 10'000) {
+    plan.push_back({offset, 10'000});
+  }
+  source.hint_reads(plan);
+  ASSERT_TRUE(wait_for_prefetch(source, 20'000));
+
+  // The first planned ranges are never read; they are dropped once the reader moves past them,
+  // and the following ranges are prefetched
+  std::vector<uint8_t> out(10'000);
+  EXPECT_EQ(source.host_read(50'000, 10'000, out.data()), 10'000u);
+  ASSERT_TRUE(wait_for_prefetch(source, 40'000));
+  EXPECT_EQ(source.host_read(60'000, 10'000, out.data()), 10'000u);
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin() + 60'000));
+  EXPECT_EQ(source.statistics().hits, 1u);
+}
+
+TEST_F(DatasourceTest, PrefetchOverlappingHints)
+{
+  auto counting_source     = std::make_unique<CountingSource>(make_test_data(1 << 16));
+  auto const& data         = counting_source->data;
+  auto const& source_reads = counting_source->num_reads;
+  cudf_io::prefetching_datasource source(std::move(counting_source), 1 << 16);
+
+  // Overlapping and covered hints are planned as a single range
+  std::vector<cudf_io::datasource::byte_range> plan{{0, 10'000}, {5'000, 10'000}, {2'000, 1'000}};
+  source.hint_reads(plan);
+  ASSERT_TRUE(wait_for_prefetch(source, 15'000));
+  // Hints of data that is already prefetched are ignored
+  source.hint_reads(plan);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(source.statistics().prefetched_bytes, 15'000u);
+  EXPECT_EQ(source_reads, 1u);
+
+  std::vector<uint8_t> out(15'000);
+  EXPECT_EQ(source.host_read(0, 15'000, out.data()), 15'000u);
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin()));
+  EXPECT_EQ(source.statistics().misses, 0u);
+}
+
+struct ByteRangeCacheTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    cudf_io::clear_byte_range_cache();
+    cudf_io::set_byte_range_cache_budget(1 << 20);
+  }
+  void TearDown() override
+  {
+    cudf_io::set_byte_range_cache_budget(0);
+    cudf_io::clear_byte_range_cache();
+  }
+};
+
+TEST_F(ByteRangeCacheTest, RepeatedReads)
+{
+  auto const data = make_test_data(1 << 16);
+  std::vector<uint8_t> out(1000);
+
+  // Two sources with the same key share the cached ranges
+  for (int i = 0; i < 2; ++i) {
+    auto counting_source = std::make_unique<CountingSource>(data);
+    auto const& reads    = counting_source->num_reads;
+    cudf_io::caching_datasource source(std::move(counting_source), "RepeatedReads", 1);
+
+    auto const footer = source.host_read(data.size() - 1000, 1000);
+    EXPECT_TRUE(std::equal(footer->data(), footer->data() + 1000, data.end() - 1000));
+    EXPECT_EQ(source.host_read(0, 1000, out.data()), 1000u);
+    EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin()));
+    EXPECT_EQ(reads, i == 0 ? 2u : 0u);
+  }
+
+  auto const stats = cudf_io::get_byte_range_cache_statistics();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 2u);
+  EXPECT_EQ(stats.hit_bytes, 2000u);
+  EXPECT_EQ(stats.cached_size, 2000u);
+}
+
+TEST_F(ByteRangeCacheTest, NewVersionIsNotServedFromCache)
+{
+  auto const data = make_test_data(1 << 16);
+  for (int64_t version = 0; version < 2; ++version) {
+    cudf_io::caching_datasource source(
+      std::make_unique<CountingSource>(data), "NewVersion", version);
+    source.host_read(0, 1000);
+  }
+  EXPECT_EQ(cudf_io::get_byte_range_cache_statistics().hits, 0u);
+}
+
+TEST_F(ByteRangeCacheTest, EvictsLeastRecentlyUsed)
+{
+  cudf_io::set_byte_range_cache_budget(3000);
+  cudf_io::caching_datasource source(
+    std::make_unique<CountingSource>(make_test_data(1 << 16)), "EvictsLeastRecentlyUsed", 0);
+
+  // Reads larger than a quarter of the budget are not cached
+  source.host_read(0, 1000);
+  EXPECT_EQ(cudf_io::get_byte_range_cache_statistics().cached_size, 0u);
+
+  for (size_t offset = 0; offset < 5 * 700; offset += 700) {
+    source.host_read(offset, 700);
+  }
+  auto const stats = cudf_io::get_byte_range_cache_statistics();
+  EXPECT_EQ(stats.evictions, 1u);
+  EXPECT_EQ(stats.cached_size, 4 * 700u);
+
+  // The first range was evicted, the last one is still cached
+  source.host_read(4 * 700, 700);
+  source.host_read(0, 700);
+  EXPECT_EQ(cudf_io::get_byte_range_cache_statistics().hits, 1u);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -18,9 +18,14 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <tests/io/compression_utilities.hpp>
+
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -29,6 +34,7 @@
 
 #include <arrow/io/api.h>
 
+#include <algorithm>
 #include <fstream>
 #include <type_traits>
 
@@ -861,4 +867,91 @@ TEST_F(JsonReaderTest, ParseOutOfRangeIntegers)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(input_mixed_range_append, view.column(9));
 }
 
+TEST_F(JsonReaderTest, DictionaryColumns)
+{
+  auto filepath = temp_env->get_temp_dir() + "DictionaryColumns.json";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "{\"status\":\"ok\",\"n\":1}\n"
+            << "{\"status\":\"a \\\"b\\\"\",\"n\":2}\n"
+            << "{\"n\":3}\n"
+            << "{\"status\":\"ok\",\"n\":4}\n"
+            << "{\"status\":\"a \\\"b\\\"\",\"n\":5}\n";
+  }
+
+  cudf_io::json_reader_options in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{filepath})
+      .lines(true)
+      .dictionary_columns({"status"});
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_options);
+
+  auto const status_idx = std::distance(
+    result.metadata.column_names.begin(),
+    std::find(result.metadata.column_names.begin(), result.metadata.column_names.end(), "status"));
+  auto const status = result.tbl->view().column(status_idx);
+  ASSERT_EQ(status.type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(cudf::dictionary_column_view(status).keys_size(), 2);
+
+  auto const decoded = cudf::dictionary::decode(status);
+  cudf::test::strings_column_wrapper expected({"ok", "a \"b\"", "", "ok", "a \"b\""},
+                                              {1, 1, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*decoded, expected);
+}
+
+TEST_F(JsonReaderTest, ParallelDecompression)
+{
+  // Compressed copies of the input are large enough to be decompressed in parallel
+  auto const values = cudf::test::random_integers(1000000);
+  std::string text;
+  for (size_t i = 0; i < values.size(); i += 2) {
+    text += "[" + std::to_string(values[i]) + "," + std::to_string(values[i + 1]) + "]\n";
+  }
+  auto const read = [](std::string const& data,
+                       std::string const& filename,
+                       cudf_io::compression_type compression) {
+    auto const filepath = temp_env->get_temp_dir() + filename;
+    {
+      std::ofstream outfile(filepath, std::ofstream::binary);
+      outfile << data;
+    }
+    cudf_io::json_reader_options in_options =
+      cudf_io::json_reader_options::builder(cudf_io::source_info{filepath})
+        .lines(true)
+        .compression(compression);
+    return cudf_io::read_json(in_options);
+  };
+  auto const expected = read(text, "ParallelDecompression.json", cudf_io::compression_type::NONE);
+  ASSERT_EQ(expected.tbl->num_rows(), 500000);
+
+  // BGZF blocks, plain members, and a single member that is decompressed sequentially
+  for (auto const& compressed : {cudf::test::gzip_members(text, 60000, true),
+                                 cudf::test::gzip_members(text, 1 << 20, false),
+                                 cudf::test::gzip_members(text, text.size(), false)}) {
+    ASSERT_GE(compressed.size(), 4u << 20);
+    auto const result =
+      read(compressed, "ParallelDecompression.json.gz", cudf_io::compression_type::GZIP);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result.tbl->view());
+  }
+
+  // A gzip header inside the stored data of a single member, after a size trailer that the
+  // member data cannot produce; the input is decompressed sequentially
+  constexpr char fake_row[] = "[1,\"\xff\xff\xff\xff\x1f\x8b\x08\0\0\0\0\0\0\xff\"]\n";
+  auto fake_text            = text;
+  fake_text.insert(fake_text.find('\n', 1000) + 1, fake_row, sizeof(fake_row) - 1);
+  auto const expected_fake =
+    read(fake_text, "ParallelDecompressionFake.json", cudf_io::compression_type::NONE);
+  auto const result_fake =
+    read(cudf::test::gzip_members(fake_text, fake_text.size(), false, Z_NO_COMPRESSION),
+         "ParallelDecompressionFake.json.gz",
+         cudf_io::compression_type::GZIP);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_fake.tbl->view(), result_fake.tbl->view());
+
+  auto const bz2_compressed = cudf::test::bzip2_compress(text);
+  if (bz2_compressed.empty()) { GTEST_SKIP() << "Arrow is built without bzip2"; }
+  ASSERT_GE(bz2_compressed.size(), 4u << 20);
+  auto const bz2_result =
+    read(bz2_compressed, "ParallelDecompression.json.bz2", cudf_io::compression_type::BZIP2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), bz2_result.tbl->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,16 +21,19 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/linearizer.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <cstdlib>
 #include <type_traits>
 
 namespace cudf_io = cudf::io;
@@ -583,6 +586,136 @@ TEST_F(OrcWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, CompressionRoundTrip)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto int_values         = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 100); });
+  auto string_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  column_wrapper<int32_t> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(string_values, string_values + num_rows);
+  table_view expected({col0, col1});
+
+  auto write_to_buffer = [&](cudf_io::compression_type compression) {
+    std::vector<char> out_buffer;
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(compression);
+    cudf_io::write_orc(out_opts);
+    return out_buffer;
+  };
+  auto const uncompressed_buffer = write_to_buffer(cudf_io::compression_type::NONE);
+
+  for (auto compression : {cudf_io::compression_type::SNAPPY,
+                           cudf_io::compression_type::ZSTD,
+                           cudf_io::compression_type::LZ4}) {
+    auto const buffer = write_to_buffer(compression);
+    EXPECT_LT(buffer.size(), uncompressed_buffer.size());
+
+    cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info(buffer.data(), buffer.size()));
+    const auto result = cudf_io::read_orc(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
+TEST_F(OrcReaderTest, HostDecompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto int_values         = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 100); });
+  auto string_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  column_wrapper<int32_t> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(string_values, string_values + num_rows);
+  table_view expected({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_orc(out_opts);
+
+  // The same file is decompressed on the GPU, then on the host
+  cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto const read_with_policy = [&in_opts](char const* policy) {
+    setenv("LIBCUDF_HOST_DECOMPRESSION", policy, 1);
+    auto result = cudf_io::read_orc(in_opts);
+    unsetenv("LIBCUDF_HOST_DECOMPRESSION");
+    return result;
+  };
+  auto const device_result = read_with_policy("OFF");
+  auto const host_result   = read_with_policy("ALWAYS");
+  CUDF_TEST_EXPECT_TABLES_EQUAL(device_result.tbl->view(), host_result.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, host_result.tbl->view());
+}
+
+TEST_F(OrcWriterTest, PerColumnCompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto int_values         = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 100); });
+  auto string_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  column_wrapper<int32_t> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(string_values, string_values + num_rows);
+  column_wrapper<int32_t> col2(int_values, int_values + num_rows);
+  table_view expected({col0, col1, col2});
+
+  cudf_io::table_metadata expected_metadata;
+  expected_metadata.column_names.emplace_back("ints");
+  expected_metadata.column_names.emplace_back("strings");
+  expected_metadata.column_names.emplace_back("level_ints");
+
+  cudf_io::orc_column_compression uncompressed;
+  uncompressed.compressed = false;
+  cudf_io::orc_column_compression high_level;
+  high_level.level = 19;
+
+  std::vector<char> out_buffer;
+  std::vector<cudf_io::column_compression_statistics> stats;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .metadata(&expected_metadata)
+      .compression(cudf_io::compression_type::ZSTD)
+      .column_compression(1, uncompressed)
+      .column_compression(2, high_level)
+      .compression_statistics(&stats);
+  cudf_io::write_orc(out_opts);
+
+  ASSERT_EQ(stats.size(), 3u);
+  EXPECT_EQ(stats[0].name, "ints");
+  EXPECT_EQ(stats[0].compression, cudf_io::compression_type::ZSTD);
+  EXPECT_GT(stats[0].compression_ratio(), 1.0);
+  EXPECT_EQ(stats[1].name, "strings");
+  EXPECT_EQ(stats[1].compression, cudf_io::compression_type::NONE);
+  // Uncompressed blocks still carry a 3-byte header
+  EXPECT_GE(stats[1].compressed_size, stats[1].uncompressed_size);
+  EXPECT_EQ(stats[2].name, "level_ints");
+  EXPECT_EQ(stats[2].compression, cudf_io::compression_type::ZSTD);
+  EXPECT_GT(stats[2].compression_ratio(), 1.0);
+
+  // The chunked writer reports the statistics accumulated over all written tables on close
+  std::vector<char> chunked_buffer;
+  std::vector<cudf_io::column_compression_statistics> chunked_stats;
+  cudf_io::chunked_orc_writer_options chunked_opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info(&chunked_buffer))
+      .compression(cudf_io::compression_type::ZSTD)
+      .compression_statistics(&chunked_stats);
+  cudf_io::orc_chunked_writer(chunked_opts).write(expected).write(expected).close();
+  ASSERT_EQ(chunked_stats.size(), 3u);
+  EXPECT_EQ(chunked_stats[0].uncompressed_size, 2 * stats[0].uncompressed_size);
+
+  cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  const auto result = cudf_io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, negTimestampsNano)
 {
   // This is a separate test because ORC format has a bug where writing a timestamp between -1 and 0
@@ -814,6 +947,136 @@ TEST_F(OrcChunkedWriterTest, ReadStripes)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(OrcChunkedWriterTest, ReadStripesWithMetadataHandle)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedStripesHandle.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(*table1).write(*table2);
+
+  // The footer is parsed once and reused to read each stripe
+  auto const handle = cudf_io::parse_orc_metadata(cudf_io::source_info{filepath});
+  std::vector<table_view> expected{*table1, *table2};
+  for (cudf::size_type stripe = 0; stripe < 2; ++stripe) {
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+        .stripes({stripe})
+        .metadata_handle(handle);
+    auto result = cudf_io::read_orc(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, expected[stripe]);
+  }
+
+  // The handle cannot be used with a different file
+  auto other_filepath = temp_env->get_temp_filepath("ChunkedStripesHandleOther.orc");
+  cudf_io::chunked_orc_writer_options other_opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{other_filepath});
+  cudf_io::orc_chunked_writer(other_opts).write(*table1);
+  cudf_io::orc_reader_options other_read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{other_filepath})
+      .metadata_handle(handle);
+  EXPECT_THROW(cudf_io::read_orc(other_read_opts), cudf::logic_error);
+}
+
+TEST_F(OrcChunkedWriterTest, FilterStripesWithStatistics)
+{
+  auto sequence1 = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto sequence2 = cudf::detail::make_counting_transform_iterator(100, [](auto i) { return i; });
+  column_wrapper<int64_t> col1(sequence1, sequence1 + 100);
+  column_wrapper<int64_t> col2(sequence2, sequence2 + 100);
+  auto const table1 = table_view({col1});
+  auto const table2 = table_view({col2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilterStripes.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(table1).write(table2);
+
+  // col0 < 50 can only be true in the first stripe
+  auto value         = cudf::numeric_scalar<int32_t>(50);
+  auto const literal = cudf::ast::literal(value);
+  auto const col_ref = cudf::ast::column_reference(0);
+  auto const filter  = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref, literal);
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(&filter);
+  auto result = cudf_io::read_orc(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table1);
+  EXPECT_EQ(result.metadata.num_pruned_row_groups, 1);
+
+  // No stripe can match col0 < -1; the result is empty
+  auto negative_value         = cudf::numeric_scalar<int32_t>(-1);
+  auto const negative_literal = cudf::ast::literal(negative_value);
+  auto const none = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref, negative_literal);
+  read_opts.set_filter(&none);
+  result = cudf_io::read_orc(read_opts);
+
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.metadata.num_pruned_row_groups, 2);
+}
+
+TEST_F(OrcChunkedWriterTest, ChunkedReadStripes)
+{
+  constexpr cudf::size_type num_stripe_rows = 1000;
+  std::vector<std::unique_ptr<column_wrapper<int64_t>>> columns;
+  std::vector<table_view> tables;
+  for (int stripe = 0; stripe < 4; ++stripe) {
+    auto sequence = cudf::detail::make_counting_transform_iterator(
+      stripe * num_stripe_rows, [](auto i) { return i; });
+    columns.push_back(
+      std::make_unique<column_wrapper<int64_t>>(sequence, sequence + num_stripe_rows));
+    tables.push_back(table_view({*columns.back()}));
+  }
+  auto const expected = cudf::concatenate(tables);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadStripes.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer writer(opts);
+  for (auto const& table : tables) {
+    writer.write(table);
+  }
+  writer.close();
+
+  auto const read_chunks = [&](std::size_t chunk_read_limit,
+                               cudf_io::orc_reader_options const& options) {
+    cudf_io::orc_chunked_reader reader(chunk_read_limit, options);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    return chunks;
+  };
+
+  // Each chunk holds two stripes
+  constexpr std::size_t chunk_read_limit = 3 * num_stripe_rows * sizeof(int64_t);
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+  auto chunks = read_chunks(chunk_read_limit, read_opts);
+  ASSERT_EQ(chunks.size(), 2u);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    auto const first_row = static_cast<cudf::size_type>(2 * i * num_stripe_rows);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(
+      *chunks[i], cudf::slice(*expected, {first_row, first_row + 2 * num_stripe_rows})[0]);
+  }
+
+  // Only the selected rows of the first and last stripes count towards the limit
+  cudf_io::orc_reader_options range_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(500)
+      .num_rows(3000);
+  chunks = read_chunks(chunk_read_limit, range_opts);
+  ASSERT_EQ(chunks.size(), 2u);
+  EXPECT_EQ(chunks[0]->num_rows(), 2500);
+  EXPECT_EQ(chunks[1]->num_rows(), 500);
+  auto const range_result = cudf::concatenate(
+    std::vector<table_view>({chunks[0]->view(), chunks[1]->view()}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*range_result, cudf::slice(*expected, {500, 3500})[0]);
+}
+
 TEST_F(OrcChunkedWriterTest, ReadStripesError)
 {
   srand(31337);
@@ -937,6 +1200,79 @@ TEST_F(OrcReaderTest, CombinedSkipRowTest)
   skip_row.test(2, 100, 110);
 }
 
+TEST_F(OrcReaderTest, MultipleFiles)
+{
+  srand(31337);
+  std::vector<std::unique_ptr<cudf::table>> tables;
+  tables.push_back(create_random_fixed_table<int>(5, 10, true));
+  tables.push_back(create_random_fixed_table<int>(5, 20, true));
+  tables.push_back(create_random_fixed_table<int>(5, 30, true));
+
+  std::vector<std::string> filepaths;
+  std::vector<table_view> views;
+  for (size_t i = 0; i < tables.size(); ++i) {
+    filepaths.push_back(temp_env->get_temp_filepath("MultipleFiles" + std::to_string(i) + ".orc"));
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepaths.back()}, *tables[i]);
+    cudf_io::write_orc(out_opts);
+    views.push_back(*tables[i]);
+  }
+  auto const expected = cudf::concatenate(views);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepaths});
+  auto result = cudf_io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+  // The selected rows span the boundaries between the files
+  cudf_io::orc_reader_options range_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepaths})
+      .skip_rows(5)
+      .num_rows(30);
+  auto range_result = cudf_io::read_orc(range_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*range_result.tbl, cudf::slice(*expected, {5, 35})[0]);
+
+  // Dictionaries and compression are specific to each file
+  std::vector<std::string> dict_paths;
+  std::vector<cudf::test::strings_column_wrapper> dict_columns;
+  for (int i = 0; i < 2; ++i) {
+    std::vector<std::string> values(1000);
+    for (size_t row = 0; row < values.size(); ++row) {
+      values[row] = std::string(row % 3 ? "repeated" : "other") + std::to_string(i);
+    }
+    dict_columns.emplace_back(values.begin(), values.end());
+    dict_paths.push_back(
+      temp_env->get_temp_filepath("MultipleFilesDict" + std::to_string(i) + ".orc"));
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info{dict_paths.back()},
+                                           table_view{{dict_columns.back()}})
+        .compression(i == 0 ? cudf_io::compression_type::NONE : cudf_io::compression_type::SNAPPY);
+    cudf_io::write_orc(out_opts);
+  }
+  auto const dict_expected = cudf::concatenate(
+    std::vector<table_view>{table_view{{dict_columns[0]}}, table_view{{dict_columns[1]}}});
+  cudf_io::orc_reader_options dict_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{dict_paths}).skip_rows(990);
+  auto dict_result = cudf_io::read_orc(dict_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*dict_result.tbl, cudf::slice(*dict_expected, {990, 2000})[0]);
+
+  // Stripes can only be selected in a single file
+  cudf_io::orc_reader_options stripe_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepaths}).stripes({0});
+  EXPECT_THROW(cudf_io::read_orc(stripe_opts), cudf::logic_error);
+
+  // All files must have the same schema
+  auto const other_table = create_random_fixed_table<float>(5, 10, true);
+  auto const other_path  = temp_env->get_temp_filepath("MultipleFilesOther.orc");
+  cudf_io::orc_writer_options other_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{other_path}, *other_table);
+  cudf_io::write_orc(other_opts);
+  std::vector<std::string> const mismatch_paths{filepaths[0], other_path};
+  cudf_io::orc_reader_options mismatch_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{mismatch_paths});
+  EXPECT_THROW(cudf_io::read_orc(mismatch_opts), cudf::logic_error);
+}
+
 TEST_F(OrcStatisticsTest, Basic)
 {
   auto sequence  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
@@ -14,12 +14,14 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/linearizer.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -31,8 +33,12 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <io/parquet/parquet.hpp>
+
 #include <rmm/cuda_stream_view.hpp>
 
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <type_traits>
 
@@ -863,6 +869,156 @@ TEST_F(ParquetWriterTest, HostBuffer)
   compare_metadata_equality(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, CompressionRoundTrip)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto int_values         = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 100); });
+  auto string_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  column_wrapper<int32_t> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(string_values, string_values + num_rows);
+  table_view expected({col0, col1});
+
+  auto write_to_buffer = [&](cudf_io::compression_type compression) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(compression);
+    cudf_io::write_parquet(out_opts);
+    return out_buffer;
+  };
+  auto const uncompressed_buffer = write_to_buffer(cudf_io::compression_type::NONE);
+
+  for (auto compression : {cudf_io::compression_type::SNAPPY,
+                           cudf_io::compression_type::ZSTD,
+                           cudf_io::compression_type::LZ4}) {
+    auto const buffer = write_to_buffer(compression);
+    EXPECT_LT(buffer.size(), uncompressed_buffer.size());
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(buffer.data(), buffer.size()));
+    const auto result = cudf_io::read_parquet(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
+TEST_F(ParquetReaderTest, HostDecompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto int_values         = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 100); });
+  auto string_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  column_wrapper<int32_t> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(string_values, string_values + num_rows);
+  table_view expected({col0, col1});
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .compression(cudf_io::compression_type::SNAPPY);
+  cudf_io::write_parquet(out_opts);
+
+  // The same file is decompressed on the GPU, then on the host
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto const read_with_policy = [&in_opts](char const* policy) {
+    setenv("LIBCUDF_HOST_DECOMPRESSION", policy, 1);
+    auto result = cudf_io::read_parquet(in_opts);
+    unsetenv("LIBCUDF_HOST_DECOMPRESSION");
+    return result;
+  };
+  auto const device_result = read_with_policy("OFF");
+  auto const host_result   = read_with_policy("ALWAYS");
+  CUDF_TEST_EXPECT_TABLES_EQUAL(device_result.tbl->view(), host_result.tbl->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, host_result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, PerColumnCompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto int_values         = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(i % 100); });
+  auto string_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "value_" + std::to_string(i % 1000); });
+  column_wrapper<int32_t> col0(int_values, int_values + num_rows);
+  column_wrapper<cudf::string_view> col1(string_values, string_values + num_rows);
+  column_wrapper<int32_t> col2(int_values, int_values + num_rows);
+  // Random values do not compress, so their chunks are stored uncompressed
+  auto random_data = random_values<int64_t>(num_rows);
+  column_wrapper<int64_t> col3(random_data.begin(), random_data.end());
+  table_view expected({col0, col1, col2, col3});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("strings").set_compression(
+    cudf_io::compression_type::NONE);
+  expected_metadata.column_metadata[2]
+    .set_name("zstd_ints")
+    .set_compression(cudf_io::compression_type::ZSTD)
+    .set_compression_level(19);
+  expected_metadata.column_metadata[3].set_name("random");
+
+  std::vector<char> out_buffer;
+  std::vector<cudf_io::column_compression_statistics> stats;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .metadata(&expected_metadata)
+      .compression(cudf_io::compression_type::AUTO)
+      .compression_statistics(&stats);
+  cudf_io::write_parquet(out_opts);
+
+  ASSERT_EQ(stats.size(), 4u);
+  EXPECT_EQ(stats[0].name, "ints");
+  EXPECT_EQ(stats[0].compression, cudf_io::compression_type::SNAPPY);
+  EXPECT_GT(stats[0].compression_ratio(), 1.0);
+  EXPECT_EQ(stats[1].name, "strings");
+  EXPECT_EQ(stats[1].compression, cudf_io::compression_type::NONE);
+  EXPECT_EQ(stats[1].compressed_size, stats[1].uncompressed_size);
+  EXPECT_EQ(stats[2].name, "zstd_ints");
+  EXPECT_EQ(stats[2].compression, cudf_io::compression_type::ZSTD);
+  EXPECT_GT(stats[2].compression_ratio(), 1.0);
+  EXPECT_EQ(stats[3].name, "random");
+  EXPECT_EQ(stats[3].compression, cudf_io::compression_type::NONE);
+  EXPECT_EQ(stats[3].compressed_size, stats[3].uncompressed_size);
+
+  // The chunked writer reports the statistics accumulated over all written tables on close
+  std::vector<char> chunked_buffer;
+  std::vector<cudf_io::column_compression_statistics> chunked_stats;
+  cudf_io::chunked_parquet_writer_options chunked_opts =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info(&chunked_buffer))
+      .metadata(&expected_metadata)
+      .compression(cudf_io::compression_type::AUTO)
+      .compression_statistics(&chunked_stats);
+  cudf_io::parquet_chunked_writer(chunked_opts).write(expected).write(expected).close();
+  ASSERT_EQ(chunked_stats.size(), 4u);
+  EXPECT_EQ(chunked_stats[0].uncompressed_size, 2 * stats[0].uncompressed_size);
+
+  cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  const auto result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, CompressionLevelRequiresZstd)
+{
+  column_wrapper<int32_t> col0{1, 2, 3};
+  table_view expected({col0});
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_compression_level(3);
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .metadata(&expected_metadata)
+      .compression(cudf_io::compression_type::SNAPPY);
+  EXPECT_THROW(cudf_io::write_parquet(out_opts), cudf::logic_error);
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -1196,6 +1352,50 @@ TEST_F(ParquetWriterTest, Slice)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(read_table.tbl->view(), tbl);
 }
 
+TEST_F(ParquetWriterTest, PageIndexSkipPages)
+{
+  // Large enough for the column chunk to be split into several pages
+  constexpr cudf::size_type num_rows = 1'000'000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int64_t> col(sequence, sequence + num_rows);
+  auto const expected = table_view({col});
+
+  auto filepath = temp_env->get_temp_filepath("PageIndexSkipPages.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE);
+  cudf_io::write_parquet(out_opts);
+
+  // Rows in the middle of the column chunk, read from the pages that contain them
+  constexpr cudf::size_type skip_rows = 600'000;
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(skip_rows)
+      .num_rows(100);
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl,
+                                cudf::slice(expected, {skip_rows, skip_rows + 100})[0]);
+
+  // Point lookup, where the column indexes of the pages exclude the rows before and after it
+  auto value         = cudf::numeric_scalar<int64_t>(skip_rows);
+  auto const literal = cudf::ast::literal(value);
+  auto const col_ref = cudf::ast::column_reference(0);
+  auto const filter  = cudf::ast::expression(cudf::ast::ast_operator::EQUAL, col_ref, literal);
+  cudf_io::parquet_reader_options filter_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(&filter);
+  result = cudf_io::read_parquet(filter_opts);
+
+  // Only the rows of the pages that may contain the value are returned
+  auto const values = cudf::test::to_host<int64_t>(result.tbl->get_column(0)).first;
+  ASSERT_FALSE(values.empty());
+  EXPECT_LT(result.tbl->num_rows(), num_rows);
+  auto const first_row = static_cast<cudf::size_type>(values.front());
+  auto const end_row   = first_row + result.tbl->num_rows();
+  EXPECT_LE(first_row, skip_rows);
+  EXPECT_GT(end_row, skip_rows);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, cudf::slice(expected, {first_row, end_row})[0]);
+}
+
 TEST_F(ParquetChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -1856,6 +2056,199 @@ TEST_F(ParquetChunkedWriterTest, ReadRowGroups)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(ParquetChunkedWriterTest, ReadRowGroupsWithMetadataHandle)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowGroupsHandle.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  {
+    cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2);
+  }
+
+  // The footer is parsed once and reused to read each row group
+  auto const handle = cudf_io::parse_parquet_metadata(cudf_io::source_info{filepath});
+  std::vector<table_view> expected{*table1, *table2};
+  for (cudf::size_type row_group = 0; row_group < 2; ++row_group) {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .row_groups({{row_group}})
+        .metadata_handle(handle);
+    auto result = cudf_io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, expected[row_group]);
+  }
+
+  // The handle cannot be used with a different number of sources
+  std::vector<std::string> const two_filepaths{filepath, filepath};
+  cudf_io::parquet_reader_options two_sources_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{two_filepaths})
+      .metadata_handle(handle);
+  EXPECT_THROW(cudf_io::read_parquet(two_sources_opts), cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadColumnsOfRowGroup)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+
+  cudf_io::table_input_metadata expected_metadata(*table1);
+  for (size_t i = 0; i < expected_metadata.column_metadata.size(); ++i) {
+    expected_metadata.column_metadata[i].set_name("col" + std::to_string(i));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRowGroupColumns.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  args.set_metadata(&expected_metadata);
+  {
+    cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2);
+  }
+
+  // Only the metadata of the selected column chunks is decoded from the footer
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .columns({"col1", "col3"})
+      .row_groups({{1}});
+  auto result = cudf_io::read_parquet(read_opts);
+
+  auto const expected = table_view({table2->get_column(1), table2->get_column(3)});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, expected);
+}
+
+TEST_F(ParquetChunkedWriterTest, LazyFooterMatchesEagerFooter)
+{
+  // String and list-of-string columns make the column chunks hold several paths in
+  // `path_in_schema`, which have to be skipped as lists of strings when the footer is read lazily
+  column_wrapper<int> col0{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  column_wrapper<cudf::string_view> col1{{"Monday", "", "Wednesday", "Thursday"}, {1, 1, 0, 1}};
+  cudf::test::lists_column_wrapper<cudf::string_view> col2{
+    {"a", "bb"}, {"ccc"}, {}, {"dddd", "eeeee", "f"}};
+  auto table1 = table_view({col0, col1, col2});
+  auto table2 = table_view({col0, col1, col2});
+
+  cudf_io::table_input_metadata expected_metadata(table1);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("strings");
+  expected_metadata.column_metadata[2].set_name("lists");
+
+  std::vector<char> out_buffer;
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{&out_buffer});
+  args.set_metadata(&expected_metadata);
+  {
+    cudf_io::parquet_chunked_writer(args).write(table1).write(table2);
+  }
+
+  // The footer length and the magic number make up the last 8 bytes of the file
+  uint32_t footer_len = 0;
+  ASSERT_GT(out_buffer.size(), 8u);
+  std::memcpy(&footer_len, out_buffer.data() + out_buffer.size() - 8, sizeof(footer_len));
+  ASSERT_LE(footer_len + 8u, out_buffer.size());
+  auto const footer =
+    reinterpret_cast<uint8_t const*>(out_buffer.data() + out_buffer.size() - 8 - footer_len);
+
+  cudf_io::parquet::FileMetaData eager_md;
+  cudf_io::parquet::CompactProtocolReader eager_cp(footer, footer_len);
+  ASSERT_TRUE(eager_cp.read(&eager_md));
+  ASSERT_TRUE(eager_cp.InitSchema(&eager_md));
+
+  cudf_io::parquet::FileMetaData lazy_md;
+  cudf_io::parquet::CompactProtocolReader lazy_cp(footer, footer_len);
+  ASSERT_TRUE(lazy_cp.read_lazy(&lazy_md));
+  ASSERT_TRUE(lazy_cp.InitSchema(&lazy_md));
+
+  EXPECT_EQ(lazy_md.num_rows, eager_md.num_rows);
+  EXPECT_EQ(lazy_md.schema.size(), eager_md.schema.size());
+  ASSERT_EQ(lazy_md.row_groups.size(), 2u);
+  ASSERT_EQ(lazy_md.row_groups.size(), eager_md.row_groups.size());
+  for (size_t rg = 0; rg < eager_md.row_groups.size(); ++rg) {
+    auto const& eager_rg = eager_md.row_groups[rg];
+    auto const& lazy_rg  = lazy_md.row_groups[rg];
+    EXPECT_EQ(lazy_rg.num_rows, eager_rg.num_rows);
+    EXPECT_EQ(lazy_rg.total_byte_size, eager_rg.total_byte_size);
+    EXPECT_TRUE(lazy_rg.columns.empty());
+    ASSERT_EQ(lazy_rg.num_columns(), eager_rg.columns.size());
+    for (size_t col = 0; col < eager_rg.columns.size(); ++col) {
+      auto const& expected = eager_rg.columns[col];
+      cudf_io::parquet::ColumnChunk chunk;
+      ASSERT_TRUE(
+        cudf_io::parquet::CompactProtocolReader::DecodeColumnChunk(lazy_md, lazy_rg, col, &chunk));
+      EXPECT_EQ(chunk.file_path, expected.file_path);
+      EXPECT_EQ(chunk.file_offset, expected.file_offset);
+      EXPECT_EQ(chunk.schema_idx, expected.schema_idx);
+      EXPECT_EQ(chunk.meta_data.type, expected.meta_data.type);
+      EXPECT_EQ(chunk.meta_data.encodings, expected.meta_data.encodings);
+      EXPECT_EQ(chunk.meta_data.path_in_schema, expected.meta_data.path_in_schema);
+      EXPECT_EQ(chunk.meta_data.codec, expected.meta_data.codec);
+      EXPECT_EQ(chunk.meta_data.num_values, expected.meta_data.num_values);
+      EXPECT_EQ(chunk.meta_data.total_uncompressed_size,
+                expected.meta_data.total_uncompressed_size);
+      EXPECT_EQ(chunk.meta_data.total_compressed_size, expected.meta_data.total_compressed_size);
+      EXPECT_EQ(chunk.meta_data.data_page_offset, expected.meta_data.data_page_offset);
+      EXPECT_EQ(chunk.meta_data.dictionary_page_offset,
+                expected.meta_data.dictionary_page_offset);
+      EXPECT_EQ(chunk.meta_data.statistics_blob, expected.meta_data.statistics_blob);
+    }
+  }
+  // The nested column has more than one path element
+  EXPECT_GT(eager_md.row_groups[0].columns.back().meta_data.path_in_schema.size(), 1u);
+
+  // The reader decodes the column chunks lazily as well
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info{out_buffer.data(), out_buffer.size()})
+      .row_groups({{1}});
+  auto result = cudf_io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+}
+
+TEST_F(ParquetChunkedWriterTest, FilterRowGroupsWithStatistics)
+{
+  auto sequence1 = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto sequence2 = cudf::detail::make_counting_transform_iterator(100, [](auto i) { return i; });
+  column_wrapper<int32_t> col1(sequence1, sequence1 + 100);
+  column_wrapper<int32_t> col2(sequence2, sequence2 + 100);
+  auto const table1 = table_view({col1});
+  auto const table2 = table_view({col2});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilterRowGroups.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(table1).write(table2);
+
+  // col0 >= 150 can only be true in the second row group
+  auto value         = cudf::numeric_scalar<int32_t>(150);
+  auto const literal = cudf::ast::literal(value);
+  auto const col_ref = cudf::ast::column_reference(0);
+  auto const filter =
+    cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, literal);
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(&filter);
+  auto result = cudf_io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table2);
+  EXPECT_EQ(result.metadata.num_pruned_row_groups, 1);
+
+  // Both row groups may match col0 < 150 || col0 >= 180
+  auto upper_value         = cudf::numeric_scalar<int32_t>(180);
+  auto const upper_literal = cudf::ast::literal(upper_value);
+  auto const lower         = cudf::ast::expression(cudf::ast::ast_operator::LESS, col_ref, literal);
+  auto const upper =
+    cudf::ast::expression(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, upper_literal);
+  auto const either = cudf::ast::expression(cudf::ast::ast_operator::LOGICAL_OR, lower, upper);
+  read_opts.set_filter(&either);
+  result = cudf_io::read_parquet(read_opts);
+
+  EXPECT_EQ(result.tbl->num_rows(), 200);
+  EXPECT_EQ(result.metadata.num_pruned_row_groups, 0);
+
+  EXPECT_THROW(read_opts.set_num_rows(10), cudf::logic_error);
+}
+
 TEST_F(ParquetChunkedWriterTest, ReadRowGroupsError)
 {
   srand(31337);
@@ -2861,4 +3254,64 @@ TEST_F(ParquetReaderTest, DecimalRead)
   }
 }
 
+TEST_F(ParquetReaderTest, ChunkedRead)
+{
+  constexpr cudf::size_type num_rows = 1'000'000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  column_wrapper<int64_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows, valids);
+  auto const expected = table_view({col0, col1});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .stats_level(cudf_io::statistics_freq::STATISTICS_PAGE);
+  cudf_io::write_parquet(out_opts);
+
+  auto const read_chunks = [&](std::size_t chunk_read_limit,
+                               cudf_io::parquet_reader_options const& options) {
+    cudf_io::parquet_chunked_reader reader(chunk_read_limit, options);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    return chunks;
+  };
+  auto const concatenate_chunks = [](std::vector<std::unique_ptr<cudf::table>> const& chunks) {
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(chunk->view());
+    }
+    return cudf::concatenate(views);
+  };
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+
+  // The row group is split into chunks of whole pages
+  constexpr std::size_t chunk_read_limit = 2 * 1024 * 1024;
+  auto chunks                            = read_chunks(chunk_read_limit, read_opts);
+  EXPECT_GT(chunks.size(), 1u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*concatenate_chunks(chunks), expected);
+
+  // No limit
+  chunks = read_chunks(0, read_opts);
+  ASSERT_EQ(chunks.size(), 1u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*chunks[0], expected);
+
+  // Only the rows selected by the options are read
+  constexpr cudf::size_type skip_rows = 123'456;
+  constexpr cudf::size_type read_rows = 500'000;
+  cudf_io::parquet_reader_options range_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(skip_rows)
+      .num_rows(read_rows);
+  chunks = read_chunks(chunk_read_limit, range_opts);
+  EXPECT_GT(chunks.size(), 1u);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*concatenate_chunks(chunks),
+                                cudf::slice(expected, {skip_rows, skip_rows + read_rows})[0]);
+}
+
 CUDF_TEST_PROGRAM_MAIN()